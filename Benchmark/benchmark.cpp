@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "asm/arch/x64_i386.h"
+#include "asm/instruction_buffer.h"
+#include "asm/os/linux.h"
+
+using namespace CppAsm;
+
+/* Compare encoding speed of direct block writes and instruction buffer commits */
+namespace
+{
+	constexpr Size CODE_BLOCK_SIZE = 64 * 1024 * 1024;
+	constexpr Size ITERATIONS = 1000000;
+	constexpr Size RUNS = 5;
+
+	typedef X64::i386 testArch;
+
+	template<class BLOCK>
+	void writeSequence(BLOCK& block, int32_t i) {
+		testArch::Mov(block, X64::RAX, X64::Mem64<X64::BASE_OFFSET>(X64::RSP, S32(i)));
+		testArch::Add(block, X64::RAX, S32(i));
+		testArch::Mov(block, X64::Mem64<X64::BASE_INDEX_OFFSET>(X64::RBX, X64::R12, X64::SCALE_8, S32(i)), X64::RAX);
+		testArch::Mov(block, X64::R9, U64(static_cast<uint64_t>(i) << 32));
+	}
+
+	template<class BLOCK>
+	void writeBufferedSequence(BLOCK& block, int32_t i) {
+		Os::writeInstruction(block, [&](auto& buffer) {
+			testArch::Mov(buffer, X64::RAX, X64::Mem64<X64::BASE_OFFSET>(X64::RSP, S32(i)));
+		});
+		Os::writeInstruction(block, [&](auto& buffer) {
+			testArch::Add(buffer, X64::RAX, S32(i));
+		});
+		Os::writeInstruction(block, [&](auto& buffer) {
+			testArch::Mov(buffer, X64::Mem64<X64::BASE_INDEX_OFFSET>(X64::RBX, X64::R12, X64::SCALE_8, S32(i)), X64::RAX);
+		});
+		Os::writeInstruction(block, [&](auto& buffer) {
+			testArch::Mov(buffer, X64::R9, U64(static_cast<uint64_t>(i) << 32));
+		});
+	}
+
+	template<class WRITER>
+	double measure(Linux::CodeBlock& block, WRITER writer) {
+		double best = 0;
+		for (Size run = 0; run < RUNS; run++) {
+			block.reset();
+			auto start = std::chrono::steady_clock::now();
+			for (Size i = 0; i < ITERATIONS; i++) {
+				writer(block, static_cast<int32_t>(i));
+			}
+			std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+			double perInstruction = time.count() / (ITERATIONS * 4);
+			if (run == 0 || perInstruction < best) {
+				best = perInstruction;
+			}
+		}
+		return best;
+	}
+}
+
+int main() {
+	Linux::CodeBlock directBlock(CODE_BLOCK_SIZE);
+	Linux::CodeBlock bufferedBlock(CODE_BLOCK_SIZE);
+	double direct = measure(directBlock, [](Linux::CodeBlock& block, int32_t i) { writeSequence(block, i); });
+	double buffered = measure(bufferedBlock, [](Linux::CodeBlock& block, int32_t i) { writeBufferedSequence(block, i); });
+	bool equal = directBlock.getSize() == bufferedBlock.getSize() &&
+		std::memcmp(directBlock.getStartPtr(), bufferedBlock.getStartPtr(), directBlock.getSize()) == 0;
+	std::printf("direct:   %.2f ns/instruction\n", direct);
+	std::printf("buffered: %.2f ns/instruction\n", buffered);
+	std::printf("output %s\n", equal ? "identical" : "DIFFERENT");
+	return equal ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "x64_i386.h"
+#include "x64_VEX.h"
+
+namespace CppAsm::X64
+{
+	class BMI1 : private i386, private VEX {
+	public:
+		/* Bitwise AND of inverted src1 with src2 (dst = ~src1 & src2) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Andn(BLOCK& block, REG dst, REG src1, const T& src2) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF2), dst, src1, src2);
+		}
+
+		/* Extract bit field of src, start bit in bits 0-7 and length in bits 8-15 of ctrl */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Bextr(BLOCK& block, REG dst, const T& src, REG ctrl) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF7), dst, ctrl, src);
+		}
+
+		/* Extract lowest set bit (dst = src & -src) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Blsi(BLOCK& block, REG dst, const T& src) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b011, dst, src);
+		}
+
+		/* Mask up to lowest set bit (dst = src ^ (src - 1)) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Blsmsk(BLOCK& block, REG dst, const T& src) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b010, dst, src);
+		}
+
+		/* Reset lowest set bit (dst = src & (src - 1)) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Blsr(BLOCK& block, REG dst, const T& src) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b001, dst, src);
+		}
+
+		/* Count number of trailing zero bits (operand size if source is zero) */
+		template<class REG, class BLOCK>
+		constexpr static void Tzcnt(BLOCK& block, REG dst, REG src) {
+			template_bit_count(block, 0xBC, dst, src);
+		}
+
+		/* Count number of trailing zero bits (operand size if source is zero) */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Tzcnt(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+			template_bit_count(block, 0xBC, dst, src);
+		}
+
+		/* Count number of trailing zero bits (operand size if source is zero) */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Tzcnt(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+			template_bit_count(block, 0xBC, dst, src);
+		}
+	};
+}
\ No newline at end of file
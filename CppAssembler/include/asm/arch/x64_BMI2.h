@@ -0,0 +1,58 @@
+#pragma once
+
+#include "x64_i386.h"
+#include "x64_VEX.h"
+
+namespace CppAsm::X64
+{
+	class BMI2 : private VEX {
+	public:
+		/* Zero high bits of src starting from bit index in bits 0-7 of index */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Bzhi(BLOCK& block, REG dst, const T& src, REG index) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF5), dst, index, src);
+		}
+
+		/* Unsigned multiply EDX/RDX by src without affecting flags (high:low = EDX/RDX * src) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Mulx(BLOCK& block, REG high, REG low, const T& src) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF6), high, low, src);
+		}
+
+		/* Deposit contiguous low bits of src to bit positions selected by mask */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Pdep(BLOCK& block, REG dst, REG src, const T& mask) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF5), dst, src, mask);
+		}
+
+		/* Extract bits of src selected by mask to contiguous low bits */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Pext(BLOCK& block, REG dst, REG src, const T& mask) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F3, 0xF5), dst, src, mask);
+		}
+
+		/* Rotate right by immediate without affecting flags */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Rorx(BLOCK& block, REG dst, const T& src, U8 imm) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F3A, common::VEX_PREFIX_F2, 0xF0), dst, REG(0), src, imm); // VEX.vvvv is unused
+		}
+
+		/* Shift arithmetic right without affecting flags */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Sarx(BLOCK& block, REG dst, const T& src, REG count) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F3, 0xF7), dst, count, src);
+		}
+
+		/* Shift logical left without affecting flags */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Shlx(BLOCK& block, REG dst, const T& src, REG count) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_66, 0xF7), dst, count, src);
+		}
+
+		/* Shift logical right without affecting flags */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Shrx(BLOCK& block, REG dst, const T& src, REG count) {
+			template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF7), dst, count, src);
+		}
+	};
+}
\ No newline at end of file
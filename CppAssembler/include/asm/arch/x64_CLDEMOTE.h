@@ -0,0 +1,16 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class CLDEMOTE : private SIMD {
+	public:
+		/* Cache Line Demote - Hint to hardware to move the cache line containing mem 
+		 * to a more distant level of the cache without writing back to memory. */
+		template<class T, class BLOCK>
+		constexpr static void Cldemote(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x1C), 0b000, mem);
+		}
+	};
+}
\ No newline at end of file
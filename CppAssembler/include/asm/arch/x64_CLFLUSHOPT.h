@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class CLFLUSHOPT : private SIMD {
+	public:
+		/* Flush Cache Line Optimized containing mem */
+		template<class T, class BLOCK>
+		constexpr static void Clflushopt(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xAE), 0b111, mem);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class CLFSH : private SIMD {
+	public:
+		/* Flush Cache Line containing mem */
+		template<class T, class BLOCK>
+		constexpr static void Clflush(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b111, mem);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class CLWB : private SIMD {
+	public:
+		/* Cache Line Write Back - write back cache line containing mem (if modified)
+		 * to memory without invalidating it */
+		template<class T, class BLOCK>
+		constexpr static void Clwb(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xAE), 0b110, mem);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "x64_i386.h"
+#include "x64_i387.h"
+
+namespace CppAsm::X64
+{
+	class CMOV : private i386, private i387 {
+	protected:
+		template<class BLOCK>
+		constexpr static void template_FCMOVcc(BLOCK& block, common::Opcode opcode, uint8_t opcodeExt, RegFPU reg) {
+			common::write_Opcode(block, opcode);
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, reg);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static void template_Cmovcc(BLOCK& block, common::Opcode opcode, REG reg, REG src) {
+			static_assert(IsRegType<REG>::value, "CMOV: Invalid type of operand");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "CMOV: Invalid size of operand");
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode,
+				detail::getExtRegMask(src, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET) |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR,
+				detail::removeExtRegBit(reg), detail::removeExtRegBit(src));
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_Cmovcc(BLOCK& block, common::Opcode opcode, REG reg, const Mem64<MODE>& src) {
+			static_assert(IsRegType<REG>::value, "CMOV: Invalid type of operand");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "CMOV: Invalid size of operand");
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode, src.getExtRegMask() |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			src.write(block, detail::removeExtRegBit(reg));
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_Cmovcc(BLOCK& block, common::Opcode opcode, REG reg, const Mem32<MODE>& src) {
+			static_assert(IsRegType<REG>::value, "CMOV: Invalid type of operand");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "CMOV: Invalid size of operand");
+			src.writePrefix(block);
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode, src.getExtRegMask() |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			src.write(block, detail::removeExtRegBit(reg));
+		}
+	public:
+		template<class BLOCK>
+		constexpr static void Fcmovb(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDA, 0b000, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmove(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDA, 0b001, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovbe(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDA, 0b010, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovu(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDA, 0b011, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovnb(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDB, 0b000, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovne(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDB, 0b001, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovnbe(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDB, 0b010, reg);
+		}
+
+		template<class BLOCK>
+		constexpr static void Fcmovnu(BLOCK& block, TopRegFPU, RegFPU reg) {
+			template_FCMOVcc(block, 0xDB, 0b011, reg);
+		}
+
+		/* Move if overflow (OF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovo(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x40, reg, src);
+		}
+
+		/* Move if no overflow (OF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovno(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x41, reg, src);
+		}
+
+		/* Move if unsigned lower (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovb(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x42, reg, src);
+		}
+
+		/* Move if carry (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovc(BLOCK& block, REG reg, const T& src) {
+			Cmovb(block, reg, src);
+		}
+
+		/* Move if unsigned not greater-equal (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnae(BLOCK& block, REG reg, const T& src) {
+			Cmovb(block, reg, src);
+		}
+
+		/* Move if unsigned greater-equal (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovae(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x43, reg, src);
+		}
+
+		/* Move if no carry (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnc(BLOCK& block, REG reg, const T& src) {
+			Cmovae(block, reg, src);
+		}
+
+		/* Move if unsigned not lower (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnb(BLOCK& block, REG reg, const T& src) {
+			Cmovae(block, reg, src);
+		}
+
+		/* Move if equal (ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmove(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x44, reg, src);
+		}
+
+		/* Move if zero (ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovz(BLOCK& block, REG reg, const T& src) {
+			Cmove(block, reg, src);
+		}
+
+		/* Move if not equal (ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovne(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x45, reg, src);
+		}
+
+		/* Move if not zero (ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnz(BLOCK& block, REG reg, const T& src) {
+			Cmovne(block, reg, src);
+		}
+
+		/* Move if unsigned lower-equal (CF == 1 || ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovbe(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x46, reg, src);
+		}
+
+		/* Move if unsigned not greater (CF == 1 || ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovna(BLOCK& block, REG reg, const T& src) {
+			Cmovbe(block, reg, src);
+		}
+
+		/* Move if unsigned greater (CF == 0 && ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmova(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x47, reg, src);
+		}
+
+		/* Move if unsigned not lower-equal (CF == 0 && ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnbe(BLOCK& block, REG reg, const T& src) {
+			Cmova(block, reg, src);
+		}
+
+		/* Move if sign (SF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovs(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x48, reg, src);
+		}
+
+		/* Move if no sign (SF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovns(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x49, reg, src);
+		}
+
+		/* Move if parity (PF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovp(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4A, reg, src);
+		}
+
+		/* Move if parity even (PF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovpe(BLOCK& block, REG reg, const T& src) {
+			Cmovp(block, reg, src);
+		}
+
+		/* Move if no parity (PF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnp(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4B, reg, src);
+		}
+
+		/* Move if parity odd (PF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovpo(BLOCK& block, REG reg, const T& src) {
+			Cmovnp(block, reg, src);
+		}
+
+		/* Move if signed lower (SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovl(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4C, reg, src);
+		}
+
+		/* Move if signed not greater-equal (SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnge(BLOCK& block, REG reg, const T& src) {
+			Cmovl(block, reg, src);
+		}
+
+		/* Move if signed greater-equal (SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovge(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4D, reg, src);
+		}
+
+		/* Move if signed not lower (SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnl(BLOCK& block, REG reg, const T& src) {
+			Cmovge(block, reg, src);
+		}
+
+		/* Move if signed lower-equal (ZF == 1 || SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovle(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4E, reg, src);
+		}
+
+		/* Move if signed not greater (ZF == 1 || SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovng(BLOCK& block, REG reg, const T& src) {
+			Cmovle(block, reg, src);
+		}
+
+		/* Move if signed greater (ZF == 0 && SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovg(BLOCK& block, REG reg, const T& src) {
+			template_Cmovcc(block, 0x4F, reg, src);
+		}
+
+		/* Move if signed not lower-equal (ZF == 0 && SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmovnle(BLOCK& block, REG reg, const T& src) {
+			Cmovg(block, reg, src);
+		}
+	};
+}
\ No newline at end of file
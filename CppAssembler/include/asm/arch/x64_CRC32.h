@@ -0,0 +1,45 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class CRC32 : private SIMD {
+	private:
+		template<MemSize SIZE, class BLOCK>
+		constexpr static common::SimdOpcode write_Crc32_Opcode_Size(BLOCK& block) {
+			/*constexpr*/ if (SIZE == WORD_PTR) {
+				common::write_Opcode_16bit_Prefix(block);
+			}
+			return common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F38, SIZE == BYTE_PTR ? 0xF0 : 0xF1);
+		}
+
+		/* 32-bit accumulator with 8/16/32-bit source, 64-bit accumulator with 8/64-bit source */
+		constexpr static bool isValidSize(MemSize dstSize, MemSize srcSize) {
+			return (dstSize == DWORD_PTR && (srcSize == BYTE_PTR || srcSize == WORD_PTR || srcSize == DWORD_PTR)) ||
+				(dstSize == QWORD_PTR && (srcSize == BYTE_PTR || srcSize == QWORD_PTR));
+		}
+	public:
+		/* Accumulate CRC32C (Castagnoli polynomial) of src into dst (Reg32 or Reg64) */
+		template<class DST_REG, class SRC_REG, class BLOCK>
+		constexpr static void Crc32(BLOCK& block, DST_REG dst, SRC_REG src) {
+			static_assert(IsRegType<SRC_REG>::value, "Crc32: Second parameter is not register");
+			static_assert(isValidSize(TypeMemSize<DST_REG>::value, TypeMemSize<SRC_REG>::value), "Crc32: Invalid size of operands");
+			template_simd<TypeMemSize<DST_REG>::value == QWORD_PTR>(block, write_Crc32_Opcode_Size<TypeMemSize<SRC_REG>::value>(block), dst, src);
+		}
+
+		/* Accumulate CRC32C (Castagnoli polynomial) of src into dst (Reg32 or Reg64) */
+		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Crc32(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+			static_assert(isValidSize(TypeMemSize<REG>::value, SIZE), "Crc32: Invalid size modifier");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, write_Crc32_Opcode_Size<SIZE>(block), dst, src);
+		}
+
+		/* Accumulate CRC32C (Castagnoli polynomial) of src into dst (Reg32 or Reg64) */
+		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Crc32(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+			static_assert(isValidSize(TypeMemSize<REG>::value, SIZE), "Crc32: Invalid size modifier");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, write_Crc32_Opcode_Size<SIZE>(block), dst, src);
+		}
+	};
+}
\ No newline at end of file
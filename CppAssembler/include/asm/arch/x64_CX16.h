@@ -0,0 +1,30 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class CX16 : private i386 {
+	public:
+		/* Compare and Exchange 16 Bytes (RDX:RAX with [mem], RCX:RBX on success), mem must be 16 bytes aligned
+		 - CMPXCHG16B [mem64]
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void CmpXchg16b(BLOCK& block, const Mem64<MODE>& mem) {
+			common::write_Lock_Prefix<L>(block);
+			write_Opcode_Only_Extended_Prefixs<QWORD_PTR>(block, 0xC7, mem.getExtRegMask());
+			mem.write(block, 0b001);
+		}
+
+		/* Compare and Exchange 16 Bytes (RDX:RAX with [mem], RCX:RBX on success), mem must be 16 bytes aligned
+		 - CMPXCHG16B [mem32]
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void CmpXchg16b(BLOCK& block, const Mem32<MODE>& mem) {
+			common::write_Lock_Prefix<L>(block);
+			mem.writePrefix(block);
+			write_Opcode_Only_Extended_Prefixs<QWORD_PTR>(block, 0xC7, mem.getExtRegMask());
+			mem.write(block, 0b001);
+		}
+	};
+}
\ No newline at end of file
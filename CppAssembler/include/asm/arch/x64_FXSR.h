@@ -0,0 +1,33 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class FXSR : private SIMD {
+	public:
+		/* Save x87 FPU, MMX and SSE state into 512 bytes mem (16 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Fxsave(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b000, mem);
+		}
+
+		/* Save x87 FPU, MMX and SSE state with 64-bit FPU pointers into 512 bytes mem (16 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Fxsave64(BLOCK& block, const T& mem) {
+			template_simd_ext<true>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b000, mem);
+		}
+
+		/* Restore x87 FPU, MMX and SSE state from 512 bytes mem (16 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Fxrstor(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b001, mem);
+		}
+
+		/* Restore x87 FPU, MMX and SSE state with 64-bit FPU pointers from 512 bytes mem (16 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Fxrstor64(BLOCK& block, const T& mem) {
+			template_simd_ext<true>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b001, mem);
+		}
+	};
+}
\ No newline at end of file
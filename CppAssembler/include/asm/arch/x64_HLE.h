@@ -0,0 +1,25 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	/* Hardware lock elision hints, prefix must be written right before instruction it applies to:
+	 * LOCK ADD, ADC, AND, BTC, BTR, BTS, CMPXCHG, CMPXCHG16B, DEC, INC, NEG, NOT, OR, SBB, SUB, XADD, XOR and XCHG [mem],reg.
+	 * On processors without HLE prefixes are ignored.
+	 */
+	class HLE : private i386 {
+	public:
+		/* Start lock elision on instruction which acquires lock */
+		template<class BLOCK>
+		constexpr static void Xacquire(BLOCK& block) {
+			block.template pushRaw<uint8_t>(0xF2);
+		}
+
+		/* End lock elision on instruction which releases lock (also MOV [mem],reg/imm without LOCK) */
+		template<class BLOCK>
+		constexpr static void Xrelease(BLOCK& block) {
+			block.template pushRaw<uint8_t>(0xF3);
+		}
+	};
+}
\ No newline at end of file
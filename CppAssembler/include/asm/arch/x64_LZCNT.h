@@ -0,0 +1,27 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class LZCNT : private i386 {
+	public:
+		/* Count number of leading zero bits (operand size if source is zero) */
+		template<class REG, class BLOCK>
+		constexpr static void Lzcnt(BLOCK& block, REG dst, REG src) {
+			template_bit_count(block, 0xBD, dst, src);
+		}
+
+		/* Count number of leading zero bits (operand size if source is zero) */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Lzcnt(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+			template_bit_count(block, 0xBD, dst, src);
+		}
+
+		/* Count number of leading zero bits (operand size if source is zero) */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Lzcnt(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+			template_bit_count(block, 0xBD, dst, src);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class POPCNT : private i386 {
+	public:
+		/* Count number of set bits */
+		template<class REG, class BLOCK>
+		constexpr static void Popcnt(BLOCK& block, REG dst, REG src) {
+			template_bit_count(block, 0xB8, dst, src);
+		}
+
+		/* Count number of set bits */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Popcnt(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+			template_bit_count(block, 0xB8, dst, src);
+		}
+
+		/* Count number of set bits */
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Popcnt(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+			template_bit_count(block, 0xB8, dst, src);
+		}
+	};
+}
\ No newline at end of file
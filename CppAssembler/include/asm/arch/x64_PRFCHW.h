@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class PRFCHW : private SIMD {
+	public:
+		/* Prefetch cache line containing mem in anticipation of write */
+		template<class T, class BLOCK>
+		constexpr static void Prefetchw(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x0D), 0b001, mem);
+		}
+	};
+}
\ No newline at end of file
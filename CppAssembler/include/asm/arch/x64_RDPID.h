@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class RDPID : private SIMD {
+	public:
+		/* Read processor id (IA32_TSC_AUX) into register */
+		template<class BLOCK>
+		constexpr static void Rdpid(BLOCK& block, Reg64 reg) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0xC7), 0b111, reg);
+		}
+	};
+}
\ No newline at end of file
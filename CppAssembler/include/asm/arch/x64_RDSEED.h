@@ -0,0 +1,17 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class RDSEED : private SIMD {
+	public:
+		/* Read hardware entropy seed into register, CF == 1 if value is valid */
+		template<class REG, class BLOCK>
+		constexpr static void Rdseed(BLOCK& block, REG reg) {
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Rdseed: Invalid size of operand");
+			template_simd_ext<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode((TypeMemSize<REG>::value == WORD_PTR) ?
+				common::SIMD_PREFIX_66 : common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC7), 0b111, reg);
+		}
+	};
+}
\ No newline at end of file
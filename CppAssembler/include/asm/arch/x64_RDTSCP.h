@@ -0,0 +1,19 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class RDTSCP : private i386 {
+	public:
+		/* Read time-stamp counter into EDX:EAX and processor id into ECX
+		 * after all previous instructions executed
+		 */
+		template<class BLOCK>
+		constexpr static void Rdtscp(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x01);
+			common::write_Opcode(block, 0xF9);
+		}
+	};
+}
\ No newline at end of file
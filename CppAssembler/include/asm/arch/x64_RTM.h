@@ -0,0 +1,47 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class RTM : private i386 {
+	public:
+		/* Start transaction, on abort execution continues at label with status in EAX
+		 - XBEGIN label
+		*/
+		template<class BLOCK>
+		constexpr static FwdLabel<LONG> Xbegin(BLOCK& block) {
+			common::write_Opcode(block, 0xC7);
+			common::write_Opcode(block, 0xF8);
+			Offset offset = block.getOffset();
+			block.skipBytes(FwdLabel<LONG>::offset_size);
+			return FwdLabel<LONG>(offset);
+		}
+
+		/* Commit transaction */
+		template<class BLOCK>
+		constexpr static void Xend(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x01);
+			common::write_Opcode(block, 0xD5);
+		}
+
+		/* Abort transaction with status passed to abort handler in bits 31:24 of EAX
+		 - XABORT imm8
+		*/
+		template<class BLOCK>
+		constexpr static void Xabort(BLOCK& block, U8 status) {
+			common::write_Opcode(block, 0xC6);
+			common::write_Opcode(block, 0xF8);
+			common::write_Immediate(block, status);
+		}
+
+		/* Test if in transactional execution (ZF == 0 inside transaction) */
+		template<class BLOCK>
+		constexpr static void Xtest(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x01);
+			common::write_Opcode(block, 0xD6);
+		}
+	};
+}
\ No newline at end of file
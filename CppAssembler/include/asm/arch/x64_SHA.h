@@ -0,0 +1,51 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class SHA : private SIMD {
+	public:
+		/* Perform four rounds of SHA1 operation, function and constant are selected by imm */
+		template<class T, class BLOCK>
+		constexpr static void Sha1rnds4(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F3A, 0xCC), dst, src, imm);
+		}
+
+		/* Calculate SHA1 state variable E after four rounds */
+		template<class T, class BLOCK>
+		constexpr static void Sha1nexte(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xC8), dst, src);
+		}
+
+		/* Perform intermediate calculation for next four SHA1 message dwords */
+		template<class T, class BLOCK>
+		constexpr static void Sha1msg1(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xC9), dst, src);
+		}
+
+		/* Perform final calculation for next four SHA1 message dwords */
+		template<class T, class BLOCK>
+		constexpr static void Sha1msg2(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xCA), dst, src);
+		}
+
+		/* Perform two rounds of SHA256 operation, XMM0 contains message and constants (implicit operand) */
+		template<class T, class BLOCK>
+		constexpr static void Sha256rnds2(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xCB), dst, src);
+		}
+
+		/* Perform intermediate calculation for next four SHA256 message dwords */
+		template<class T, class BLOCK>
+		constexpr static void Sha256msg1(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xCC), dst, src);
+		}
+
+		/* Perform final calculation for next four SHA256 message dwords */
+		template<class T, class BLOCK>
+		constexpr static void Sha256msg2(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F38, 0xCD), dst, src);
+		}
+	};
+}
\ No newline at end of file
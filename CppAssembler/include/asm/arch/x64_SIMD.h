@@ -0,0 +1,75 @@
+#pragma once
+
+#include "x64_base.h"
+
+namespace CppAsm::X64
+{
+	/* Common encoding of SSE instructions: mandatory prefix, REX prefix, escape opcodes and ModRM,
+	 * operands are XMM or general purpose registers, W selects 64-bit operand size
+	 */
+	class SIMD {
+	private:
+		template<bool W, class BLOCK>
+		constexpr static void write_Opcode_SIMD(BLOCK& block, const common::SimdOpcode& opcode, uint8_t extRegsMask) {
+			common::write_SIMD_Opcode(block, opcode, (W || extRegsMask) ?
+				(0x40 | (W << detail::ExtSizePrefix::SIZE_BIT_OFFSET) | extRegsMask) : 0);
+		}
+	protected:
+		template<bool W = false, class REG, class RM_REG, class BLOCK>
+		constexpr static void template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, RM_REG rm) {
+			write_Opcode_SIMD<W>(block, opcode,
+				detail::getExtRegMask(rm, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET) |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR,
+				detail::removeExtRegBit(reg), detail::removeExtRegBit(rm));
+		}
+
+		template<bool W = false, class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, const Mem64<MODE>& rm) {
+			write_Opcode_SIMD<W>(block, opcode, rm.getExtRegMask() |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			rm.write(block, detail::removeExtRegBit(reg));
+		}
+
+		template<bool W = false, class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, const Mem32<MODE>& rm) {
+			rm.writePrefix(block);
+			write_Opcode_SIMD<W>(block, opcode, rm.getExtRegMask() |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			rm.write(block, detail::removeExtRegBit(reg));
+		}
+
+		template<bool W = false, class REG, class BLOCK>
+		constexpr static void template_simd_ext(BLOCK& block, const common::SimdOpcode& opcode, uint8_t opcodeExt, REG rm) {
+			write_Opcode_SIMD<W>(block, opcode, detail::getExtRegMask(rm, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(rm));
+		}
+
+		template<bool W = false, AddressMode MODE, class BLOCK>
+		constexpr static void template_simd_ext(BLOCK& block, const common::SimdOpcode& opcode, uint8_t opcodeExt, const Mem64<MODE>& rm) {
+			write_Opcode_SIMD<W>(block, opcode, rm.getExtRegMask());
+			rm.write(block, opcodeExt);
+		}
+
+		template<bool W = false, AddressMode MODE, class BLOCK>
+		constexpr static void template_simd_ext(BLOCK& block, const common::SimdOpcode& opcode, uint8_t opcodeExt, const Mem32<MODE>& rm) {
+			rm.writePrefix(block);
+			write_Opcode_SIMD<W>(block, opcode, rm.getExtRegMask());
+			rm.write(block, opcodeExt);
+		}
+
+		template<bool W = false, class DST, class SRC, class BLOCK>
+		constexpr static void template_simd(BLOCK& block, const common::SimdOpcode& opcode, DST dst, const SRC& src, U8 imm) {
+			template_simd<W>(block, opcode, dst, src);
+			common::write_Immediate(block, imm);
+		}
+
+		template<bool W = false, class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, const Mem64<MODE>& rm, U8 imm) {
+			write_Opcode_SIMD<W>(block, opcode, rm.getExtRegMask() |
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			detail::writeMemImm(block, rm, detail::removeExtRegBit(reg), sizeof(uint8_t));
+			common::write_Immediate(block, imm);
+		}
+	};
+}
\ No newline at end of file
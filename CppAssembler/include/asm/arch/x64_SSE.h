@@ -0,0 +1,258 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class SSE : private SIMD {
+	public:
+		/* Prefetch cache line containing mem into all cache levels */
+		template<class T, class BLOCK>
+		constexpr static void Prefetcht0(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x18), 0b001, mem);
+		}
+
+		/* Prefetch cache line containing mem into level 2 cache and higher */
+		template<class T, class BLOCK>
+		constexpr static void Prefetcht1(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x18), 0b010, mem);
+		}
+
+		/* Prefetch cache line containing mem into level 3 cache and higher */
+		template<class T, class BLOCK>
+		constexpr static void Prefetcht2(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x18), 0b011, mem);
+		}
+
+		/* Prefetch cache line containing mem with minimal cache pollution (non-temporal data) */
+		template<class T, class BLOCK>
+		constexpr static void Prefetchnta(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x18), 0b000, mem);
+		}
+
+		/* Store fence - serialize all previous stores (required after non-temporal stores) */
+		template<class BLOCK>
+		constexpr static void Sfence(BLOCK& block) {
+			common::write_SIMD_Opcode(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0b111, 0b000);
+		}
+
+		/* Move scalar float from src (XMM register or mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store scalar float of src into mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movss(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movss(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move packed floats from src (XMM register or 16 bytes aligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movaps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x28), dst, src);
+		}
+
+		/* Store packed floats of src into 16 bytes aligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movaps(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movaps(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		/* Move packed floats from src (XMM register or unaligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movups(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store packed floats of src into unaligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movups(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movups(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Add scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Addss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Subss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Mulss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Divss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Sqrtss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of scalar floats */
+		template<class T, class BLOCK>
+		constexpr static void Minss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of scalar floats */
+		template<class T, class BLOCK>
+		constexpr static void Maxss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Add packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Addps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Subps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Mulps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Divps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Sqrtps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Minps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Maxps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Bitwise AND of packed floats (e.g. absolute value with sign mask) */
+		template<class T, class BLOCK>
+		constexpr static void Andps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x54), dst, src);
+		}
+
+		/* Bitwise AND of inverted dst and src packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Andnps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x55), dst, src);
+		}
+
+		/* Bitwise OR of packed floats */
+		template<class T, class BLOCK>
+		constexpr static void Orps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x56), dst, src);
+		}
+
+		/* Bitwise XOR of packed floats (e.g. negation with sign mask or zeroing) */
+		template<class T, class BLOCK>
+		constexpr static void Xorps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x57), dst, src);
+		}
+
+		/* Compare scalar floats by predicate imm, result is all ones or zero mask */
+		template<class T, class BLOCK>
+		constexpr static void Cmpss(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Compare packed floats by predicate imm, results are all ones or zero masks */
+		template<class T, class BLOCK>
+		constexpr static void Cmpps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Unordered compare scalar floats and set ZF, PF, CF (PF == 1 if unordered) */
+		template<class T, class BLOCK>
+		constexpr static void Ucomiss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x2E), dst, src);
+		}
+
+		/* Ordered compare scalar floats and set ZF, PF, CF, signal invalid operation on QNaN */
+		template<class T, class BLOCK>
+		constexpr static void Comiss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x2F), dst, src);
+		}
+
+		/* Convert signed integer src to scalar float */
+		template<class REG, class BLOCK>
+		constexpr static void Cvtsi2ss(BLOCK& block, RegXMM dst, REG src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvtsi2ss: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert signed integer src to scalar float */
+		template<MemSize SIZE, AddressMode MODE, class BLOCK>
+		constexpr static void Cvtsi2ss(BLOCK& block, RegXMM dst, const Mem64<MODE>& src) {
+			static_assert(SIZE == DWORD_PTR || SIZE == QWORD_PTR, "Cvtsi2ss: Invalid size modifier");
+			template_simd<SIZE == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert signed integer src to scalar float */
+		template<MemSize SIZE, AddressMode MODE, class BLOCK>
+		constexpr static void Cvtsi2ss(BLOCK& block, RegXMM dst, const Mem32<MODE>& src) {
+			static_assert(SIZE == DWORD_PTR || SIZE == QWORD_PTR, "Cvtsi2ss: Invalid size modifier");
+			template_simd<SIZE == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert scalar float src to signed integer using MXCSR rounding mode */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cvtss2si(BLOCK& block, REG dst, const T& src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvtss2si: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2D), dst, src);
+		}
+
+		/* Convert scalar float src to signed integer with truncation */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cvttss2si(BLOCK& block, REG dst, const T& src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvttss2si: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2C), dst, src);
+		}
+	};
+}
\ No newline at end of file
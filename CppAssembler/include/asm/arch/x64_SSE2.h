@@ -0,0 +1,296 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class SSE2 : private SIMD {
+	public:
+		/* Load fence - serialize all previous loads */
+		template<class BLOCK>
+		constexpr static void Lfence(BLOCK& block) {
+			common::write_SIMD_Opcode(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0b101, 0b000);
+		}
+
+		/* Memory fence - serialize all previous loads and stores */
+		template<class BLOCK>
+		constexpr static void Mfence(BLOCK& block) {
+			common::write_SIMD_Opcode(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0b110, 0b000);
+		}
+
+		/* Store register (Reg32 or Reg64) to memory bypassing cache (non-temporal hint) */
+		template<class T, class REG, class BLOCK>
+		constexpr static void Movnti(BLOCK& block, const T& mem, REG src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Movnti: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC3), src, mem);
+		}
+
+		/* Store XMM register to 16-byte aligned memory bypassing cache (non-temporal hint) */
+		template<class T, class BLOCK>
+		constexpr static void Movntdq(BLOCK& block, const T& mem, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xE7), src, mem);
+		}
+
+		/* Move scalar double from src (XMM register or mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store scalar double of src into mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movsd(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movsd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move packed doubles from src (XMM register or 16 bytes aligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movapd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x28), dst, src);
+		}
+
+		/* Store packed doubles of src into 16 bytes aligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movapd(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movapd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		/* Move packed doubles from src (XMM register or unaligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static void Movupd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store packed doubles of src into unaligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movupd(BLOCK& block, const Mem64<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Movupd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move doubleword from src (Reg32 or mem) into low doubleword of dst and zero upper */
+		template<class T, class BLOCK>
+		constexpr static void Movd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x6E), dst, src);
+		}
+
+		/* Move low doubleword of src into dst (Reg32 or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Movd(BLOCK& block, const T& dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x7E), src, dst);
+		}
+
+		/* Add scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Addsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Subsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Mulsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Divsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Sqrtsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of scalar doubles */
+		template<class T, class BLOCK>
+		constexpr static void Minsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of scalar doubles */
+		template<class T, class BLOCK>
+		constexpr static void Maxsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Add packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Addpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Subpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Mulpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Divpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Sqrtpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Minpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Maxpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Bitwise AND of packed doubles (e.g. absolute value with sign mask) */
+		template<class T, class BLOCK>
+		constexpr static void Andpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x54), dst, src);
+		}
+
+		/* Bitwise AND of inverted dst and src packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Andnpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x55), dst, src);
+		}
+
+		/* Bitwise OR of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static void Orpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x56), dst, src);
+		}
+
+		/* Bitwise XOR of packed doubles (e.g. negation with sign mask or zeroing) */
+		template<class T, class BLOCK>
+		constexpr static void Xorpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x57), dst, src);
+		}
+
+		/* Compare scalar doubles by predicate imm, result is all ones or zero mask */
+		template<class T, class BLOCK>
+		constexpr static void Cmpsd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Compare packed doubles by predicate imm, results are all ones or zero masks */
+		template<class T, class BLOCK>
+		constexpr static void Cmppd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Unordered compare scalar doubles and set ZF, PF, CF (PF == 1 if unordered) */
+		template<class T, class BLOCK>
+		constexpr static void Ucomisd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x2E), dst, src);
+		}
+
+		/* Ordered compare scalar doubles and set ZF, PF, CF, signal invalid operation on QNaN */
+		template<class T, class BLOCK>
+		constexpr static void Comisd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x2F), dst, src);
+		}
+
+		/* Convert signed integer src to scalar double */
+		template<class REG, class BLOCK>
+		constexpr static void Cvtsi2sd(BLOCK& block, RegXMM dst, REG src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvtsi2sd: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert signed integer src to scalar double */
+		template<MemSize SIZE, AddressMode MODE, class BLOCK>
+		constexpr static void Cvtsi2sd(BLOCK& block, RegXMM dst, const Mem64<MODE>& src) {
+			static_assert(SIZE == DWORD_PTR || SIZE == QWORD_PTR, "Cvtsi2sd: Invalid size modifier");
+			template_simd<SIZE == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert signed integer src to scalar double */
+		template<MemSize SIZE, AddressMode MODE, class BLOCK>
+		constexpr static void Cvtsi2sd(BLOCK& block, RegXMM dst, const Mem32<MODE>& src) {
+			static_assert(SIZE == DWORD_PTR || SIZE == QWORD_PTR, "Cvtsi2sd: Invalid size modifier");
+			template_simd<SIZE == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert scalar double src to signed integer using MXCSR rounding mode */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cvtsd2si(BLOCK& block, REG dst, const T& src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvtsd2si: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2D), dst, src);
+		}
+
+		/* Convert scalar double src to signed integer with truncation */
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cvttsd2si(BLOCK& block, REG dst, const T& src) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "Cvttsd2si: Invalid size of operand");
+			template_simd<TypeMemSize<REG>::value == QWORD_PTR>(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2C), dst, src);
+		}
+
+		/* Convert scalar float src to scalar double */
+		template<class T, class BLOCK>
+		constexpr static void Cvtss2sd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5A), dst, src);
+		}
+
+		/* Convert scalar double src to scalar float */
+		template<class T, class BLOCK>
+		constexpr static void Cvtsd2ss(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5A), dst, src);
+		}
+
+		/* Move quadword from src XMM register into low quadword of dst and zero upper */
+		template<class BLOCK>
+		constexpr static void Movq(BLOCK& block, RegXMM dst, RegXMM src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x7E), dst, src);
+		}
+
+		/* Move quadword from src (Reg64 or mem) into low quadword of dst and zero upper */
+		template<class T, class BLOCK>
+		constexpr static void Movq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd<true>(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x6E), dst, src);
+		}
+
+		/* Move low quadword of src into dst (Reg64 or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Movq(BLOCK& block, const T& dst, RegXMM src) {
+			template_simd<true>(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x7E), src, dst);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,303 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class SSE4_1 : private SIMD {
+	public:
+		/* Set ZF if (dst AND src) == 0 and CF if (src AND NOT dst) == 0 */
+		template<class T, class BLOCK>
+		constexpr static void Ptest(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x17), dst, src);
+		}
+
+		/* Select bytes from src where sign bit of XMM0 byte is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Pblendvb(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x10), dst, src);
+		}
+
+		/* Select floats from src where sign bit of XMM0 float is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Blendvps(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x14), dst, src);
+		}
+
+		/* Select doubles from src where sign bit of XMM0 double is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Blendvpd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x15), dst, src);
+		}
+
+		/* Select words from src where bit of imm mask is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Pblendw(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x0E), dst, src, imm);
+		}
+
+		/* Select floats from src where bit of imm mask is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Blendps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x0C), dst, src, imm);
+		}
+
+		/* Select doubles from src where bit of imm mask is set, otherwise keep dst */
+		template<class T, class BLOCK>
+		constexpr static void Blendpd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x0D), dst, src, imm);
+		}
+
+		/* Sign extend 8 packed bytes of src to words */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxbw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x20), dst, src);
+		}
+
+		/* Sign extend 4 packed bytes of src to doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxbd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x21), dst, src);
+		}
+
+		/* Sign extend 2 packed bytes of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxbq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x22), dst, src);
+		}
+
+		/* Sign extend 4 packed words of src to doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxwd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x23), dst, src);
+		}
+
+		/* Sign extend 2 packed words of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxwq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x24), dst, src);
+		}
+
+		/* Sign extend 2 packed doublewords of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovsxdq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x25), dst, src);
+		}
+
+		/* Zero extend 8 packed bytes of src to words */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxbw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x30), dst, src);
+		}
+
+		/* Zero extend 4 packed bytes of src to doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxbd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x31), dst, src);
+		}
+
+		/* Zero extend 2 packed bytes of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxbq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x32), dst, src);
+		}
+
+		/* Zero extend 4 packed words of src to doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxwd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x33), dst, src);
+		}
+
+		/* Zero extend 2 packed words of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxwq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x34), dst, src);
+		}
+
+		/* Zero extend 2 packed doublewords of src to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmovzxdq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x35), dst, src);
+		}
+
+		/* Minimum of packed signed bytes */
+		template<class T, class BLOCK>
+		constexpr static void Pminsb(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x38), dst, src);
+		}
+
+		/* Minimum of packed signed doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pminsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x39), dst, src);
+		}
+
+		/* Minimum of packed unsigned words */
+		template<class T, class BLOCK>
+		constexpr static void Pminuw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3A), dst, src);
+		}
+
+		/* Minimum of packed unsigned doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pminud(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3B), dst, src);
+		}
+
+		/* Maximum of packed signed bytes */
+		template<class T, class BLOCK>
+		constexpr static void Pmaxsb(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3C), dst, src);
+		}
+
+		/* Maximum of packed signed doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmaxsd(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3D), dst, src);
+		}
+
+		/* Maximum of packed unsigned words */
+		template<class T, class BLOCK>
+		constexpr static void Pmaxuw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3E), dst, src);
+		}
+
+		/* Maximum of packed unsigned doublewords */
+		template<class T, class BLOCK>
+		constexpr static void Pmaxud(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x3F), dst, src);
+		}
+
+		/* Multiply packed doublewords and store low 32 bits of results */
+		template<class T, class BLOCK>
+		constexpr static void Pmulld(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x40), dst, src);
+		}
+
+		/* Multiply packed signed doublewords 0 and 2 to quadwords */
+		template<class T, class BLOCK>
+		constexpr static void Pmuldq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x28), dst, src);
+		}
+
+		/* Compare packed quadwords for equality */
+		template<class T, class BLOCK>
+		constexpr static void Pcmpeqq(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x29), dst, src);
+		}
+
+		/* Pack doublewords to words with unsigned saturation */
+		template<class T, class BLOCK>
+		constexpr static void Packusdw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x2B), dst, src);
+		}
+
+		/* Find minimum unsigned word of src, store it with its index into low doubleword of dst */
+		template<class T, class BLOCK>
+		constexpr static void Phminposuw(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x41), dst, src);
+		}
+
+		/* Load 16-byte aligned memory bypassing cache (non-temporal hint) */
+		template<class T, class BLOCK>
+		constexpr static void Movntdqa(BLOCK& block, RegXMM dst, const T& src) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x2A), dst, src);
+		}
+
+		/* Round packed floats with rounding mode imm */
+		template<class T, class BLOCK>
+		constexpr static void Roundps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x08), dst, src, imm);
+		}
+
+		/* Round packed doubles with rounding mode imm */
+		template<class T, class BLOCK>
+		constexpr static void Roundpd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x09), dst, src, imm);
+		}
+
+		/* Round scalar float with rounding mode imm */
+		template<class T, class BLOCK>
+		constexpr static void Roundss(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x0A), dst, src, imm);
+		}
+
+		/* Round scalar double with rounding mode imm */
+		template<class T, class BLOCK>
+		constexpr static void Roundsd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x0B), dst, src, imm);
+		}
+
+		/* Dot product of packed floats selected by imm mask */
+		template<class T, class BLOCK>
+		constexpr static void Dpps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x40), dst, src, imm);
+		}
+
+		/* Dot product of packed doubles selected by imm mask */
+		template<class T, class BLOCK>
+		constexpr static void Dppd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x41), dst, src, imm);
+		}
+
+		/* Sums of absolute differences of byte quadruplets selected by imm */
+		template<class T, class BLOCK>
+		constexpr static void Mpsadbw(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x42), dst, src, imm);
+		}
+
+		/* Insert float from src into dst element selected by imm and zero elements by imm mask */
+		template<class T, class BLOCK>
+		constexpr static void Insertps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x21), dst, src, imm);
+		}
+
+		/* Insert low byte of src (Reg32 or mem) into dst byte selected by imm */
+		template<class T, class BLOCK>
+		constexpr static void Pinsrb(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x20), dst, src, imm);
+		}
+
+		/* Insert doubleword src (Reg32 or mem) into dst doubleword selected by imm */
+		template<class T, class BLOCK>
+		constexpr static void Pinsrd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x22), dst, src, imm);
+		}
+
+		/* Extract byte of src selected by imm into dst (Reg32 zero extended or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Pextrb(BLOCK& block, const T& dst, RegXMM src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x14), src, dst, imm);
+		}
+
+		/* Extract word of src selected by imm into dst (Reg32 zero extended or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Pextrw(BLOCK& block, const T& dst, RegXMM src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x15), src, dst, imm);
+		}
+
+		/* Extract doubleword of src selected by imm into dst (Reg32 or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Pextrd(BLOCK& block, const T& dst, RegXMM src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x16), src, dst, imm);
+		}
+
+		/* Extract float of src selected by imm into dst (Reg32 or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Extractps(BLOCK& block, const T& dst, RegXMM src, U8 imm) {
+			template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x17), src, dst, imm);
+		}
+
+		/* Insert quadword src (Reg64 or mem) into dst quadword selected by imm */
+		template<class T, class BLOCK>
+		constexpr static void Pinsrq(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			template_simd<true>(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x22), dst, src, imm);
+		}
+
+		/* Extract quadword of src selected by imm into dst (Reg64 or mem) */
+		template<class T, class BLOCK>
+		constexpr static void Pextrq(BLOCK& block, const T& dst, RegXMM src, U8 imm) {
+			template_simd<true>(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x16), src, dst, imm);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class TSC : private i386 {
+	public:
+		/* Read time-stamp counter into EDX:EAX */
+		template<class BLOCK>
+		constexpr static void Rdtsc(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x31);
+		}
+
+		/* Read time-stamp counter after all previous instructions completed locally (LFENCE; RDTSC) */
+		template<class BLOCK>
+		constexpr static void LfenceRdtsc(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0b101, 0b000);
+			Rdtsc(block);
+		}
+	};
+}
\ No newline at end of file
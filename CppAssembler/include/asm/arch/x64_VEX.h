@@ -0,0 +1,55 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	/* Common encoding of VEX instructions with general purpose registers,
+	 * operand size (VEX.W) is selected by type of registers
+	 */
+	class VEX {
+	private:
+		template<class REG>
+		constexpr static bool isVexW() {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR, "VEX: Invalid size of operand");
+			return TypeMemSize<REG>::value == QWORD_PTR;
+		}
+
+		constexpr static uint8_t getExtRegMask(uint8_t reg) {
+			return (reg >> 3) << detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET;
+		}
+	protected:
+		template<class REG, class BLOCK>
+		constexpr static void template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, REG vvvv, REG rm) {
+			common::write_VEX_Opcode(block, opcode, getExtRegMask(reg) |
+				detail::getExtRegMask(rm, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET), isVexW<REG>(), vvvv);
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg & 0b111, detail::removeExtRegBit(rm));
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, REG vvvv, const Mem64<MODE>& rm) {
+			common::write_VEX_Opcode(block, opcode, getExtRegMask(reg) | rm.getExtRegMask(), isVexW<REG>(), vvvv);
+			rm.write(block, reg & 0b111);
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, REG vvvv, const Mem32<MODE>& rm) {
+			rm.writePrefix(block);
+			common::write_VEX_Opcode(block, opcode, getExtRegMask(reg) | rm.getExtRegMask(), isVexW<REG>(), vvvv);
+			rm.write(block, reg & 0b111);
+		}
+
+		template<class REG, class T, class BLOCK>
+		constexpr static void template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, REG vvvv, const T& rm, U8 imm) {
+			template_vex_gpr(block, opcode, reg, vvvv, rm);
+			common::write_Immediate(block, imm);
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static void template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, REG vvvv, const Mem64<MODE>& rm, U8 imm) {
+			common::write_VEX_Opcode(block, opcode, getExtRegMask(reg) | rm.getExtRegMask(), isVexW<REG>(), vvvv);
+			detail::writeMemImm(block, rm, reg & 0b111, sizeof(uint8_t));
+			common::write_Immediate(block, imm);
+		}
+	};
+}
\ No newline at end of file
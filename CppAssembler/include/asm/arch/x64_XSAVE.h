@@ -0,0 +1,41 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class XSAVE : private SIMD {
+	public:
+		/* Save processor extended states selected by EDX:EAX and XCR0 into mem (64 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Xsave(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b100, mem);
+		}
+
+		/* Save processor extended states with 64-bit FPU pointers into mem (64 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Xsave64(BLOCK& block, const T& mem) {
+			template_simd_ext<true>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b100, mem);
+		}
+
+		/* Restore processor extended states selected by EDX:EAX and XCR0 from mem (64 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Xrstor(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b101, mem);
+		}
+
+		/* Restore processor extended states with 64-bit FPU pointers from mem (64 bytes aligned) */
+		template<class T, class BLOCK>
+		constexpr static void Xrstor64(BLOCK& block, const T& mem) {
+			template_simd_ext<true>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xAE), 0b101, mem);
+		}
+
+		/* Read extended control register specified by ECX (XCR0 enabled states) into EDX:EAX */
+		template<class BLOCK>
+		constexpr static void Xgetbv(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x01);
+			common::write_Opcode(block, 0xD0);
+		}
+	};
+}
\ No newline at end of file
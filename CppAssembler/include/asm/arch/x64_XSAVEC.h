@@ -0,0 +1,21 @@
+#pragma once
+
+#include "x64_SIMD.h"
+
+namespace CppAsm::X64
+{
+	class XSAVEC : private SIMD {
+	public:
+		/* Save processor extended states selected by EDX:EAX into mem (64 bytes aligned) using compacted format */
+		template<class T, class BLOCK>
+		constexpr static void Xsavec(BLOCK& block, const T& mem) {
+			template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC7), 0b100, mem);
+		}
+
+		/* Save processor extended states with 64-bit FPU pointers into mem (64 bytes aligned) using compacted format */
+		template<class T, class BLOCK>
+		constexpr static void Xsavec64(BLOCK& block, const T& mem) {
+			template_simd_ext<true>(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC7), 0b100, mem);
+		}
+	};
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 
 #include "x86_64_base.h"
 
@@ -70,6 +71,25 @@ namespace CppAsm::X64
 		R15 = 0b1111
 	};
 
+	enum RegXMM : uint8_t {
+		XMM0 = 0b0000,
+		XMM1 = 0b0001,
+		XMM2 = 0b0010,
+		XMM3 = 0b0011,
+		XMM4 = 0b0100,
+		XMM5 = 0b0101,
+		XMM6 = 0b0110,
+		XMM7 = 0b0111,
+		XMM8 = 0b1000,
+		XMM9 = 0b1001,
+		XMM10 = 0b1010,
+		XMM11 = 0b1011,
+		XMM12 = 0b1100,
+		XMM13 = 0b1101,
+		XMM14 = 0b1110,
+		XMM15 = 0b1111
+	};
+
 	enum RegSeg : uint8_t {
 		ES = 0x26,
 		CS = 0x2E,
@@ -94,13 +114,24 @@ namespace CppAsm::X64
 		TBYTE_PTR
 	};
 
+	enum JmpSize {
+		SHORT,
+		LONG
+	};
+
+	enum LockPrefix : uint8_t {
+		NO_LOCK = 0,
+		LOCK = 0xF0
+	};
+
 	enum AddressMode {
 		OFFSET,			// segment:[offset]
 		BASE,			// segment:[base_reg]
 		BASE_OFFSET,	// segment:[base_reg+offset]
 		INDEX_OFFSET,	// segment:[index_reg*multiplier+offset]
 		BASE_INDEX,		// segment:[base_reg+index_reg*index]
-		BASE_INDEX_OFFSET // segment:[register+index_reg*multiplier+offset]
+		BASE_INDEX_OFFSET, // segment:[register+index_reg*multiplier+offset]
+		RIP_OFFSET		// segment:[rip+offset]
 	};
 
 	template<class T>
@@ -207,6 +238,10 @@ namespace CppAsm::X64
 			return Reg64(reg & 0b111);
 		}
 
+		constexpr RegXMM removeExtRegBit(RegXMM reg) {
+			return RegXMM(reg & 0b111);
+		}
+
 		template<class REG>
 		constexpr uint8_t getExtRegMask(REG reg, uint8_t bitNumber) {
 			return 0;
@@ -222,6 +257,11 @@ namespace CppAsm::X64
 			return (reg >> 3) << bitNumber;
 		}
 
+		template<>
+		constexpr uint8_t getExtRegMask(RegXMM reg, uint8_t bitNumber) {
+			return (reg >> 3) << bitNumber;
+		}
+
 		class Mem64_Seg {
 		private:
 			RegSeg mSegReg;
@@ -249,7 +289,7 @@ namespace CppAsm::X64
 			}
 			
 			template<class BLOCK>
-			void writeSegmPrefix(BLOCK& block) const {
+			constexpr void writeSegmPrefix(BLOCK& block) const {
 				block.writeRaw(mSegReg);
 				block.skipBytes(mCustomSegReg ? sizeof(mSegReg) : 0);
 			}
@@ -281,7 +321,7 @@ namespace CppAsm::X64
 				return mCustomSegReg;
 			}
 			template<class BLOCK>
-			void writeSegmPrefix(BLOCK& block) const {
+			constexpr void writeSegmPrefix(BLOCK& block) const {
 				block.writeRaw(mSegReg);
 				block.skipBytes(mCustomSegReg ? sizeof(mSegReg) : 0);
 			}
@@ -319,13 +359,13 @@ namespace CppAsm::X64
 			}
 
 			template<class BLOCK>
-			void writeSmallestOffset(BLOCK& block) const {
+			constexpr void writeSmallestOffset(BLOCK& block) const {
 				block.writeRaw(mOffset);
 				block.skipBytes(mOptimalBytes);
 			}
 			
 			template<class BLOCK>
-			void writeOffset(BLOCK& block) const {
+			constexpr void writeOffset(BLOCK& block) const {
 				block.pushRaw(mOffset);
 			}
 		};
@@ -349,8 +389,8 @@ namespace CppAsm::X64
 			}
 
 			template<class BLOCK>
-			void writeEspPostfix(BLOCK& block) const {
-				block.writeRaw<uint8_t>(0x24);
+			constexpr void writeEspPostfix(BLOCK& block) const {
+				block.template writeRaw<uint8_t>(0x24);
 				block.skipBytes(mRspBase ? sizeof(uint8_t) : 0);
 			}
 		};
@@ -374,8 +414,8 @@ namespace CppAsm::X64
 			}
 
 			template<class BLOCK>
-			void writeEspPostfix(BLOCK& block) const {
-				block.writeRaw<uint8_t>(0x24);
+			constexpr void writeEspPostfix(BLOCK& block) const {
+				block.template writeRaw<uint8_t>(0x24);
 				block.skipBytes(mRspBase ? sizeof(uint8_t) : 0);
 			}
 		};
@@ -461,6 +501,26 @@ namespace CppAsm::X64
 		struct ImmSizeExtend<DWORD_PTR, uint16_t> {
 			typedef uint32_t type;
 		};
+
+		template<>
+		struct ImmSizeExtend<QWORD_PTR, int8_t> {
+			typedef int32_t type;
+		};
+
+		template<>
+		struct ImmSizeExtend<QWORD_PTR, uint8_t> {
+			typedef uint32_t type;
+		};
+
+		template<>
+		struct ImmSizeExtend<QWORD_PTR, int16_t> {
+			typedef int32_t type;
+		};
+
+		template<>
+		struct ImmSizeExtend<QWORD_PTR, uint16_t> {
+			typedef uint32_t type;
+		};
 	}
 
 	template<AddressMode MODE = OFFSET>
@@ -480,13 +540,43 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
-			block.pushRaw<uint8_t>(0x25);
+			block.template pushRaw<uint8_t>(0x25);
 			writeOffset(block);
 		}
 	};
 
+	template<>
+	class Mem64<RIP_OFFSET> : public common::MOD_REG_OFFSET, public detail::Mem64_Seg {
+	private:
+		Addr mTarget;
+	public:
+		/* Reference to absolute address, displacement is calculated from end of instruction,
+		 * so target must be within +-2 GB of instruction
+		 */
+		explicit constexpr Mem64(Addr target) : MOD_REG_OFFSET(DISP_ADDR_ONLY), Mem64_Seg(), mTarget(target) {}
+		constexpr Mem64(RegSeg segReg, Addr target) : MOD_REG_OFFSET(DISP_ADDR_ONLY), Mem64_Seg(segReg), mTarget(target) {}
+
+		constexpr uint8_t getExtRegMask() const {
+			return 0;
+		}
+
+		constexpr Addr getTarget() const {
+			return mTarget;
+		}
+
+		/* immSize is size of immediate operand written after memory operand */
+		template<class BLOCK>
+		constexpr void write(BLOCK& block, uint8_t reg, uint8_t immSize = 0) const {
+			writeMOD_REG_RM(block, reg);
+			auto disp = common::calc_Jump_Offset(block.getCurrentPtr(), mTarget, sizeof(int32_t) + immSize);
+			assert(disp == static_cast<int32_t>(disp));
+			recordRel32(block, mTarget);
+			block.pushRaw(static_cast<int32_t>(disp));
+		}
+	};
+
 	template<>
 	class Mem64<BASE> : public common::MOD_REG_RM, public detail::Mem64_Base, public detail::Mem64_Seg {
 	public:
@@ -500,7 +590,7 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
 		}
@@ -519,12 +609,12 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void writePrefix(BLOCK& block) const {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr void writePrefix(BLOCK& block) const {
+			block.template pushRaw<uint8_t>(0x67);
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
 		}
@@ -543,7 +633,7 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
 			writeSmallestOffset(block);
@@ -563,12 +653,12 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void writePrefix(BLOCK& block) const {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr void writePrefix(BLOCK& block) const {
+			block.template pushRaw<uint8_t>(0x67);
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
 			writeSmallestOffset(block);
@@ -592,7 +682,7 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 			writeOffset(block);
@@ -616,12 +706,12 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void writePrefix(BLOCK& block) const {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr void writePrefix(BLOCK& block) const {
+			block.template pushRaw<uint8_t>(0x67);
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 			writeOffset(block);
@@ -642,7 +732,7 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 		}
@@ -662,12 +752,12 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void writePrefix(BLOCK& block) const {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr void writePrefix(BLOCK& block) const {
+			block.template pushRaw<uint8_t>(0x67);
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 		}
@@ -687,7 +777,7 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 			writeSmallestOffset(block);
@@ -708,18 +798,86 @@ namespace CppAsm::X64
 		}
 
 		template<class BLOCK>
-		void writePrefix(BLOCK& block) const {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr void writePrefix(BLOCK& block) const {
+			block.template pushRaw<uint8_t>(0x67);
 		}
 
 		template<class BLOCK>
-		void write(BLOCK& block, uint8_t reg) const {
+		constexpr void write(BLOCK& block, uint8_t reg) const {
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
 			writeSmallestOffset(block);
 		}
 	};
 
+	namespace detail
+	{
+		/* Write memory operand followed by immediate operand of immSize bytes */
+		template<AddressMode MODE, class BLOCK>
+		constexpr void writeMemImm(BLOCK& block, const Mem64<MODE>& mem, uint8_t reg, uint8_t immSize) {
+			if constexpr (MODE == RIP_OFFSET) {
+				mem.write(block, reg, immSize);
+			} else {
+				mem.write(block, reg);
+			}
+		}
+	}
+
+	template<JmpSize SIZE>
+	class FwdLabel;
+
+	template<>
+	class FwdLabel<LONG> final : public Replaceable {
+	public:
+		using Replaceable::Replaceable;
+
+		typedef int32_t offset_type;
+		static const int offset_size = sizeof(offset_type);
+
+		template<class BLOCK>
+		constexpr bool bind(BLOCK& block, Addr newAddr) const {
+			Offset labelOffset = getCbOffset();
+			auto jumpOffset = common::calc_Jump_Offset(block.getStartPtr() + labelOffset,
+				newAddr, offset_size);
+			if (jumpOffset == static_cast<offset_type>(jumpOffset)) {
+				block.writeRaw(static_cast<offset_type>(jumpOffset), labelOffset);
+				return true;
+			}
+			return false;
+		}
+
+		template<class BLOCK>
+		constexpr bool bind(BLOCK& block) const {
+			return bind(block, block.getCurrentPtr());
+		}
+	};
+
+	template<>
+	class FwdLabel<SHORT> final : public Replaceable {
+	public:
+		using Replaceable::Replaceable;
+
+		typedef int8_t offset_type;
+		static const int offset_size = sizeof(offset_type);
+
+		template<class BLOCK>
+		constexpr bool bind(BLOCK& block, Addr newAddr) const {
+			Offset labelOffset = getCbOffset();
+			auto jumpOffset = common::calc_Jump_Offset(block.getStartPtr() + labelOffset,
+				newAddr, offset_size);
+			if (common::is_Byte_Offset(jumpOffset)) {
+				block.writeRaw(static_cast<offset_type>(jumpOffset), labelOffset);
+				return true;
+			}
+			return false;
+		}
+
+		template<class BLOCK>
+		constexpr bool bind(BLOCK& block) const {
+			return bind(block, block.getCurrentPtr());
+		}
+	};
+
 	/*class Mem64
 	{
 	public:
@@ -755,7 +913,7 @@ namespace CppAsm::X64
 		SegmMem64(X86::RegSeg segment, Reg64 baseReg, uint64_t offset) : Mem64(baseReg, offset), mSegmReg(segment) {}
 		void writeSegmPrefix(CodeBlock& block, X86::RegSeg defaultSegm = X86::DS) const {
 			if (mSegmReg != defaultSegm) {
-				block.pushRaw<uint8_t>(mSegmReg);
+				block.template pushRaw<uint8_t>(mSegmReg);
 			}
 		}
 		X86::RegSeg getSegmReg() const {
@@ -19,8 +19,8 @@ namespace CppAsm::X64
 		};
 
 		template<class BLOCK>
-		static void write_Operand_Segm_Prefix(BLOCK& block, RegSeg segm) {
-			block.pushRaw<uint8_t>(segm);
+		constexpr static void write_Operand_Segm_Prefix(BLOCK& block, RegSeg segm) {
+			block.template pushRaw<uint8_t>(segm);
 		}
 
 		template<MemSize SIZE, class BLOCK>
@@ -28,13 +28,13 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct OpcodeWriter<BYTE_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode(block, opcode);
 			}
 
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode(block, opcode | (rmMode << 1));
 			}
@@ -42,15 +42,15 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct OpcodeWriter<WORD_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Opcode(block, opcode | 0b1);
 			}
 
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				common::write_Opcode_16bit_Prefix(block);
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
 			}
@@ -58,13 +58,13 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct OpcodeWriter<DWORD_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode(block, opcode | 0b1);
 			}
 
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
 			}
@@ -72,25 +72,25 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct OpcodeWriter<QWORD_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode) {
-				block.pushRaw<uint8_t>(0x48);
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
+				block.template pushRaw<uint8_t>(0x48);
 				common::write_Opcode(block, opcode | 0b1);
 			}
 
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
-				block.pushRaw<uint8_t>(0x48 | extRegsMask);
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+				block.template pushRaw<uint8_t>(0x48 | extRegsMask);
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
 			}
 		};
 
 		template<MemSize SIZE, class BLOCK>
-		static void write_Opcode(BLOCK& block, common::Opcode opcode) {
-			OpcodeWriter<MemSize, BLOCK>::write(block, opcode);
+		constexpr static void write_Opcode(BLOCK& block, common::Opcode opcode) {
+			OpcodeWriter<SIZE, BLOCK>::write(block, opcode);
 		}
 
 		template<MemSize SIZE, class BLOCK>
-		static void write_Opcode(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
-			OpcodeWriter<MemSize, BLOCK>::write(block, opcode, rmMode, extRegsMask);
+		constexpr static void write_Opcode(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			OpcodeWriter<SIZE, BLOCK>::write(block, opcode, rmMode, extRegsMask);
 		}
 
 		/*template<MemSize SIZE>
@@ -149,10 +149,10 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct ExtendedOpcodeWriter<WORD_PTR, BYTE_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				common::write_Opcode_16bit_Prefix(block);
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode | (rmMode << 1));
@@ -161,10 +161,10 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct ExtendedOpcodeWriter<WORD_PTR, WORD_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				common::write_Opcode_16bit_Prefix(block);
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
@@ -173,9 +173,9 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct ExtendedOpcodeWriter<DWORD_PTR, BYTE_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode | (rmMode << 1));
@@ -184,9 +184,9 @@ namespace CppAsm::X64
 
 		template<class BLOCK>
 		struct ExtendedOpcodeWriter<DWORD_PTR, WORD_PTR, BLOCK> {
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 				if (extRegsMask) {
-					block.pushRaw<uint8_t>(0x40 | extRegsMask);
+					block.template pushRaw<uint8_t>(0x40 | extRegsMask);
 				}
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
@@ -194,17 +194,17 @@ namespace CppAsm::X64
 		};
 
 		template<MemSize DST_SIZE, MemSize SRC_SIZE, class BLOCK>
-		static void write_Opcode_Extended(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
+		constexpr static void write_Opcode_Extended(BLOCK& block, common::Opcode opcode, OpMode rmMode, uint8_t extRegsMask) {
 			ExtendedOpcodeWriter<DST_SIZE, SRC_SIZE, BLOCK>::write(block, opcode, rmMode, extRegsMask);
 		}
 
 		template<MemSize SIZE, class T, class BLOCK>
-		static void write_Imm_Size_Extend(BLOCK& block, const Imm<T>& imm) {
-			block.pushRaw(static_cast<detail::ImmSizeExtend<SIZE, T>::type>(imm));
+		constexpr static void write_Imm_Size_Extend(BLOCK& block, const Imm<T>& imm) {
+			block.pushRaw(static_cast<typename detail::ImmSizeExtend<SIZE, T>::type>(imm));
 		}
 
 		template<class DST_REG, class SRC_REG, class BLOCK>
-		static void template_reg_reg_size_diff(BLOCK& block, common::Opcode opcode, DST_REG dst, SRC_REG src) {
+		constexpr static void template_reg_reg_size_diff(BLOCK& block, common::Opcode opcode, DST_REG dst, SRC_REG src) {
 			static_assert(IsRegType<DST_REG>::value, "Param must be register");
 			static_assert(IsRegType<SRC_REG>::value, "Param must be register");
 			write_Opcode<TypeMemSize<DST_REG>::value>(block, opcode, MODE_RR,
@@ -215,13 +215,13 @@ namespace CppAsm::X64
 		}
 
 		template<class REG, class BLOCK>
-		static void template_reg_reg(BLOCK& block, common::Opcode opcode, REG dst, REG src) {
+		constexpr static void template_reg_reg(BLOCK& block, common::Opcode opcode, REG dst, REG src) {
 			template_reg_reg_size_diff(block, opcode, dst, src);
 		}
 
 		/* 8/16/32 */
 		template<class DST_REG, class SRC_REG, class BLOCK>
-		static void template_reg_reg_ext(BLOCK& block, common::Opcode opcode, DST_REG dst, SRC_REG src) {
+		constexpr static void template_reg_reg_ext(BLOCK& block, common::Opcode opcode, DST_REG dst, SRC_REG src) {
 			static_assert(IsRegType<DST_REG>::value, "Param must be register");
 			static_assert(IsRegType<SRC_REG>::value, "Param must be register");
 			write_Opcode_Extended<TypeMemSize<DST_REG>::value, TypeMemSize<SRC_REG>::value>(block, opcode, MODE_RR,
@@ -231,16 +231,17 @@ namespace CppAsm::X64
 				detail::removeExtRegBit(src), detail::removeExtRegBit(dst));
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void template_mem_reg(BLOCK& block, common::Opcode opcode, const Mem64<MODE>& dst, REG src) {
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_mem_reg(BLOCK& block, common::Opcode opcode, const Mem64<MODE>& dst, REG src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
+			common::write_Lock_Prefix<L>(block);
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode, MODE_RM, dst.getExtRegMask() |
 				detail::getExtRegMask(src, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
 			dst.write(block, detail::removeExtRegBit(src));
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
+		constexpr static void template_reg_mem(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode, MODE_MR, src.getExtRegMask() |
 				detail::getExtRegMask(dst, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
@@ -248,16 +249,17 @@ namespace CppAsm::X64
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem_ext(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
+		constexpr static void template_reg_mem_ext(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
 			write_Opcode_Extended<TypeMemSize<REG>::value, SIZE>(block, opcode, MODE_MR, src.getExtRegMask() | 
 				detail::getExtRegMask(dst, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
 			src.write(block, detail::removeExtRegBit(dst));
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void template_mem_reg(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, REG src) {
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_mem_reg(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, REG src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
+			common::write_Lock_Prefix<L>(block);
 			dst.writePrefix(block);
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode, MODE_RM, dst.getExtRegMask() |
 				detail::getExtRegMask(src, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
@@ -265,7 +267,7 @@ namespace CppAsm::X64
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
+		constexpr static void template_reg_mem(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
 			src.writePrefix(block);
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode, MODE_MR, src.getExtRegMask() |
@@ -274,7 +276,7 @@ namespace CppAsm::X64
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem_ext(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
+		constexpr static void template_reg_mem_ext(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Param must be register");
 			src.writePrefix(block);
 			write_Opcode_Extended<TypeMemSize<REG>::value, SIZE>(block, opcode, MODE_MR, src.getExtRegMask() |
@@ -282,95 +284,343 @@ namespace CppAsm::X64
 			src.write(block, detail::removeExtRegBit(dst));
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void template_mem_imm(BLOCK& block, common::Opcode opcode, common::Opcode opcodeExt, const Mem64<MODE>& dst, const Imm<T>& src) {
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void template_mem_imm(BLOCK& block, common::Opcode opcode, common::Opcode opcodeExt, const Mem64<MODE>& dst, const Imm<T>& src) {
+			common::write_Lock_Prefix<L>(block);
 			write_Opcode<SIZE>(block, opcode, MODE_RR, dst.getExtRegMask());
-			dst.write(block, opcodeExt);
+			detail::writeMemImm(block, dst, opcodeExt, sizeof(typename detail::ImmSizeExtend<SIZE, T>::type));
 			write_Imm_Size_Extend<SIZE>(block, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void template_mem_imm(BLOCK& block, common::Opcode opcode, common::Opcode opcodeExt, const Mem32<MODE>& dst, const Imm<T>& src) {
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void template_mem_imm(BLOCK& block, common::Opcode opcode, common::Opcode opcodeExt, const Mem32<MODE>& dst, const Imm<T>& src) {
+			common::write_Lock_Prefix<L>(block);
 			dst.writePrefix(block);
 			write_Opcode<SIZE>(block, opcode, MODE_RR, dst.getExtRegMask());
 			dst.write(block, opcodeExt);
 			write_Imm_Size_Extend<SIZE>(block, src);
 		}
 
+		/* Bit count instructions (POPCNT, LZCNT, TZCNT) with mandatory REP prefix */
+		template<MemSize SIZE, class BLOCK>
+		constexpr static void write_Opcode_Bit_Count(BLOCK& block, common::Opcode opcode, uint8_t extRegsMask) {
+			/*constexpr*/ if (SIZE == WORD_PTR) {
+				common::write_Opcode_16bit_Prefix(block);
+			}
+			block.template pushRaw<uint8_t>(0xF3);
+			/*constexpr*/ if (SIZE == QWORD_PTR) {
+				block.template pushRaw<uint8_t>(0x48 | extRegsMask);
+			}
+			else if (extRegsMask) {
+				block.template pushRaw<uint8_t>(0x40 | extRegsMask);
+			}
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, opcode);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static void template_bit_count(BLOCK& block, common::Opcode opcode, REG dst, REG src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			write_Opcode_Bit_Count<TypeMemSize<REG>::value>(block, opcode,
+				detail::getExtRegMask(src, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET) |
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR,
+				detail::removeExtRegBit(dst), detail::removeExtRegBit(src));
+		}
+
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_bit_count(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			write_Opcode_Bit_Count<TypeMemSize<REG>::value>(block, opcode, src.getExtRegMask() |
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			src.write(block, detail::removeExtRegBit(dst));
+		}
+
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_bit_count(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			src.writePrefix(block);
+			write_Opcode_Bit_Count<TypeMemSize<REG>::value>(block, opcode, src.getExtRegMask() |
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			src.write(block, detail::removeExtRegBit(dst));
+		}
+
+		/* Two byte opcode (0F xx) with operand size and REX prefixes */
+		template<MemSize SIZE, class BLOCK>
+		constexpr static void write_Opcode_Only_Extended_Prefixs(BLOCK& block, common::Opcode opcode, uint8_t extRegsMask) {
+			/*constexpr*/ if (SIZE == WORD_PTR) {
+				common::write_Opcode_16bit_Prefix(block);
+			}
+			/*constexpr*/ if (SIZE == QWORD_PTR) {
+				block.template pushRaw<uint8_t>(0x48 | extRegsMask);
+			}
+			else if (extRegsMask) {
+				block.template pushRaw<uint8_t>(0x40 | extRegsMask);
+			}
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, opcode);
+		}
+
+		template<class REG>
+		constexpr static common::Opcode getSizedOpcode(common::Opcode opcode) {
+			return (TypeMemSize<REG>::value == BYTE_PTR) ? opcode : (opcode | 0b1);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static void template_ext_reg_reg(BLOCK& block, common::Opcode opcode, REG dst, REG src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, getSizedOpcode<REG>(opcode),
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET) |
+				detail::getExtRegMask(src, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR,
+				detail::removeExtRegBit(src), detail::removeExtRegBit(dst));
+		}
+
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_ext_mem_reg(BLOCK& block, common::Opcode opcode, const Mem64<MODE>& dst, REG src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			common::write_Lock_Prefix<L>(block);
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, getSizedOpcode<REG>(opcode), dst.getExtRegMask() |
+				detail::getExtRegMask(src, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			dst.write(block, detail::removeExtRegBit(src));
+		}
+
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_ext_mem_reg(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, REG src) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			common::write_Lock_Prefix<L>(block);
+			dst.writePrefix(block);
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, getSizedOpcode<REG>(opcode), dst.getExtRegMask() |
+				detail::getExtRegMask(src, detail::ExtSizePrefix::SECOND_REG_BIT_OFFSET));
+			dst.write(block, detail::removeExtRegBit(src));
+		}
+
+		/* Bit test instructions (BT, BTS, BTR, BTC) */
+		template<class REG, class BLOCK>
+		constexpr static void template_bit_operation(BLOCK& block, common::Opcode opcode, REG dst, REG src) {
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			template_ext_reg_reg(block, opcode, dst, src);
+		}
+
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_bit_operation(BLOCK& block, common::Opcode opcode, const Mem64<MODE>& dst, REG src) {
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			template_ext_mem_reg<L>(block, opcode, dst, src);
+		}
+
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void template_bit_operation(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, REG src) {
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			template_ext_mem_reg<L>(block, opcode, dst, src);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static void template_bit_operation_imm(BLOCK& block, uint8_t opcodeExt, REG reg, U8 imm) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "Invalid size of operand");
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, 0xBA,
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(reg));
+			common::write_Immediate(block, imm);
+		}
+
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void template_bit_operation_imm(BLOCK& block, uint8_t opcodeExt, const Mem64<MODE>& mem, U8 imm) {
+			static_assert(SIZE != BYTE_PTR, "Invalid size of operand");
+			common::write_Lock_Prefix<L>(block);
+			write_Opcode_Only_Extended_Prefixs<SIZE>(block, 0xBA, mem.getExtRegMask());
+			detail::writeMemImm(block, mem, opcodeExt, sizeof(uint8_t));
+			common::write_Immediate(block, imm);
+		}
+
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void template_bit_operation_imm(BLOCK& block, uint8_t opcodeExt, const Mem32<MODE>& mem, U8 imm) {
+			static_assert(SIZE != BYTE_PTR, "Invalid size of operand");
+			common::write_Lock_Prefix<L>(block);
+			mem.writePrefix(block);
+			write_Opcode_Only_Extended_Prefixs<SIZE>(block, 0xBA, mem.getExtRegMask());
+			mem.write(block, opcodeExt);
+			common::write_Immediate(block, imm);
+		}
+
+		/* Single operand instructions (INC, DEC) */
+		template<class REG, class BLOCK>
+		constexpr static void template_1reg_operand(BLOCK& block, common::Opcode opcode, uint8_t opcodeExt, REG reg) {
+			static_assert(IsRegType<REG>::value, "Param must be register");
+			write_Opcode<TypeMemSize<REG>::value>(block, opcode, MODE_RR,
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(reg));
+		}
+
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void template_1mem_operand(BLOCK& block, common::Opcode opcode, uint8_t opcodeExt, const Mem64<MODE>& mem) {
+			common::write_Lock_Prefix<L>(block);
+			write_Opcode<SIZE>(block, opcode, MODE_RR, mem.getExtRegMask());
+			mem.write(block, opcodeExt);
+		}
+
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void template_1mem_operand(BLOCK& block, common::Opcode opcode, uint8_t opcodeExt, const Mem32<MODE>& mem) {
+			common::write_Lock_Prefix<L>(block);
+			mem.writePrefix(block);
+			write_Opcode<SIZE>(block, opcode, MODE_RR, mem.getExtRegMask());
+			mem.write(block, opcodeExt);
+		}
+
 		template<class BLOCK>
-		static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Reg32& src) {
+		constexpr static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Reg32& src) {
 			template_reg_reg_size_diff(block, opcode, dst, src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Mem64<MODE>& src) {
+		constexpr static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, opcode, dst, src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Mem32<MODE>& src) {
+		constexpr static void template_reg64_extend_val(BLOCK& block, common::Opcode opcode, const Reg64& dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, opcode, dst, src);
 		}
 
 		template<class BLOCK>
-		static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg32& src) {
+		constexpr static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg32& src) {
 			template_reg_reg_ext(block, opcode, dst, src);
 		}
 
 		template<class BLOCK>
-		static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg16& src) {
+		constexpr static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg16& src) {
 			template_reg_reg_ext(block, opcode, dst, src);
 		}
 
 		template<class BLOCK>
-		static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg8& src) {
+		constexpr static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg8& src) {
 			template_reg_reg_ext(block, opcode, dst, src);
 		}
 
 		template<class BLOCK>
-		static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg16& src) {
+		constexpr static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg16& src) {
 			template_reg_reg_ext(block, opcode, dst, src);
 		}
 
 		template<class BLOCK>
-		static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg8& src) {
+		constexpr static void template_reg_reg_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg8& src) {
 			template_reg_reg_ext(block, opcode, dst, src);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem_extend_val(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
+		constexpr static void template_reg_mem_extend_val(BLOCK& block, common::Opcode opcode, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem_ext<SIZE>(block, opcode, dst, src);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void template_reg_mem_extend_val(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
+		constexpr static void template_reg_mem_extend_val(BLOCK& block, common::Opcode opcode, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem_ext<SIZE>(block, opcode, dst, src);
 		}
 	public:
+		template<class REG, class BLOCK>
+		constexpr static void template_reg_imm(BLOCK& block, uint8_t opcodeExt, REG dst, S8 imm) {
+			write_Opcode<TypeMemSize<REG>::value>(block, 0x82, MODE_RR,
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(dst));
+			common::write_Immediate(block, imm);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static void template_reg_imm(BLOCK& block, uint8_t opcodeExt, REG dst, S32 imm) {
+			write_Opcode<TypeMemSize<REG>::value>(block, 0x80, MODE_RR,
+				detail::getExtRegMask(dst, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(dst));
+			common::write_Immediate(block, imm);
+		}
+
+		template<class BLOCK>
+		constexpr static void template_reg64_short(BLOCK& block, common::Opcode opcode, Reg64 reg) {
+			uint8_t extRegsMask = detail::getExtRegMask(reg, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET);
+			if (extRegsMask) {
+				block.template pushRaw<uint8_t>(0x40 | extRegsMask);
+			}
+			common::write_Opcode(block, opcode | detail::removeExtRegBit(reg));
+		}
+		template<JmpSize SIZE, class BLOCK>
+		struct JumpWriter;
+
+		template<class BLOCK>
+		struct JumpWriter<SHORT, BLOCK> {
+			constexpr static FwdLabel<SHORT> write(BLOCK& block) {
+				common::write_Opcode(block, 0xEB);
+				Offset offset = block.getOffset();
+				block.skipBytes(FwdLabel<SHORT>::offset_size);
+				return FwdLabel<SHORT>(offset);
+			}
+
+			constexpr static FwdLabel<SHORT> writeConditional(BLOCK& block, common::Opcode opcode) {
+				common::write_Opcode(block, opcode);
+				Offset offset = block.getOffset();
+				block.skipBytes(FwdLabel<SHORT>::offset_size);
+				return FwdLabel<SHORT>(offset);
+			}
+		};
+
+		template<class BLOCK>
+		struct JumpWriter<LONG, BLOCK> {
+			constexpr static FwdLabel<LONG> write(BLOCK& block) {
+				common::write_Opcode(block, 0xE9);
+				Offset offset = block.getOffset();
+				block.skipBytes(FwdLabel<LONG>::offset_size);
+				return FwdLabel<LONG>(offset);
+			}
+
+			constexpr static FwdLabel<LONG> writeConditional(BLOCK& block, common::Opcode opcode) {
+				common::write_Opcode_Extended_Prefix(block);
+				common::write_Opcode(block, opcode & 0x0F | 0x80);
+				Offset offset = block.getOffset();
+				block.skipBytes(FwdLabel<LONG>::offset_size);
+				return FwdLabel<LONG>(offset);
+			}
+		};
+
+		template<JmpSize SIZE, class BLOCK>
+		constexpr static FwdLabel<SIZE> template_Jxx(BLOCK& block, common::Opcode opcode) {
+			return JumpWriter<SIZE, BLOCK>::writeConditional(block, opcode);
+		}
+
+		template<class BLOCK>
+		constexpr static void template_reg64_indirect(BLOCK& block, uint8_t opcodeExt, Reg64 reg) {
+			uint8_t extRegsMask = detail::getExtRegMask(reg, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET);
+			if (extRegsMask) {
+				block.template pushRaw<uint8_t>(0x40 | extRegsMask);
+			}
+			common::write_Opcode(block, 0xFF);
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, detail::removeExtRegBit(reg));
+		}
+
 #pragma region Data transfer [IN PROGRESS]
 		/* Convert byte to word */
 		template<class BLOCK>
-		static void Cbw(BLOCK& block) {
+		constexpr static void Cbw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x98);
 		}
 
 		/* Convert byte to word */
 		template<class BLOCK>
-		static void Cdq(BLOCK& block) {
+		constexpr static void Cdq(BLOCK& block) {
 			common::write_Opcode(block, 0x99);
 		}
 
 		/* Convert word to double word */
 		template<class BLOCK>
-		static void Cwd(BLOCK& block) {
+		constexpr static void Cwd(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x99);
 		}
 
 		/* Convert word to double word */
 		template<class BLOCK>
-		static void Cwde(BLOCK& block) {
+		constexpr static void Cwde(BLOCK& block) {
 			common::write_Opcode(block, 0x98);
 		}
 
@@ -378,7 +628,7 @@ namespace CppAsm::X64
 		 - LEA reg, [mem64]
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Lea(BLOCK& block, REG reg, const Mem64<MODE>& mem) {
+		constexpr static void Lea(BLOCK& block, REG reg, const Mem64<MODE>& mem) {
 			template_mem_reg(block, 0x8D, mem, reg);
 		}
 
@@ -386,7 +636,7 @@ namespace CppAsm::X64
 		 - LEA reg, [mem32]
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Lea(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Lea(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			template_mem_reg(block, 0x8D, mem, reg);
 		}
 
@@ -394,7 +644,7 @@ namespace CppAsm::X64
 		 - MOV reg,reg
 		*/
 		template<class REG, class BLOCK>
-		static void Mov(BLOCK& block, REG dst, REG src) {
+		constexpr static void Mov(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x88, dst, src);
 		}
 
@@ -402,7 +652,7 @@ namespace CppAsm::X64
 		 - MOV [mem64],reg
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Mov(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+		constexpr static void Mov(BLOCK& block, const Mem64<MODE>& dst, REG src) {
 			template_mem_reg(block, 0x88, dst, src);
 		}
 
@@ -410,7 +660,7 @@ namespace CppAsm::X64
 		 - MOV reg, [mem64]
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Mov(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Mov(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x88, dst, src);
 		}
 
@@ -418,7 +668,7 @@ namespace CppAsm::X64
 		 - MOV [mem32],reg
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Mov(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+		constexpr static void Mov(BLOCK& block, const Mem32<MODE>& dst, REG src) {
 			template_mem_reg(block, 0x88, dst, src);
 		}
 
@@ -426,7 +676,7 @@ namespace CppAsm::X64
 		 - MOV reg,[mem32]
 		*/
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Mov(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Mov(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x88, dst, src);
 		}
 
@@ -434,7 +684,7 @@ namespace CppAsm::X64
 		 - MOV [mem64],imm
 		*/
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Mov(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+		constexpr static void Mov(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
 			template_mem_imm<SIZE>(block, 0xC6, 0b000, dst, src);
 		}
 
@@ -442,7 +692,7 @@ namespace CppAsm::X64
 		 - MOV [mem32],imm
 		*/
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Mov(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+		constexpr static void Mov(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
 			template_mem_imm<SIZE>(block, 0xC6, 0b000, dst, src);
 		}
 
@@ -450,7 +700,7 @@ namespace CppAsm::X64
 		 - MOVSX reg16/32,reg
 		*/
 		template<class DEST_REG, class SRC_REG, class BLOCK>
-		static void Movsx(BLOCK& block, DEST_REG dst, SRC_REG src) {
+		constexpr static void Movsx(BLOCK& block, DEST_REG dst, SRC_REG src) {
 			template_reg_reg_extend_val(block, 0xBE, dst, src);
 		}
 
@@ -458,7 +708,7 @@ namespace CppAsm::X64
 		 - MOVSX reg16/32,[mem64]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void Movsx(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Movsx(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem_extend_val<SIZE>(block, 0xBE, dst, src);
 		}
 
@@ -466,7 +716,7 @@ namespace CppAsm::X64
 		 - MOVSX reg16/32,[mem32]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void Movsx(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Movsx(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem_extend_val<SIZE>(block, 0xBE, dst, src);
 		}
 
@@ -476,7 +726,7 @@ namespace CppAsm::X64
 		 - MOVSXD reg64,[mem32]
 		*/
 		template<class T, class BLOCK>
-		static void Movsxd(BLOCK& block, Reg64 dst, const T& src) {
+		constexpr static void Movsxd(BLOCK& block, Reg64 dst, const T& src) {
 			template_reg64_extend_val(block, 0x63, dst, src);
 		}
 
@@ -484,7 +734,7 @@ namespace CppAsm::X64
 		 - MOVZX reg16/32,reg
 		*/
 		template<class DEST_REG, class SRC_REG, class BLOCK>
-		static void Movzx(BLOCK& block, DEST_REG dst, SRC_REG src) {
+		constexpr static void Movzx(BLOCK& block, DEST_REG dst, SRC_REG src) {
 			template_reg_reg_extend_val(block, 0xB6, dst, src);
 		}
 
@@ -492,7 +742,7 @@ namespace CppAsm::X64
 		 - MOVZX reg16/32,[mem64]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void Movzx(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Movzx(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem_extend_val<SIZE>(block, 0xB6, dst, src);
 		}
 
@@ -500,7 +750,7 @@ namespace CppAsm::X64
 		 - MOVZX reg16/32,[mem32]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static void Movzx(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Movzx(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem_extend_val<SIZE>(block, 0xB6, dst, src);
 		}
 
@@ -513,273 +763,670 @@ namespace CppAsm::X64
 
 
 		/*template<class DST, class SRC, class BLOCK>
-		static auto Movzx(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Movzx(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_extend_val(block, 0xB6, dst, src);
 		}*/
 
 
 		template<class REG, class BLOCK>
-		static void Add(BLOCK& block, REG dst, REG src) {
+		constexpr static void Add(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x00, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Add(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x00, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Add(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x00, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Add(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Add(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x00, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Add(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x00, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Add(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x00, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Add(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Add(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x00, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Add(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b000, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Add(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b000, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Add(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b000, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Add(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b000, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void Adc(BLOCK& block, REG dst, REG src) {
+		constexpr static void Adc(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x10, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Adc(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x10, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Adc(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x10, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Adc(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Adc(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x10, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Adc(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x10, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Adc(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x10, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Adc(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Adc(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x10, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Adc(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b010, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Adc(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b010, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Adc(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b010, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Adc(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b010, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void Sbb(BLOCK& block, REG dst, REG src) {
+		constexpr static void Sbb(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x18, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sbb(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x18, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Sbb(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x18, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sbb(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Sbb(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x18, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sbb(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x18, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Sbb(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x18, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sbb(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Sbb(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x18, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Sbb(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b011, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Sbb(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b011, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Sbb(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b011, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Sbb(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b011, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void And(BLOCK& block, REG dst, REG src) {
+		constexpr static void And(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x20, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void And(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x20, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void And(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x20, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void And(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void And(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x20, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void And(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x20, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void And(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x20, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void And(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void And(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x20, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void And(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b100, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void And(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b100, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void And(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b100, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void And(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b100, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void Sub(BLOCK& block, REG dst, REG src) {
+		constexpr static void Sub(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x28, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sub(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x28, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Sub(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x28, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sub(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Sub(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x28, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sub(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x28, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Sub(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x28, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Sub(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Sub(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x28, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Sub(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b101, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Sub(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b101, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Sub(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b101, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Sub(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b101, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void Xor(BLOCK& block, REG dst, REG src) {
+		constexpr static void Xor(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x30, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Xor(BLOCK& block, const Mem64<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x30, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xor(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x30, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Xor(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Xor(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x30, dst, src);
 		}
 
-		template<AddressMode MODE, class REG, class BLOCK>
-		static void Xor(BLOCK& block, const Mem32<MODE>& dst, REG src) {
-			template_mem_reg(block, 0x30, dst, src);
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xor(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg<L>(block, 0x30, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Xor(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Xor(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x30, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Xor(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b110, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Xor(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b110, dst, src);
 		}
 
-		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Xor(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
-			template_mem_imm<SIZE>(block, 0x80, 0b110, dst, src);
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
+		constexpr static void Xor(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+			template_mem_imm<SIZE, L>(block, 0x80, 0b110, dst, src);
 		}
 
 
 		template<class REG, class BLOCK>
-		static void Cmp(BLOCK& block, REG dst, REG src) {
+		constexpr static void Cmp(BLOCK& block, REG dst, REG src) {
 			template_reg_reg(block, 0x38, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Cmp(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+		constexpr static void Cmp(BLOCK& block, const Mem64<MODE>& dst, REG src) {
 			template_mem_reg(block, 0x38, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Cmp(BLOCK& block, REG dst, const Mem64<MODE>& src) {
+		constexpr static void Cmp(BLOCK& block, REG dst, const Mem64<MODE>& src) {
 			template_reg_mem(block, 0x38, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Cmp(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+		constexpr static void Cmp(BLOCK& block, const Mem32<MODE>& dst, REG src) {
 			template_mem_reg(block, 0x38, dst, src);
 		}
 
 		template<AddressMode MODE, class REG, class BLOCK>
-		static void Cmp(BLOCK& block, REG dst, const Mem32<MODE>& src) {
+		constexpr static void Cmp(BLOCK& block, REG dst, const Mem32<MODE>& src) {
 			template_reg_mem(block, 0x38, dst, src);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Cmp(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
+		constexpr static void Cmp(BLOCK& block, const Mem64<MODE>& dst, const Imm<T>& src) {
 			template_mem_imm<SIZE>(block, 0x80, 0b111, dst, src);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static void Cmp(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
+		constexpr static void Cmp(BLOCK& block, const Mem32<MODE>& dst, const Imm<T>& src) {
 			template_mem_imm<SIZE>(block, 0x80, 0b111, dst, src);
 		}
 
 
 		
 
+		/* Add immediate to register
+		 - ADD reg32/64,imm8
+		 - ADD reg32/64,imm32
+		*/
+		template<class REG, class T, class BLOCK>
+		constexpr static void Add(BLOCK& block, REG dst, const Imm<T>& imm) {
+			template_reg_imm(block, 0b000, dst, imm);
+		}
+
+		/* Subtract immediate from register
+		 - SUB reg32/64,imm8
+		 - SUB reg32/64,imm32
+		*/
+		template<class REG, class T, class BLOCK>
+		constexpr static void Sub(BLOCK& block, REG dst, const Imm<T>& imm) {
+			template_reg_imm(block, 0b101, dst, imm);
+		}
+
+		/* Compare register with immediate
+		 - CMP reg32/64,imm8
+		 - CMP reg32/64,imm32
+		*/
+		template<class REG, class T, class BLOCK>
+		constexpr static void Cmp(BLOCK& block, REG dst, const Imm<T>& imm) {
+			template_reg_imm(block, 0b111, dst, imm);
+		}
+
+		/* Jump always
+		 - JMP label
+		*/
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jmp(BLOCK& block) {
+			return JumpWriter<SIZE, BLOCK>::write(block);
+		}
+
+		/* Jump always
+		 - JMP reg64
+		*/
+		template<class BLOCK>
+		constexpr static void Jmp(BLOCK& block, Reg64 reg) {
+			template_reg64_indirect(block, 0b100, reg);
+		}
+
+		/* Call procedure
+		 - CALL label
+		*/
+		template<class BLOCK>
+		constexpr static FwdLabel<LONG> Call(BLOCK& block) {
+			common::write_Opcode(block, 0xE8);
+			Offset offset = block.getOffset();
+			block.skipBytes(FwdLabel<LONG>::offset_size);
+			return FwdLabel<LONG>(offset);
+		}
+
+		/* Call procedure
+		 - CALL reg64
+		*/
+		template<class BLOCK>
+		constexpr static void Call(BLOCK& block, Reg64 reg) {
+			template_reg64_indirect(block, 0b010, reg);
+		}
+
+		/* Jump in overflow (OF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jo(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x70);
+		}
+
+		/* Jump in no overflow (OF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jno(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x71);
+		}
+
+		/* Jump if unsigned lower (CF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jb(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x72);
+		}
+
+		/* Jump if unsigned greater-equal (CF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jae(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x73);
+		}
+
+		/* Jump if equal (ZF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Je(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x74);
+		}
+
+		/* Jump if not equal (ZF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jne(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x75);
+		}
+
+		/* Jump if unsigned lower-equal (CF == 1 || ZF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jbe(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x76);
+		}
+
+		/* Jump if unsigned greater (CF == 0 && ZF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Ja(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x77);
+		}
+
+		/* Jump if sign (SF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Js(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x78);
+		}
+
+		/* Jump if no sign (SF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jns(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x79);
+		}
+
+		/* Jump if parity (PF == 1) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jp(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7A);
+		}
+
+		/* Jump if no parity (PF == 0) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jnp(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7B);
+		}
+
+		/* Jump if signed lower (SF != OF) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jl(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7C);
+		}
+
+		/* Jump if signed greater-equal (SF == OF) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jge(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7D);
+		}
+
+		/* Jump if signed lower-equal (ZF == 1 || SF != OF) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jle(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7E);
+		}
+
+		/* Jump if signed greater (ZF == 0 && SF == OF) */
+		template<JmpSize SIZE = SHORT, class BLOCK>
+		constexpr static FwdLabel<SIZE> Jg(BLOCK& block) {
+			return template_Jxx<SIZE>(block, 0x7F);
+		}
+
+		/* Push register into stack
+		 - PUSH reg64
+		*/
+		template<class BLOCK>
+		constexpr static void Push(BLOCK& block, Reg64 reg) {
+			template_reg64_short(block, 0x50, reg);
+		}
+
+		/* Pop register from stack
+		 - POP reg64
+		*/
+		template<class BLOCK>
+		constexpr static void Pop(BLOCK& block, Reg64 reg) {
+			template_reg64_short(block, 0x58, reg);
+		}
+
+		/* Return from procedure */
+		template<class BLOCK>
+		constexpr static void Ret(BLOCK& block) {
+			common::write_Opcode(block, 0xC3);
+		}
+
+		/* Return from procedure and pop parameters from stack */
+		template<class BLOCK>
+		constexpr static void Ret(BLOCK& block, U16 paramsSize) {
+			common::write_Opcode(block, 0xC2);
+			common::write_Immediate(block, paramsSize);
+		}
+
+		/* Spin-wait loop hint (REP NOP) */
 		template<class BLOCK>
-		static void Mov(BLOCK& block, Reg64 dst, S32 src) {
+		constexpr static void Pause(BLOCK& block) {
+			block.template pushRaw<uint8_t>(0xF3);
+			common::write_Opcode(block, 0x90);
+		}
+
+		/* Increment
+		 - INC reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Inc(BLOCK& block, REG reg) {
+			template_1reg_operand(block, 0xFE, 0b000, reg);
+		}
+
+		/* Increment
+		 - INC [mem64]
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void Inc(BLOCK& block, const Mem64<MODE>& mem) {
+			template_1mem_operand<SIZE, L>(block, 0xFE, 0b000, mem);
+		}
+
+		/* Increment
+		 - INC [mem32]
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void Inc(BLOCK& block, const Mem32<MODE>& mem) {
+			template_1mem_operand<SIZE, L>(block, 0xFE, 0b000, mem);
+		}
+
+		/* Decrement
+		 - DEC reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Dec(BLOCK& block, REG reg) {
+			template_1reg_operand(block, 0xFE, 0b001, reg);
+		}
+
+		/* Decrement
+		 - DEC [mem64]
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void Dec(BLOCK& block, const Mem64<MODE>& mem) {
+			template_1mem_operand<SIZE, L>(block, 0xFE, 0b001, mem);
+		}
+
+		/* Decrement
+		 - DEC [mem32]
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
+		constexpr static void Dec(BLOCK& block, const Mem32<MODE>& mem) {
+			template_1mem_operand<SIZE, L>(block, 0xFE, 0b001, mem);
+		}
+
+		/* Exchange
+		 - XCHG reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Xchg(BLOCK& block, REG dst, REG src) {
+			template_reg_reg(block, 0x86, dst, src);
+		}
+
+		/* Exchange, with memory operand always locked
+		 - XCHG [mem64],reg
+		*/
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xchg(BLOCK& block, const Mem64<MODE>& dst, REG src) {
+			template_mem_reg(block, 0x86, dst, src);
+		}
+
+		/* Exchange, with memory operand always locked
+		 - XCHG [mem32],reg
+		*/
+		template<AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xchg(BLOCK& block, const Mem32<MODE>& dst, REG src) {
+			template_mem_reg(block, 0x86, dst, src);
+		}
+
+		/* Bit test
+		 - BT reg,reg
+		 - BT [mem],reg
+		*/
+		template<class T, class REG, class BLOCK>
+		constexpr static void Bt(BLOCK& block, const T& dst, REG src) {
+			template_bit_operation(block, 0xA3, dst, src);
+		}
+
+		/* Bit test
+		 - BT reg,imm8
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Bt(BLOCK& block, REG reg, U8 imm) {
+			template_bit_operation_imm(block, 0b100, reg, imm);
+		}
+
+		/* Bit test
+		 - BT [mem],imm8
+		*/
+		template<MemSize SIZE, class MEM, class BLOCK>
+		constexpr static void Bt(BLOCK& block, const MEM& mem, U8 imm) {
+			template_bit_operation_imm<SIZE>(block, 0b100, mem, imm);
+		}
+
+		/* Bit test and set
+		 - BTS reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Bts(BLOCK& block, REG dst, REG src) {
+			template_bit_operation(block, 0xAB, dst, src);
+		}
+
+		/* Bit test and set
+		 - BTS [mem],reg
+		*/
+		template<LockPrefix L = NO_LOCK, class MEM, class REG, class BLOCK>
+		constexpr static void Bts(BLOCK& block, const MEM& dst, REG src) {
+			template_bit_operation<L>(block, 0xAB, dst, src);
+		}
+
+		/* Bit test and set
+		 - BTS reg,imm8
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Bts(BLOCK& block, REG reg, U8 imm) {
+			template_bit_operation_imm(block, 0b101, reg, imm);
+		}
+
+		/* Bit test and set
+		 - BTS [mem],imm8
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, class MEM, class BLOCK>
+		constexpr static void Bts(BLOCK& block, const MEM& mem, U8 imm) {
+			template_bit_operation_imm<SIZE, L>(block, 0b101, mem, imm);
+		}
+
+		/* Bit test and reset
+		 - BTR reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Btr(BLOCK& block, REG dst, REG src) {
+			template_bit_operation(block, 0xB3, dst, src);
+		}
+
+		/* Bit test and reset
+		 - BTR [mem],reg
+		*/
+		template<LockPrefix L = NO_LOCK, class MEM, class REG, class BLOCK>
+		constexpr static void Btr(BLOCK& block, const MEM& dst, REG src) {
+			template_bit_operation<L>(block, 0xB3, dst, src);
+		}
+
+		/* Bit test and reset
+		 - BTR reg,imm8
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Btr(BLOCK& block, REG reg, U8 imm) {
+			template_bit_operation_imm(block, 0b110, reg, imm);
+		}
+
+		/* Bit test and reset
+		 - BTR [mem],imm8
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, class MEM, class BLOCK>
+		constexpr static void Btr(BLOCK& block, const MEM& mem, U8 imm) {
+			template_bit_operation_imm<SIZE, L>(block, 0b110, mem, imm);
+		}
+
+		/* Bit test and complement
+		 - BTC reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Btc(BLOCK& block, REG dst, REG src) {
+			template_bit_operation(block, 0xBB, dst, src);
+		}
+
+		/* Bit test and complement
+		 - BTC [mem],reg
+		*/
+		template<LockPrefix L = NO_LOCK, class MEM, class REG, class BLOCK>
+		constexpr static void Btc(BLOCK& block, const MEM& dst, REG src) {
+			template_bit_operation<L>(block, 0xBB, dst, src);
+		}
+
+		/* Bit test and complement
+		 - BTC reg,imm8
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Btc(BLOCK& block, REG reg, U8 imm) {
+			template_bit_operation_imm(block, 0b111, reg, imm);
+		}
+
+		/* Bit test and complement
+		 - BTC [mem],imm8
+		*/
+		template<MemSize SIZE, LockPrefix L = NO_LOCK, class MEM, class BLOCK>
+		constexpr static void Btc(BLOCK& block, const MEM& mem, U8 imm) {
+			template_bit_operation_imm<SIZE, L>(block, 0b111, mem, imm);
+		}
+
+		template<class BLOCK>
+		constexpr static void Mov(BLOCK& block, Reg64 dst, S32 src) {
 			write_Opcode<TypeMemSize<Reg64>::value>(block, 0xC7, MODE_RR,
 				detail::getExtRegMask(dst, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0, detail::removeExtRegBit(dst));
 			common::write_Immediate(block, src);
 		}
 
+		/* Move 64-bit immediate to register
+		 - MOV reg64,imm64
+		*/
+		template<class BLOCK>
+		constexpr static void Mov(BLOCK& block, Reg64 dst, U64 src) {
+			block.template pushRaw<uint8_t>(0x48 | detail::getExtRegMask(dst, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+			common::write_Opcode(block, 0xB8 | detail::removeExtRegBit(dst));
+			common::write_Immediate(block, src);
+		}
+
 		
 	};
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "x64_i386.h"
+
+namespace CppAsm::X64
+{
+	class i486 : public i386 {
+	public:
+		/* Swap bytes inside register
+		 - BSWAP reg32
+		 - BSWAP reg64
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Bswap(BLOCK& block, REG reg) {
+			static_assert(TypeMemSize<REG>::value == DWORD_PTR || TypeMemSize<REG>::value == QWORD_PTR,
+				"Bswap: Invalid size of operand");
+			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, 0xC8 | detail::removeExtRegBit(reg),
+				detail::getExtRegMask(reg, detail::ExtSizePrefix::FIRST_REG_BIT_OFFSET));
+		}
+
+		/* Xchange and add
+		 - XADD reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void Xadd(BLOCK& block, REG dst, REG src) {
+			template_ext_reg_reg(block, 0xC0, dst, src);
+		}
+
+		/* Xchange and add
+		 - XADD [mem64],reg
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xadd(BLOCK& block, const Mem64<MODE>& mem, REG reg) {
+			template_ext_mem_reg<L>(block, 0xC0, mem, reg);
+		}
+
+		/* Xchange and add
+		 - XADD [mem32],reg
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void Xadd(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
+			template_ext_mem_reg<L>(block, 0xC0, mem, reg);
+		}
+
+		/* Compare and xchange
+		 - CMPXCHG reg,reg
+		*/
+		template<class REG, class BLOCK>
+		constexpr static void CmpXchg(BLOCK& block, REG dst, REG src) {
+			template_ext_reg_reg(block, 0xB0, dst, src);
+		}
+
+		/* Compare and xchange
+		 - CMPXCHG [mem64],reg
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void CmpXchg(BLOCK& block, const Mem64<MODE>& mem, REG reg) {
+			template_ext_mem_reg<L>(block, 0xB0, mem, reg);
+		}
+
+		/* Compare and xchange
+		 - CMPXCHG [mem32],reg
+		*/
+		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
+		constexpr static void CmpXchg(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
+			template_ext_mem_reg<L>(block, 0xB0, mem, reg);
+		}
+	};
+}
\ No newline at end of file
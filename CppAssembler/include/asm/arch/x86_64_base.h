@@ -45,12 +45,12 @@ namespace CppAsm::X86_64::detail
 		constexpr MOD_REG_RM(Mod mod, uint8_t reg, uint8_t rm) : mValue(generate(mod, reg, rm)) {}
 
 		template<class BLOCK>
-		void writeMOD_REG_RM(BLOCK& block) const {
+		constexpr void writeMOD_REG_RM(BLOCK& block) const {
 			block.pushRaw(mValue);
 		}
 
 		template<class BLOCK>
-		void writeMOD_REG_RM(BLOCK& block, uint8_t reg) const {
+		constexpr void writeMOD_REG_RM(BLOCK& block, uint8_t reg) const {
 			block.pushRaw(addReg(mValue, reg));
 		}
 	};
@@ -87,48 +87,138 @@ namespace CppAsm::X86_64::detail
 		}
 
 		template<class BLOCK>
-		void writeSIB(BLOCK& block) const {
+		constexpr void writeSIB(BLOCK& block) const {
 			block.pushRaw(mValue);
 		}
 	};
 
 	template<class BLOCK>
-	static void write_Opcode(BLOCK& block, Opcode opcode) {
+	constexpr static void write_Opcode(BLOCK& block, Opcode opcode) {
 		block.pushRaw(opcode);
 	}
 
 	template<class BLOCK>
-	static void write_Opcode_16bit_Prefix(BLOCK& block) {
-		block.pushRaw<uint8_t>(0x66);
+	constexpr static void write_Opcode_16bit_Prefix(BLOCK& block) {
+		block.template pushRaw<uint8_t>(0x66);
 	}
 
 	template<class BLOCK>
-	static void write_Opcode_Extended_Prefix(BLOCK& block) {
-		block.pushRaw<uint8_t>(0x0F);
+	constexpr static void write_Opcode_Extended_Prefix(BLOCK& block) {
+		block.template pushRaw<uint8_t>(0x0F);
 	}
 
 	template<class BLOCK>
-	static void write_MOD_REG_RM(BLOCK& block, MOD_REG_RM::Mod mod, uint8_t reg, uint8_t rm) {
+	constexpr static void write_MOD_REG_RM(BLOCK& block, MOD_REG_RM::Mod mod, uint8_t reg, uint8_t rm) {
 		block.pushRaw(MOD_REG_RM::generate(mod, reg, rm));
 	}
 
 	template<class IMM, class BLOCK>
-	static void write_Immediate(BLOCK& block, const IMM& imm) {
-		block.pushRaw<IMM::type>(imm);
+	constexpr static void write_Immediate(BLOCK& block, const IMM& imm) {
+		block.template pushRaw<typename IMM::type>(imm);
 	}
 
 	template<uint8_t R, class BLOCK>
-	static void write_Opcode_Rep(BLOCK& block, Opcode opcode) {
+	constexpr static void write_Opcode_Rep(BLOCK& block, Opcode opcode) {
 		/*constexpr*/ if (R) {
-			block.pushRaw<uint8_t>(R);
+			block.template pushRaw<uint8_t>(R);
 		}
 		write_Opcode(block, opcode);
 	}
 
 	template<uint8_t L, class BLOCK>
-	static void write_Lock_Prefix(BLOCK& block) {
+	constexpr static void write_Lock_Prefix(BLOCK& block) {
 		/*constexpr*/ if (L) {
-			block.pushRaw<uint8_t>(L);
+			block.template pushRaw<uint8_t>(L);
 		}
 	}
+
+	enum SimdPrefix : uint8_t {
+		SIMD_PREFIX_NONE = 0x00,
+		SIMD_PREFIX_66 = 0x66,
+		SIMD_PREFIX_F3 = 0xF3,
+		SIMD_PREFIX_F2 = 0xF2
+	};
+
+	enum SimdMap : uint8_t {
+		SIMD_MAP_0F = 0x00,
+		SIMD_MAP_0F38 = 0x38,
+		SIMD_MAP_0F3A = 0x3A
+	};
+
+	class SimdOpcode {
+	private:
+		SimdPrefix mPrefix;
+		SimdMap mMap;
+		Opcode mOpcode;
+	public:
+		constexpr SimdOpcode(SimdPrefix prefix, SimdMap map, Opcode opcode) : mPrefix(prefix), mMap(map), mOpcode(opcode) {}
+		constexpr SimdPrefix getPrefix() const {
+			return mPrefix;
+		}
+		constexpr SimdMap getMap() const {
+			return mMap;
+		}
+		constexpr Opcode getOpcode() const {
+			return mOpcode;
+		}
+	};
+
+	/* Write mandatory prefix, REX prefix (if not zero) and escape opcodes of SSE instruction */
+	template<class BLOCK>
+	constexpr static void write_SIMD_Opcode(BLOCK& block, const SimdOpcode& opcode, uint8_t rex = 0) {
+		/*constexpr*/ if (opcode.getPrefix()) {
+			block.template pushRaw<uint8_t>(opcode.getPrefix());
+		}
+		/*constexpr*/ if (rex) {
+			block.template pushRaw<uint8_t>(rex);
+		}
+		write_Opcode_Extended_Prefix(block);
+		/*constexpr*/ if (opcode.getMap()) {
+			block.template pushRaw<uint8_t>(opcode.getMap());
+		}
+		write_Opcode(block, opcode.getOpcode());
+	}
+
+	enum VexMap : uint8_t {
+		VEX_MAP_0F = 0b00001,
+		VEX_MAP_0F38 = 0b00010,
+		VEX_MAP_0F3A = 0b00011
+	};
+
+	enum VexPrefix : uint8_t {
+		VEX_PREFIX_NONE = 0b00,
+		VEX_PREFIX_66 = 0b01,
+		VEX_PREFIX_F3 = 0b10,
+		VEX_PREFIX_F2 = 0b11
+	};
+
+	class VexOpcode {
+	private:
+		VexMap mMap;
+		VexPrefix mPrefix;
+		Opcode mOpcode;
+	public:
+		constexpr VexOpcode(VexMap map, VexPrefix prefix, Opcode opcode) : mMap(map), mPrefix(prefix), mOpcode(opcode) {}
+		constexpr VexMap getMap() const {
+			return mMap;
+		}
+		constexpr VexPrefix getPrefix() const {
+			return mPrefix;
+		}
+		constexpr Opcode getOpcode() const {
+			return mOpcode;
+		}
+	};
+
+	/* Write three byte VEX prefix and opcode,
+	 * extRegsMask contains not inverted R (bit 2), X (bit 1), B (bit 0) extension bits,
+	 * vvvv is not inverted number of additional register operand
+	 */
+	template<class BLOCK>
+	constexpr static void write_VEX_Opcode(BLOCK& block, const VexOpcode& opcode, uint8_t extRegsMask, bool w, uint8_t vvvv, bool l = false) {
+		block.template pushRaw<uint8_t>(0xC4);
+		block.template pushRaw<uint8_t>(((~extRegsMask & 0b111) << 5) | opcode.getMap());
+		block.template pushRaw<uint8_t>((w << 7) | ((~vvvv & 0b1111) << 3) | (l << 2) | opcode.getPrefix());
+		write_Opcode(block, opcode.getOpcode());
+	}
 }
\ No newline at end of file
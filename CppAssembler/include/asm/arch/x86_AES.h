@@ -0,0 +1,45 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class AES : private SIMD {
+	public:
+		/* Perform one round of AES encryption of dst with round key src */
+		template<class T, class BLOCK>
+		constexpr static auto Aesenc(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0xDC), dst, src);
+		}
+
+		/* Perform last round of AES encryption of dst with round key src */
+		template<class T, class BLOCK>
+		constexpr static auto Aesenclast(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0xDD), dst, src);
+		}
+
+		/* Perform one round of AES decryption of dst with round key src */
+		template<class T, class BLOCK>
+		constexpr static auto Aesdec(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0xDE), dst, src);
+		}
+
+		/* Perform last round of AES decryption of dst with round key src */
+		template<class T, class BLOCK>
+		constexpr static auto Aesdeclast(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0xDF), dst, src);
+		}
+
+		/* Inverse mix columns of round key src (for decryption key schedule) */
+		template<class T, class BLOCK>
+		constexpr static auto Aesimc(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0xDB), dst, src);
+		}
+
+		/* Assist AES round key generation from src with round constant imm */
+		template<class T, class BLOCK>
+		constexpr static auto Aeskeygenassist(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0xDF), dst, src, imm);
+		}
+	};
+}
\ No newline at end of file
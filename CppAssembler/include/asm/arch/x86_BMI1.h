@@ -0,0 +1,54 @@
+#pragma once
+
+#include "x86_i386.h"
+#include "x86_VEX.h"
+
+namespace CppAsm::X86
+{
+	class BMI1 : private i386, private VEX {
+	public:
+		/* Bitwise AND of inverted src1 with src2 (dst = ~src1 & src2) */
+		template<class T, class BLOCK>
+		constexpr static auto Andn(BLOCK& block, Reg32 dst, Reg32 src1, const T& src2) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF2), dst, src1, src2);
+		}
+
+		/* Extract bit field of src, start bit in bits 0-7 and length in bits 8-15 of ctrl */
+		template<class T, class BLOCK>
+		constexpr static auto Bextr(BLOCK& block, Reg32 dst, const T& src, Reg32 ctrl) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF7), dst, ctrl, src);
+		}
+
+		/* Extract lowest set bit (dst = src & -src) */
+		template<class T, class BLOCK>
+		constexpr static auto Blsi(BLOCK& block, Reg32 dst, const T& src) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b011, dst, src).second;
+		}
+
+		/* Mask up to lowest set bit (dst = src ^ (src - 1)) */
+		template<class T, class BLOCK>
+		constexpr static auto Blsmsk(BLOCK& block, Reg32 dst, const T& src) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b010, dst, src).second;
+		}
+
+		/* Reset lowest set bit (dst = src & (src - 1)) */
+		template<class T, class BLOCK>
+		constexpr static auto Blsr(BLOCK& block, Reg32 dst, const T& src) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF3), 0b001, dst, src).second;
+		}
+
+		/* Count number of trailing zero bits (operand size if source is zero) */
+		template<class REG, class BLOCK>
+		constexpr static auto Tzcnt(BLOCK& block, REG reg1, REG reg2) {
+			static_assert(IsRegType<REG>::value, "Tzcnt: First and second parameter is not register");
+			return template_bit_count(block, 0xBC, reg1, reg2);
+		}
+
+		/* Count number of trailing zero bits (operand size if source is zero) */
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static auto Tzcnt(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+			static_assert(IsRegType<REG>::value, "Tzcnt: First parameter is not register");
+			return template_bit_count(block, 0xBC, reg, mem);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "x86_i386.h"
+#include "x86_VEX.h"
+
+namespace CppAsm::X86
+{
+	class BMI2 : private VEX {
+	public:
+		/* Zero high bits of src starting from bit index in bits 0-7 of index */
+		template<class T, class BLOCK>
+		constexpr static auto Bzhi(BLOCK& block, Reg32 dst, const T& src, Reg32 index) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_NONE, 0xF5), dst, index, src);
+		}
+
+		/* Unsigned multiply EDX by src without affecting flags (high:low = EDX * src) */
+		template<class T, class BLOCK>
+		constexpr static auto Mulx(BLOCK& block, Reg32 high, Reg32 low, const T& src) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF6), high, low, src);
+		}
+
+		/* Deposit contiguous low bits of src to bit positions selected by mask */
+		template<class T, class BLOCK>
+		constexpr static auto Pdep(BLOCK& block, Reg32 dst, Reg32 src, const T& mask) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF5), dst, src, mask);
+		}
+
+		/* Extract bits of src selected by mask to contiguous low bits */
+		template<class T, class BLOCK>
+		constexpr static auto Pext(BLOCK& block, Reg32 dst, Reg32 src, const T& mask) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F3, 0xF5), dst, src, mask);
+		}
+
+		/* Rotate right by immediate without affecting flags */
+		template<class T, class BLOCK>
+		constexpr static auto Rorx(BLOCK& block, Reg32 dst, const T& src, U8 imm) {
+			auto result = template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F3A, common::VEX_PREFIX_F2, 0xF0), dst, EAX, src); // VEX.vvvv is unused
+			common::write_Immediate(block, imm);
+			return result;
+		}
+
+		/* Shift arithmetic right without affecting flags */
+		template<class T, class BLOCK>
+		constexpr static auto Sarx(BLOCK& block, Reg32 dst, const T& src, Reg32 count) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F3, 0xF7), dst, count, src);
+		}
+
+		/* Shift logical left without affecting flags */
+		template<class T, class BLOCK>
+		constexpr static auto Shlx(BLOCK& block, Reg32 dst, const T& src, Reg32 count) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_66, 0xF7), dst, count, src);
+		}
+
+		/* Shift logical right without affecting flags */
+		template<class T, class BLOCK>
+		constexpr static auto Shrx(BLOCK& block, Reg32 dst, const T& src, Reg32 count) {
+			return template_vex_gpr(block, common::VexOpcode(common::VEX_MAP_0F38, common::VEX_PREFIX_F2, 0xF7), dst, count, src);
+		}
+	};
+}
\ No newline at end of file
@@ -9,7 +9,7 @@ namespace CppAsm::X86
 		/* Cache Line Demote - Hint to hardware to move the cache line containing mem 
 		 * to a more distant level of the cache without writing back to memory. */
 		template<AddressMode MODE, class BLOCK>
-		static void Cldemote(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Cldemote(BLOCK& block, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0x1C);
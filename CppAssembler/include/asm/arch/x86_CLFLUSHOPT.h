@@ -8,7 +8,7 @@ namespace CppAsm::X86
 	public:
 		/* Flush Cache Line Optimized containing mem */
 		template<AddressMode MODE, class BLOCK>
-		static void Clflushopt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Clflushopt(BLOCK& block, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Extended_Prefix(block);
@@ -8,7 +8,7 @@ namespace CppAsm::X86
 	public:
 		/* Flush Cache Line containing mem */
 		template<AddressMode MODE, class BLOCK>
-		static void Clflush(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Clflush(BLOCK& block, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0xAE);
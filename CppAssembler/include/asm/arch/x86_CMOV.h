@@ -1,7 +1,7 @@
 #pragma once
 
 
-#include "x86_i686.h"
+#include "x86_i386.h"
 #include "x86_i387.h"
 
 namespace CppAsm::X86
@@ -9,49 +9,234 @@ namespace CppAsm::X86
 	class CMOV : private i386, private i387 {
 	protected:
 		template<class BLOCK>
-		static void template_FCMOVcc(BLOCK& block, const detail::OpcodeLarge& opcode, RegFPU reg) {
+		constexpr static void template_FCMOVcc(BLOCK& block, const detail::OpcodeLarge& opcode, RegFPU reg) {
 			common::write_Opcode(block, opcode.getOpcode());
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
 		}
+
+		template<class REG, class T, class BLOCK>
+		constexpr static auto template_Cmovcc(BLOCK& block, common::Opcode opcode, REG reg, const T& src) {
+			return template_bit_scan(block, opcode, reg, src);
+		}
 	public:
 		template<class BLOCK>
-		static void Fcmovb(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovb(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDA, 0b000), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmove(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmove(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDA, 0b001), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovbe(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovbe(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDA, 0b010), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovu(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovu(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDA, 0b011), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovnb(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovnb(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDB, 0b000), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovne(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovne(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDB, 0b001), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovnbe(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovnbe(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDB, 0b010), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcmovnu(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcmovnu(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_FCMOVcc(block, detail::OpcodeLarge(0xDB, 0b011), reg);
 		}
+
+		/* Move if overflow (OF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovo(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x40, reg, src);
+		}
+
+		/* Move if no overflow (OF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovno(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x41, reg, src);
+		}
+
+		/* Move if unsigned lower (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovb(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x42, reg, src);
+		}
+
+		/* Move if carry (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovc(BLOCK& block, REG reg, const T& src) {
+			return Cmovb(block, reg, src);
+		}
+
+		/* Move if unsigned not greater-equal (CF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnae(BLOCK& block, REG reg, const T& src) {
+			return Cmovb(block, reg, src);
+		}
+
+		/* Move if unsigned greater-equal (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovae(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x43, reg, src);
+		}
+
+		/* Move if no carry (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnc(BLOCK& block, REG reg, const T& src) {
+			return Cmovae(block, reg, src);
+		}
+
+		/* Move if unsigned not lower (CF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnb(BLOCK& block, REG reg, const T& src) {
+			return Cmovae(block, reg, src);
+		}
+
+		/* Move if equal (ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmove(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x44, reg, src);
+		}
+
+		/* Move if zero (ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovz(BLOCK& block, REG reg, const T& src) {
+			return Cmove(block, reg, src);
+		}
+
+		/* Move if not equal (ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovne(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x45, reg, src);
+		}
+
+		/* Move if not zero (ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnz(BLOCK& block, REG reg, const T& src) {
+			return Cmovne(block, reg, src);
+		}
+
+		/* Move if unsigned lower-equal (CF == 1 || ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovbe(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x46, reg, src);
+		}
+
+		/* Move if unsigned not greater (CF == 1 || ZF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovna(BLOCK& block, REG reg, const T& src) {
+			return Cmovbe(block, reg, src);
+		}
+
+		/* Move if unsigned greater (CF == 0 && ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmova(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x47, reg, src);
+		}
+
+		/* Move if unsigned not lower-equal (CF == 0 && ZF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnbe(BLOCK& block, REG reg, const T& src) {
+			return Cmova(block, reg, src);
+		}
+
+		/* Move if sign (SF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovs(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x48, reg, src);
+		}
+
+		/* Move if no sign (SF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovns(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x49, reg, src);
+		}
+
+		/* Move if parity (PF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovp(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4A, reg, src);
+		}
+
+		/* Move if parity even (PF == 1) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovpe(BLOCK& block, REG reg, const T& src) {
+			return Cmovp(block, reg, src);
+		}
+
+		/* Move if no parity (PF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnp(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4B, reg, src);
+		}
+
+		/* Move if parity odd (PF == 0) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovpo(BLOCK& block, REG reg, const T& src) {
+			return Cmovnp(block, reg, src);
+		}
+
+		/* Move if signed lower (SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovl(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4C, reg, src);
+		}
+
+		/* Move if signed not greater-equal (SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnge(BLOCK& block, REG reg, const T& src) {
+			return Cmovl(block, reg, src);
+		}
+
+		/* Move if signed greater-equal (SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovge(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4D, reg, src);
+		}
+
+		/* Move if signed not lower (SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnl(BLOCK& block, REG reg, const T& src) {
+			return Cmovge(block, reg, src);
+		}
+
+		/* Move if signed lower-equal (ZF == 1 || SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovle(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4E, reg, src);
+		}
+
+		/* Move if signed not greater (ZF == 1 || SF != OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovng(BLOCK& block, REG reg, const T& src) {
+			return Cmovle(block, reg, src);
+		}
+
+		/* Move if signed greater (ZF == 0 && SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovg(BLOCK& block, REG reg, const T& src) {
+			return template_Cmovcc(block, 0x4F, reg, src);
+		}
+
+		/* Move if signed not lower-equal (ZF == 0 && SF == OF) */
+		template<class REG, class T, class BLOCK>
+		constexpr static auto Cmovnle(BLOCK& block, REG reg, const T& src) {
+			return Cmovg(block, reg, src);
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class CRC32 : private SIMD {
+	private:
+		template<MemSize SIZE, class BLOCK>
+		constexpr static common::SimdOpcode write_Crc32_Opcode_Size(BLOCK& block) {
+			/*constexpr*/ if (SIZE == WORD_PTR) {
+				common::write_Opcode_16bit_Prefix(block);
+			}
+			return common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F38, SIZE == BYTE_PTR ? 0xF0 : 0xF1);
+		}
+	public:
+		/* Accumulate CRC32C (Castagnoli polynomial) of src into dst */
+		template<class REG, class BLOCK>
+		constexpr static auto Crc32(BLOCK& block, Reg32 dst, REG src) {
+			static_assert(IsRegType<REG>::value, "Crc32: Second parameter is not register");
+			return template_simd(block, write_Crc32_Opcode_Size<TypeMemSize<REG>::value>(block), dst, src);
+		}
+
+		/* Accumulate CRC32C (Castagnoli polynomial) of src into dst */
+		template<MemSize SIZE, AddressMode MODE, class BLOCK>
+		constexpr static auto Crc32(BLOCK& block, Reg32 dst, const Mem32<MODE>& src) {
+			static_assert(SIZE == BYTE_PTR || SIZE == WORD_PTR || SIZE == DWORD_PTR, "Crc32: Invalid size modifier");
+			return template_simd(block, write_Crc32_Opcode_Size<SIZE>(block), dst, src);
+		}
+	};
+}
\ No newline at end of file
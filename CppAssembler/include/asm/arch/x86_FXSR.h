@@ -0,0 +1,27 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	class FXSR : private i386 {
+	public:
+		/* Save x87 FPU, MMX and SSE state into 512 bytes mem (16 bytes aligned) */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Fxsave(BLOCK& block, const Mem32<MODE>& mem) {
+			mem.writeSegmPrefix(block);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			mem.write(block, 0b000);
+		}
+
+		/* Restore x87 FPU, MMX and SSE state from 512 bytes mem (16 bytes aligned) */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Fxrstor(BLOCK& block, const Mem32<MODE>& mem) {
+			mem.writeSegmPrefix(block);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			mem.write(block, 0b001);
+		}
+	};
+}
\ No newline at end of file
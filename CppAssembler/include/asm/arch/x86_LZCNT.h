@@ -0,0 +1,23 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	class LZCNT : private i386 {
+	public:
+		/* Count number of leading zero bits (operand size if source is zero) */
+		template<class REG, class BLOCK>
+		constexpr static auto Lzcnt(BLOCK& block, REG reg1, REG reg2) {
+			static_assert(IsRegType<REG>::value, "Lzcnt: First and second parameter is not register");
+			return template_bit_count(block, 0xBD, reg1, reg2);
+		}
+
+		/* Count number of leading zero bits (operand size if source is zero) */
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static auto Lzcnt(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+			static_assert(IsRegType<REG>::value, "Lzcnt: First parameter is not register");
+			return template_bit_count(block, 0xBD, reg, mem);
+		}
+	};
+}
\ No newline at end of file
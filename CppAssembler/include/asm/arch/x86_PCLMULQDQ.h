@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class PCLMULQDQ : private SIMD {
+	public:
+		/* Carry-less multiplication of quadwords of dst and src selected by bits 0 and 4 of imm */
+		template<class T, class BLOCK>
+		constexpr static auto Pclmulqdq(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x44), dst, src, imm);
+		}
+	};
+}
\ No newline at end of file
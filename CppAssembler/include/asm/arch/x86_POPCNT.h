@@ -0,0 +1,23 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	class POPCNT : private i386 {
+	public:
+		/* Count number of set bits */
+		template<class REG, class BLOCK>
+		constexpr static auto Popcnt(BLOCK& block, REG reg1, REG reg2) {
+			static_assert(IsRegType<REG>::value, "Popcnt: First and second parameter is not register");
+			return template_bit_count(block, 0xB8, reg1, reg2);
+		}
+
+		/* Count number of set bits */
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static auto Popcnt(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+			static_assert(IsRegType<REG>::value, "Popcnt: First parameter is not register");
+			return template_bit_count(block, 0xB8, reg, mem);
+		}
+	};
+}
\ No newline at end of file
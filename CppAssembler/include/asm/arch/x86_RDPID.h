@@ -0,0 +1,15 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class RDPID : private SIMD {
+	public:
+		/* Read processor id (IA32_TSC_AUX) into register */
+		template<class BLOCK>
+		constexpr static auto Rdpid(BLOCK& block, Reg32 reg) {
+			return template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0xC7), 0b111, reg);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class RDRAND : private SIMD {
+	public:
+		/* Read hardware random number into register, CF == 1 if value is valid */
+		template<class REG, class BLOCK>
+		constexpr static auto Rdrand(BLOCK& block, REG reg) {
+			static_assert(TypeMemSize<REG>::value == WORD_PTR || TypeMemSize<REG>::value == DWORD_PTR, "Rdrand: Invalid size of operand");
+			return template_simd_ext(block, common::SimdOpcode((TypeMemSize<REG>::value == WORD_PTR) ?
+				common::SIMD_PREFIX_66 : common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC7), 0b110, reg);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <utility>
+
+#include "x86_base.h"
+
+namespace CppAsm::X86
+{
+	/* Common encoding of SSE instructions: mandatory prefix, escape opcodes and ModRM,
+	 * operands are XMM or general purpose registers
+	 */
+	class SIMD {
+	protected:
+		template<class REG, class RM_REG, class BLOCK>
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableReg<RM_REG>> template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, RM_REG rm) {
+			common::write_SIMD_Opcode(block, opcode);
+			Offset offset = block.getOffset();
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, rm);
+			return std::make_pair(ReplaceableReg<REG>(offset, common::MOD_REG_RM::REG_BIT_OFFSET),
+				ReplaceableReg<RM_REG>(offset, common::MOD_REG_RM::RM_BIT_OFFSET));
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableMem32<MODE>> template_simd(BLOCK& block, const common::SimdOpcode& opcode, REG reg, const Mem32<MODE>& rm) {
+			rm.writeSegmPrefix(block);
+			common::write_SIMD_Opcode(block, opcode);
+			auto replaceMem = rm.write(block, reg);
+			return std::make_pair(replaceMem.template getOtherReg<REG>(), replaceMem);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static ReplaceableReg<REG> template_simd_ext(BLOCK& block, const common::SimdOpcode& opcode, uint8_t opcodeExt, REG rm) {
+			common::write_SIMD_Opcode(block, opcode);
+			Offset offset = block.getOffset();
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcodeExt, rm);
+			return ReplaceableReg<REG>(offset, common::MOD_REG_RM::RM_BIT_OFFSET);
+		}
+
+		template<class DST, class SRC, class BLOCK>
+		constexpr static auto template_simd(BLOCK& block, const common::SimdOpcode& opcode, DST dst, const SRC& src, U8 imm) {
+			auto result = template_simd(block, opcode, dst, src);
+			common::write_Immediate(block, imm);
+			return result;
+		}
+	};
+}
\ No newline at end of file
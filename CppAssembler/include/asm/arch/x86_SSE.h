@@ -0,0 +1,195 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class SSE : private SIMD {
+	public:
+		/* Move scalar float from src (XMM register or mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store scalar float of src into mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movss(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move packed floats from src (XMM register or 16 bytes aligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movaps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x28), dst, src);
+		}
+
+		/* Store packed floats of src into 16 bytes aligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movaps(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		/* Move packed floats from src (XMM register or unaligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movups(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store packed floats of src into unaligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movups(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Add scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Addss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Subss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Mulss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Divss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Sqrtss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of scalar floats */
+		template<class T, class BLOCK>
+		constexpr static auto Minss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of scalar floats */
+		template<class T, class BLOCK>
+		constexpr static auto Maxss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Add packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Addps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Subps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Mulps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Divps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Sqrtps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Minps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Maxps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Bitwise AND of packed floats (e.g. absolute value with sign mask) */
+		template<class T, class BLOCK>
+		constexpr static auto Andps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x54), dst, src);
+		}
+
+		/* Bitwise AND of inverted dst and src packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Andnps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x55), dst, src);
+		}
+
+		/* Bitwise OR of packed floats */
+		template<class T, class BLOCK>
+		constexpr static auto Orps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x56), dst, src);
+		}
+
+		/* Bitwise XOR of packed floats (e.g. negation with sign mask or zeroing) */
+		template<class T, class BLOCK>
+		constexpr static auto Xorps(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x57), dst, src);
+		}
+
+		/* Compare scalar floats by predicate imm, result is all ones or zero mask */
+		template<class T, class BLOCK>
+		constexpr static auto Cmpss(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Compare packed floats by predicate imm, results are all ones or zero masks */
+		template<class T, class BLOCK>
+		constexpr static auto Cmpps(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Unordered compare scalar floats and set ZF, PF, CF (PF == 1 if unordered) */
+		template<class T, class BLOCK>
+		constexpr static auto Ucomiss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x2E), dst, src);
+		}
+
+		/* Ordered compare scalar floats and set ZF, PF, CF, signal invalid operation on QNaN */
+		template<class T, class BLOCK>
+		constexpr static auto Comiss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_NONE, common::SIMD_MAP_0F, 0x2F), dst, src);
+		}
+
+		/* Convert signed integer src to scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtsi2ss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert scalar float src to signed integer using MXCSR rounding mode */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtss2si(BLOCK& block, Reg32 dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2D), dst, src);
+		}
+
+		/* Convert scalar float src to signed integer with truncation */
+		template<class T, class BLOCK>
+		constexpr static auto Cvttss2si(BLOCK& block, Reg32 dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x2C), dst, src);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class SSE2 : private SIMD {
+	public:
+		/* Move scalar double from src (XMM register or mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store scalar double of src into mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movsd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move packed doubles from src (XMM register or 16 bytes aligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movapd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x28), dst, src);
+		}
+
+		/* Store packed doubles of src into 16 bytes aligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movapd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x29), src, dst);
+		}
+
+		/* Move packed doubles from src (XMM register or unaligned mem) into dst */
+		template<class T, class BLOCK>
+		constexpr static auto Movupd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x10), dst, src);
+		}
+
+		/* Store packed doubles of src into unaligned mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movupd(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x11), src, dst);
+		}
+
+		/* Move doubleword from src (Reg32 or mem) into low doubleword of dst and zero upper */
+		template<class T, class BLOCK>
+		constexpr static auto Movd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x6E), dst, src);
+		}
+
+		/* Move low doubleword of src into dst (Reg32 or mem) */
+		template<class T, class BLOCK>
+		constexpr static auto Movd(BLOCK& block, const T& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x7E), src, dst);
+		}
+
+		/* Move quadword from src (XMM register or mem) into low quadword of dst and zero upper */
+		template<class T, class BLOCK>
+		constexpr static auto Movq(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x7E), dst, src);
+		}
+
+		/* Store low quadword of src into mem */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static auto Movq(BLOCK& block, const Mem32<MODE>& dst, RegXMM src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xD6), src, dst);
+		}
+
+		/* Add scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Addsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Subsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Mulsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Divsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Sqrtsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of scalar doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Minsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of scalar doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Maxsd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Add packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Addpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x58), dst, src);
+		}
+
+		/* Subtract packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Subpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5C), dst, src);
+		}
+
+		/* Multiply packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Mulpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x59), dst, src);
+		}
+
+		/* Divide packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Divpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5E), dst, src);
+		}
+
+		/* Square root of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Sqrtpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x51), dst, src);
+		}
+
+		/* Minimum of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Minpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5D), dst, src);
+		}
+
+		/* Maximum of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Maxpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x5F), dst, src);
+		}
+
+		/* Bitwise AND of packed doubles (e.g. absolute value with sign mask) */
+		template<class T, class BLOCK>
+		constexpr static auto Andpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x54), dst, src);
+		}
+
+		/* Bitwise AND of inverted dst and src packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Andnpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x55), dst, src);
+		}
+
+		/* Bitwise OR of packed doubles */
+		template<class T, class BLOCK>
+		constexpr static auto Orpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x56), dst, src);
+		}
+
+		/* Bitwise XOR of packed doubles (e.g. negation with sign mask or zeroing) */
+		template<class T, class BLOCK>
+		constexpr static auto Xorpd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x57), dst, src);
+		}
+
+		/* Compare scalar doubles by predicate imm, result is all ones or zero mask */
+		template<class T, class BLOCK>
+		constexpr static auto Cmpsd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Compare packed doubles by predicate imm, results are all ones or zero masks */
+		template<class T, class BLOCK>
+		constexpr static auto Cmppd(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xC2), dst, src, imm);
+		}
+
+		/* Unordered compare scalar doubles and set ZF, PF, CF (PF == 1 if unordered) */
+		template<class T, class BLOCK>
+		constexpr static auto Ucomisd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x2E), dst, src);
+		}
+
+		/* Ordered compare scalar doubles and set ZF, PF, CF, signal invalid operation on QNaN */
+		template<class T, class BLOCK>
+		constexpr static auto Comisd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0x2F), dst, src);
+		}
+
+		/* Convert signed integer src to scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtsi2sd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2A), dst, src);
+		}
+
+		/* Convert scalar double src to signed integer using MXCSR rounding mode */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtsd2si(BLOCK& block, Reg32 dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2D), dst, src);
+		}
+
+		/* Convert scalar double src to signed integer with truncation */
+		template<class T, class BLOCK>
+		constexpr static auto Cvttsd2si(BLOCK& block, Reg32 dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x2C), dst, src);
+		}
+
+		/* Convert scalar float src to scalar double */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtss2sd(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0x5A), dst, src);
+		}
+
+		/* Convert scalar double src to scalar float */
+		template<class T, class BLOCK>
+		constexpr static auto Cvtsd2ss(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0x5A), dst, src);
+		}
+	};
+}
\ No newline at end of file
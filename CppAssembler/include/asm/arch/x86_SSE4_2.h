@@ -0,0 +1,39 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class SSE4_2 : private SIMD {
+	public:
+		/* Compare strings dst and src with explicit lengths in EAX and EDX by mode imm, index of result into ECX */
+		template<class T, class BLOCK>
+		constexpr static auto Pcmpestri(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x61), dst, src, imm);
+		}
+
+		/* Compare strings dst and src with explicit lengths in EAX and EDX by mode imm, mask of result into XMM0 */
+		template<class T, class BLOCK>
+		constexpr static auto Pcmpestrm(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x60), dst, src, imm);
+		}
+
+		/* Compare null terminated strings dst and src by mode imm, index of result into ECX */
+		template<class T, class BLOCK>
+		constexpr static auto Pcmpistri(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x63), dst, src, imm);
+		}
+
+		/* Compare null terminated strings dst and src by mode imm, mask of result into XMM0 */
+		template<class T, class BLOCK>
+		constexpr static auto Pcmpistrm(BLOCK& block, RegXMM dst, const T& src, U8 imm) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F3A, 0x62), dst, src, imm);
+		}
+
+		/* Compare packed signed quadwords for greater than */
+		template<class T, class BLOCK>
+		constexpr static auto Pcmpgtq(BLOCK& block, RegXMM dst, const T& src) {
+			return template_simd(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F38, 0x37), dst, src);
+		}
+	};
+}
\ No newline at end of file
@@ -7,9 +7,20 @@ namespace CppAsm::X86
 	class TSC : public i386 {
 	public:
 		template<class BLOCK>
-		static void Rdtsc(BLOCK& block) {
+		constexpr static void Rdtsc(BLOCK& block) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0x31);
 		}
+
+		/* Read time-stamp counter after all previous instructions completed locally (LFENCE; RDTSC),
+		 * LFENCE requires SSE2
+		 */
+		template<class BLOCK>
+		constexpr static void LfenceRdtsc(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, 0b101, 0b000);
+			Rdtsc(block);
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	/* Common encoding of VEX instructions with general purpose registers,
+	 * register encoded in VEX.vvvv is stored inverted, so it is not replaceable
+	 */
+	class VEX {
+	protected:
+		template<class BLOCK>
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg32>> template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, Reg32 vvvv, Reg32 rm) {
+			common::write_VEX_Opcode(block, opcode, 0, false, vvvv);
+			Offset offset = block.getOffset();
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, rm);
+			return std::make_pair(ReplaceableReg<Reg32>(offset, common::MOD_REG_RM::REG_BIT_OFFSET),
+				ReplaceableReg<Reg32>(offset, common::MOD_REG_RM::RM_BIT_OFFSET));
+		}
+
+		template<AddressMode MODE, class BLOCK>
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableMem32<MODE>> template_vex_gpr(BLOCK& block, const common::VexOpcode& opcode, uint8_t reg, Reg32 vvvv, const Mem32<MODE>& rm) {
+			rm.writeSegmPrefix(block);
+			common::write_VEX_Opcode(block, opcode, 0, false, vvvv);
+			auto replaceMem = rm.write(block, reg);
+			return std::make_pair(replaceMem.template getOtherReg<Reg32>(), replaceMem);
+		}
+	};
+}
\ No newline at end of file
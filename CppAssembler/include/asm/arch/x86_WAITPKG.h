@@ -0,0 +1,31 @@
+#pragma once
+
+#include "x86_SIMD.h"
+
+namespace CppAsm::X86
+{
+	class WAITPKG : private SIMD {
+	public:
+		/* Arm address monitoring of cache line containing address in register */
+		template<class BLOCK>
+		constexpr static auto Umonitor(BLOCK& block, Reg32 addr) {
+			return template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_F3, common::SIMD_MAP_0F, 0xAE), 0b110, addr);
+		}
+
+		/* Wait in power state selected by bit 0 of ctrl until write to monitored address
+		 * or time-stamp counter reaches EDX:EAX, CF is set if deadline expired
+		 */
+		template<class BLOCK>
+		constexpr static auto Umwait(BLOCK& block, Reg32 ctrl) {
+			return template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_F2, common::SIMD_MAP_0F, 0xAE), 0b110, ctrl);
+		}
+
+		/* Wait in power state selected by bit 0 of ctrl until time-stamp counter reaches EDX:EAX,
+		 * CF is set if deadline expired
+		 */
+		template<class BLOCK>
+		constexpr static auto Tpause(BLOCK& block, Reg32 ctrl) {
+			return template_simd_ext(block, common::SimdOpcode(common::SIMD_PREFIX_66, common::SIMD_MAP_0F, 0xAE), 0b110, ctrl);
+		}
+	};
+}
\ No newline at end of file
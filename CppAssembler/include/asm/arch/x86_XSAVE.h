@@ -0,0 +1,35 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	class XSAVE : private i386 {
+	public:
+		/* Save processor extended states selected by EDX:EAX and XCR0 into mem (64 bytes aligned) */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Xsave(BLOCK& block, const Mem32<MODE>& mem) {
+			mem.writeSegmPrefix(block);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			mem.write(block, 0b100);
+		}
+
+		/* Restore processor extended states selected by EDX:EAX and XCR0 from mem (64 bytes aligned) */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Xrstor(BLOCK& block, const Mem32<MODE>& mem) {
+			mem.writeSegmPrefix(block);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xAE);
+			mem.write(block, 0b101);
+		}
+
+		/* Read extended control register specified by ECX (XCR0 enabled states) into EDX:EAX */
+		template<class BLOCK>
+		constexpr static void Xgetbv(BLOCK& block) {
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0x01);
+			common::write_Opcode(block, 0xD0);
+		}
+	};
+}
\ No newline at end of file
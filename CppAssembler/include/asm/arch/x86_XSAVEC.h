@@ -0,0 +1,18 @@
+#pragma once
+
+#include "x86_i386.h"
+
+namespace CppAsm::X86
+{
+	class XSAVEC : private i386 {
+	public:
+		/* Save processor extended states selected by EDX:EAX into mem (64 bytes aligned) using compacted format */
+		template<AddressMode MODE, class BLOCK>
+		constexpr static void Xsavec(BLOCK& block, const Mem32<MODE>& mem) {
+			mem.writeSegmPrefix(block);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, 0xC7);
+			mem.write(block, 0b100);
+		}
+	};
+}
\ No newline at end of file
@@ -73,6 +73,17 @@ namespace CppAsm::X86
 		CR4
 	};
 
+	enum RegXMM : uint8_t {
+		XMM0 = 0b000,
+		XMM1 = 0b001,
+		XMM2 = 0b010,
+		XMM3 = 0b011,
+		XMM4 = 0b100,
+		XMM5 = 0b101,
+		XMM6 = 0b110,
+		XMM7 = 0b111
+	};
+
 	enum IndexScale : uint8_t {
 		SCALE_1 = 0b00,
 		SCALE_2 = 0b01,
@@ -213,7 +224,7 @@ namespace CppAsm::X86
 				return mCustomSegReg;
 			}
 			template<class BLOCK>
-			void writeSegmPrefix(BLOCK& block) const {
+			constexpr void writeSegmPrefix(BLOCK& block) const {
 				block.writeRaw(mSegReg);
 				block.skipBytes(mCustomSegReg ? sizeof(mSegReg) : 0);
 			}
@@ -251,13 +262,13 @@ namespace CppAsm::X86
 			}
 
 			template<class BLOCK>
-			void writeSmallestOffset(BLOCK& block) const {
+			constexpr void writeSmallestOffset(BLOCK& block) const {
 				block.writeRaw(mOffset);
 				block.skipBytes(mOptimalBytes);
 			}
 
 			template<class BLOCK>
-			void writeOffset(BLOCK& block) const {
+			constexpr void writeOffset(BLOCK& block) const {
 				block.pushRaw(mOffset);
 			}
 		};
@@ -281,8 +292,8 @@ namespace CppAsm::X86
 			}
 
 			template<class BLOCK>
-			void writeEspPostfix(BLOCK& block) const {
-				block.writeRaw<uint8_t>(0x24);
+			constexpr void writeEspPostfix(BLOCK& block) const {
+				block.template writeRaw<uint8_t>(0x24);
 				block.skipBytes(mEspBase ? sizeof(uint8_t) : 0);
 			}
 		};
@@ -453,6 +464,11 @@ namespace CppAsm::X86
 		constexpr static Reg8 value = Reg8(0b111);
 	};
 
+	template<>
+	struct TypeBitsMask<RegXMM> {
+		constexpr static RegXMM value = RegXMM(0b111);
+	};
+
 	template<>
 	struct TypeBitsMask<IndexScale> {
 		constexpr static IndexScale value = IndexScale(0b11);
@@ -492,9 +508,10 @@ namespace CppAsm::X86
 	public:
 		explicit constexpr Mem32(int32_t offset) : MOD_REG_OFFSET(REG_IND_ADDR), Mem32_Offset(offset), Mem32_Seg() {}
 		constexpr Mem32(RegSeg segReg, int32_t offset) : MOD_REG_OFFSET(REG_IND_ADDR), Mem32_Offset(offset), Mem32_Seg(segReg) {}
+		explicit Mem32(Addr address) : Mem32(static_cast<int32_t>(reinterpret_cast<uintptr_t>(address))) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<OFFSET> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<OFFSET> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeOffset(block);
@@ -531,7 +548,7 @@ namespace CppAsm::X86
 		constexpr Mem32(RegSeg segReg, Reg32 baseReg) : MOD_REG_RM(REG_IND_ADDR, baseReg), Mem32_Base(baseReg), Mem32_Seg(segReg, baseReg) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<BASE> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<BASE> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
@@ -581,7 +598,7 @@ namespace CppAsm::X86
 		constexpr Mem32(RegSeg segReg, Reg32 baseReg, int32_t offset) : Mem32_Base(baseReg), Mem32_Offset(offset), MOD_REG_RM(getDispMod(), baseReg), Mem32_Seg(segReg, baseReg) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<BASE_OFFSET> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<BASE_OFFSET> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeEspPostfix(block);
@@ -630,7 +647,7 @@ namespace CppAsm::X86
 		constexpr Mem32(RegSeg segReg, Reg32 indexReg, IndexScale indexScale, int32_t offset) : MOD_REG_INDEX(SIB_NO_DISP), Mem32_SIB(indexScale, indexReg), Mem32_Offset(offset), Mem32_Seg(segReg) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<INDEX_OFFSET> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<INDEX_OFFSET> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
@@ -652,13 +669,13 @@ namespace CppAsm::X86
 		template<class REG>
 		constexpr ReplaceableReg<REG> getBaseReg() const {
 			// +1 skip MOD_REG_RM byte
-			return ReplaceableReg<REG>(getCbOffset() + 1, common::Mem32_SIB::BASE_BIT_OFFSET);
+			return ReplaceableReg<REG>(getCbOffset() + 1, detail::Mem32_SIB::BASE_BIT_OFFSET);
 		}
 
 		template<class REG>
 		constexpr ReplaceableReg<REG> getIndexReg() const {
 			// +1 skip MOD_REG_RM byte
-			return ReplaceableReg<REG>(getCbOffset() + 1, common::Mem32_SIB::INDEX_BIT_OFFSET);
+			return ReplaceableReg<REG>(getCbOffset() + 1, detail::Mem32_SIB::INDEX_BIT_OFFSET);
 		}
 
 		constexpr ReplaceableIndexScale getIndexScale() const {
@@ -676,7 +693,7 @@ namespace CppAsm::X86
 		constexpr Mem32(RegSeg segReg, Reg32 baseReg, Reg32 indexReg, IndexScale indexScale) : MOD_REG_INDEX(SIB_NO_DISP), Mem32_SIB(indexScale, indexReg, baseReg), Mem32_Seg(segReg, baseReg) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<BASE_INDEX> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<BASE_INDEX> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
@@ -737,7 +754,7 @@ namespace CppAsm::X86
 		constexpr Mem32(RegSeg segReg, Reg32 baseReg, Reg32 indexReg, IndexScale indexScale, int32_t offset) : Mem32_SIB(indexScale, indexReg, baseReg), Mem32_Offset(offset), MOD_REG_INDEX(getDispMod()), Mem32_Seg(segReg, baseReg) {}
 
 		template<class BLOCK>
-		ReplaceableMem32<BASE_INDEX_OFFSET> write(BLOCK& block, uint8_t reg) const {
+		constexpr ReplaceableMem32<BASE_INDEX_OFFSET> write(BLOCK& block, uint8_t reg) const {
 			Offset offset = block.getOffset();
 			writeMOD_REG_RM(block, reg);
 			writeSIB(block);
@@ -770,20 +787,20 @@ namespace CppAsm::X86
 	public:
 		using Replaceable::Replaceable;
 
-		typedef Addr offset_type;
+		typedef int32_t offset_type;
 		static const int offset_size = sizeof(offset_type);
 
 		template<class BLOCK>
-		bool bind(BLOCK& block, Addr newAddr) const {
+		constexpr bool bind(BLOCK& block, Addr newAddr) const {
 			Offset labelOffset = getCbOffset();
 			auto jumpOffset = common::calc_Jump_Offset(block.getStartPtr() + labelOffset,
 				newAddr, offset_size);
-			block.writeRaw(reinterpret_cast<offset_type>(jumpOffset), labelOffset);
+			block.writeRaw(static_cast<offset_type>(jumpOffset), labelOffset);
 			return true;
 		}
 
 		template<class BLOCK>
-		bool bind(BLOCK& block) const {
+		constexpr bool bind(BLOCK& block) const {
 			return bind(block, block.getCurrentPtr());
 		}
 	};
@@ -797,7 +814,7 @@ namespace CppAsm::X86
 		static const int offset_size = sizeof(offset_type);
 
 		template<class BLOCK>
-		bool bind(BLOCK& block, Addr newAddr) const {
+		constexpr bool bind(BLOCK& block, Addr newAddr) const {
 			Offset labelOffset = getCbOffset();
 			auto jumpOffset = common::calc_Jump_Offset(block.getStartPtr() + labelOffset,
 				newAddr, offset_size);
@@ -809,7 +826,7 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		bool bind(BLOCK& block) const {
+		constexpr bool bind(BLOCK& block) const {
 			return bind(block, block.getCurrentPtr());
 		}
 	};
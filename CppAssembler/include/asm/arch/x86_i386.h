@@ -22,8 +22,8 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static void write_Operand_Segm_Prefix(BLOCK& block, RegSeg segm) {
-			block.pushRaw<uint8_t>(segm);
+		constexpr static void write_Operand_Segm_Prefix(BLOCK& block, RegSeg segm) {
+			block.template pushRaw<uint8_t>(segm);
 		}
 
 		template<MemSize SIZE, class BLOCK>
@@ -32,26 +32,26 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeWriter<BYTE_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | (rmMode << 1));
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeExtended(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeExtended(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode);
@@ -61,21 +61,21 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeWriter<WORD_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b1);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
@@ -83,7 +83,7 @@ namespace CppAsm::X86
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeExtended(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeExtended(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
@@ -94,26 +94,26 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeWriter<DWORD_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b1);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | (rmMode << 1) | 0b1);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeOnlyExtendedPrefixs(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode);
 			}
 
 			template<LockPrefix L = NO_LOCK>
-			static void writeExtended(BLOCK& block, common::Opcode opcode) {
+			constexpr static void writeExtended(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode | 0b1);
@@ -121,28 +121,28 @@ namespace CppAsm::X86
 		};
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, class BLOCK>
-		static void write_Opcode(BLOCK& block, common::Opcode opcode) {
-			OpcodeWriter<SIZE, BLOCK>::write<L>(block, opcode);
+		constexpr static void write_Opcode(BLOCK& block, common::Opcode opcode) {
+			OpcodeWriter<SIZE, BLOCK>::template write<L>(block, opcode);
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, class BLOCK>
-		static void write_Opcode(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
-			OpcodeWriter<SIZE, BLOCK>::write<L>(block, opcode, rmMode);
+		constexpr static void write_Opcode(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
+			OpcodeWriter<SIZE, BLOCK>::template write<L>(block, opcode, rmMode);
 		}
 
 		template<class BLOCK>
-		static void write_Opcode_Only_RM_Mode(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
+		constexpr static void write_Opcode_Only_RM_Mode(BLOCK& block, common::Opcode opcode, OpMode rmMode) {
 			common::write_Opcode(block, opcode | (rmMode << 1));
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, class BLOCK>
-		static void write_Opcode_Only_Extended_Prefixs(BLOCK& block, common::Opcode opcode) {
-			OpcodeWriter<SIZE, BLOCK>::writeOnlyExtendedPrefixs<L>(block, opcode);
+		constexpr static void write_Opcode_Only_Extended_Prefixs(BLOCK& block, common::Opcode opcode) {
+			OpcodeWriter<SIZE, BLOCK>::template writeOnlyExtendedPrefixs<L>(block, opcode);
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, class BLOCK>
-		static void write_Opcode_Extended(BLOCK& block, common::Opcode opcode) {
-			OpcodeWriter<SIZE, BLOCK>::writeExtended<L>(block, opcode);
+		constexpr static void write_Opcode_Extended(BLOCK& block, common::Opcode opcode) {
+			OpcodeWriter<SIZE, BLOCK>::template writeExtended<L>(block, opcode);
 		}
 
 		template<MemSize SIZE, MemSize OPT_SIZE, class BLOCK>
@@ -151,7 +151,7 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<BYTE_PTR, BYTE_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode);
 			}
@@ -160,7 +160,7 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<WORD_PTR, WORD_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b1);
@@ -170,7 +170,7 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<WORD_PTR, BYTE_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_16bit_Prefix(block);
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b11);
@@ -180,7 +180,7 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<DWORD_PTR, DWORD_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b1);
 			}
@@ -189,7 +189,7 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<DWORD_PTR, WORD_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b1);
 			}
@@ -198,36 +198,36 @@ namespace CppAsm::X86
 		template<class BLOCK>
 		struct OpcodeImmOptimizedWriter<DWORD_PTR, BYTE_PTR, BLOCK> {
 			template<LockPrefix L = NO_LOCK>
-			static void write(BLOCK& block, common::Opcode opcode) {
+			constexpr static void write(BLOCK& block, common::Opcode opcode) {
 				common::write_Lock_Prefix<L>(block);
 				common::write_Opcode(block, opcode | 0b11);
 			}
 		};
 
 		template<MemSize SIZE, MemSize OPT_SIZE, LockPrefix L = NO_LOCK, class BLOCK>
-		static void write_Opcode_Imm_Optimized(BLOCK& block, common::Opcode opcode) {
-			OpcodeImmOptimizedWriter<SIZE, OPT_SIZE, BLOCK>::write<L>(block, opcode);
+		constexpr static void write_Opcode_Imm_Optimized(BLOCK& block, common::Opcode opcode) {
+			OpcodeImmOptimizedWriter<SIZE, OPT_SIZE, BLOCK>::template write<L>(block, opcode);
 		}
 
 		template<MemSize SIZE, class T, class BLOCK>
-		static void write_Imm_Size_Extend(BLOCK& block, const Imm<T>& imm) {
-			block.pushRaw(static_cast<detail::ImmSizeExtend<SIZE, T>::type>(imm));
+		constexpr static void write_Imm_Size_Extend(BLOCK& block, const Imm<T>& imm) {
+			block.pushRaw(static_cast<typename detail::ImmSizeExtend<SIZE, T>::type>(imm));
 		}
 
 		template<MemSize SIZE, class T, class BLOCK>
-		static void write_Imm_Size_Optimize(BLOCK& block, const Imm<T>& imm) {
-			block.pushRaw(static_cast<detail::ImmSizeOptimize<SIZE, T>::type>(imm));
+		constexpr static void write_Imm_Size_Optimize(BLOCK& block, const Imm<T>& imm) {
+			block.pushRaw(static_cast<typename detail::ImmSizeOptimize<SIZE, T>::type>(imm));
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_1mem_operand(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_1mem_operand(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			write_Opcode<SIZE, L>(block, opcode.getOpcode());
 			return mem.write(block, opcode.getMode());
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_1mem_ext_operand(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_1mem_ext_operand(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			write_Opcode_Only_Extended_Prefixs<SIZE>(block, opcode.getOpcode());
 			return mem.write(block, opcode.getMode());
@@ -238,14 +238,14 @@ namespace CppAsm::X86
 
 		template<class BLOCK>
 		struct Instruction1RegWriter<Reg8, BLOCK> {
-			static ReplaceableReg<Reg8> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg8 reg) {
+			constexpr static ReplaceableReg<Reg8> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg8 reg) {
 				write_Opcode<BYTE_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
 				return ReplaceableReg<Reg8>(offset, common::MOD_REG_RM::RM_BIT_OFFSET);
 			}
 
-			static ReplaceableReg<Reg8> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg8 reg) {
+			constexpr static ReplaceableReg<Reg8> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg8 reg) {
 				write_Opcode_Only_Extended_Prefixs<BYTE_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
@@ -255,14 +255,14 @@ namespace CppAsm::X86
 
 		template<class BLOCK>
 		struct Instruction1RegWriter<Reg16, BLOCK> {
-			static ReplaceableReg<Reg16> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg16 reg) {
+			constexpr static ReplaceableReg<Reg16> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg16 reg) {
 				write_Opcode<WORD_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
 				return ReplaceableReg<Reg16>(offset, common::MOD_REG_RM::RM_BIT_OFFSET);
 			}
 
-			static ReplaceableReg<Reg16> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg16 reg) {
+			constexpr static ReplaceableReg<Reg16> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg16 reg) {
 				write_Opcode_Only_Extended_Prefixs<WORD_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
@@ -272,14 +272,14 @@ namespace CppAsm::X86
 
 		template<class BLOCK>
 		struct Instruction1RegWriter<Reg32, BLOCK> {
-			static ReplaceableReg<Reg32> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg32 reg) {
+			constexpr static ReplaceableReg<Reg32> write(BLOCK& block, const detail::OpcodeLarge& opcode, Reg32 reg) {
 				write_Opcode<DWORD_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
 				return ReplaceableReg<Reg32>(offset, common::MOD_REG_RM::RM_BIT_OFFSET);
 			}
 
-			static ReplaceableReg<Reg32> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg32 reg) {
+			constexpr static ReplaceableReg<Reg32> writeExtended(BLOCK& block, const detail::OpcodeLarge& opcode, Reg32 reg) {
 				write_Opcode_Only_Extended_Prefixs<DWORD_PTR>(block, opcode.getOpcode());
 				Offset offset = block.getOffset();
 				common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
@@ -288,17 +288,17 @@ namespace CppAsm::X86
 		};
 
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> template_1reg_operand(BLOCK& block, const detail::OpcodeLarge& opcode, REG reg) {
+		constexpr static ReplaceableReg<REG> template_1reg_operand(BLOCK& block, const detail::OpcodeLarge& opcode, REG reg) {
 			return Instruction1RegWriter<REG, BLOCK>::write(block, opcode, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> template_1reg_ext_operand(BLOCK& block, const detail::OpcodeLarge& opcode, REG reg) {
+		constexpr static ReplaceableReg<REG> template_1reg_ext_operand(BLOCK& block, const detail::OpcodeLarge& opcode, REG reg) {
 			return Instruction1RegWriter<REG, BLOCK>::writeExtended(block, opcode, reg);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableExtendedImm<SIZE, T>> template_mem_imm_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableExtendedImm<SIZE, T>> template_mem_imm_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			mem.writeSegmPrefix(block);
 			write_Opcode<SIZE>(block, opcodeSet.getSecond().getOpcode());
 			auto replaceMem = mem.write(block, opcodeSet.getSecond().getMode());
@@ -308,7 +308,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, LockPrefix L, AddressMode MODE, class T, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableOptimizedImm<SIZE, T>> template_mem_imm_opt_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableOptimizedImm<SIZE, T>> template_mem_imm_opt_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			mem.writeSegmPrefix(block);
 			write_Opcode_Imm_Optimized<SIZE, TypeMemSize<Imm<T>>::value, L>(block, opcodeSet.getSecond().getOpcode());
 			auto replaceMem = mem.write(block, opcodeSet.getSecond().getMode());
@@ -318,7 +318,7 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, class T, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableOptimizedImm<TypeMemSize<REG>::value, T>> template_reg_imm_opt_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const REG& reg, const Imm<T>& imm) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableOptimizedImm<TypeMemSize<REG>::value, T>> template_reg_imm_opt_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const REG& reg, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "i386: First param must be register");
 			write_Opcode_Imm_Optimized<TypeMemSize<REG>::value, TypeMemSize<Imm<T>>::value>(block, opcodeSet.getSecond().getOpcode());
 			Offset modOffset = block.getOffset();
@@ -330,7 +330,7 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, class T, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableExtendedImm<TypeMemSize<REG>::value, T>> template_reg_imm_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const REG& reg, const Imm<T>& imm) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableExtendedImm<TypeMemSize<REG>::value, T>> template_reg_imm_operands(BLOCK& block, const detail::OpcodeSet& opcodeSet, const REG& reg, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "i386: First param must be register");
 			write_Opcode<TypeMemSize<REG>::value>(block, opcodeSet.getSecond().getOpcode());
 			Offset regOffset = block.getOffset();
@@ -342,14 +342,14 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			write_Opcode<SIZE>(block, opcode.getOpcode() | 0x10);
 			return mem.write(block, opcode.getMode());
 		}
 
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg) {
+		constexpr static ReplaceableReg<REG> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg) {
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode.getOpcode() | 0x10);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
@@ -357,7 +357,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem) {
 			static_assert(SH_REG == CL, "i386: Invalid register for shift operation");
 			mem.writeSegmPrefix(block);
 			write_Opcode<SIZE>(block, opcode.getOpcode() | 0x12);
@@ -365,7 +365,7 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, Reg8 SH_REG, class BLOCK>
-		static ReplaceableReg<REG> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg) {
+		constexpr static ReplaceableReg<REG> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg) {
 			static_assert(SH_REG == CL, "i386: Invalid register for shift operation");
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode.getOpcode() | 0x12);
 			Offset offset = block.getOffset();
@@ -374,7 +374,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableValue<U8::type>> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableValue<U8::type>> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const Mem32<MODE>& mem, const U8& imm) {
 			mem.writeSegmPrefix(block);
 			write_Opcode<SIZE>(block, opcode.getOpcode());
 			auto replaceMem = mem.write(block, opcode.getMode());
@@ -384,7 +384,7 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg, const U8& imm) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_shift_operands(BLOCK& block, const detail::OpcodeLarge& opcode, const REG& reg, const U8& imm) {
 			write_Opcode<TypeMemSize<REG>::value>(block, opcode.getOpcode());
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, opcode.getMode(), reg);
@@ -394,18 +394,18 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, Reg8 COUNT_REG = CL, AddressMode MODE, class REG, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<REG>> template_prshift_operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem, REG reg) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<REG>> template_prshift_operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem, REG reg) {
 			static_assert(IsRegType<REG>::value, "i386: Param must be register");
 			static_assert(COUNT_REG == CL, "i386: Invalid register for precision shift operation");
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "i386: Invalid precision shift size prefix");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Only_Extended_Prefixs<SIZE>(block, opcode | 0x01);
 			auto replaceMem = mem.write(block, reg);
-			return std::make_pair(replaceMem, replaceMem.getOtherReg<REG>());
+			return std::make_pair(replaceMem, replaceMem.template getOtherReg<REG>());
 		}
 
 		template<Reg8 COUNT_REG = CL, class REG, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_prshift_operands(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_prshift_operands(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "i386: Param must be register");
 			static_assert(COUNT_REG == CL, "i386: Invalid register for precision shift operation");
 			static_assert(TypeMemSize<REG>::value == WORD_PTR || TypeMemSize<REG>::value == DWORD_PTR, "i386: Invalid precision shift size prefix");
@@ -417,7 +417,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class REG, class BLOCK>
-		static std::tuple<ReplaceableMem32<MODE>, ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_prshift_operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem, REG reg, const U8& imm) {
+		constexpr static std::tuple<ReplaceableMem32<MODE>, ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_prshift_operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem, REG reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "i386: Param must be register");
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "i386: Invalid precision shift size prefix");
 			mem.writeSegmPrefix(block);
@@ -425,11 +425,11 @@ namespace CppAsm::X86
 			auto replaceMem = mem.write(block, reg);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, imm);
-			return std::make_tuple(replaceMem, replaceMem.getOtherReg<REG>(), ReplaceableValue<U8::type>(offset));
+			return std::make_tuple(replaceMem, replaceMem.template getOtherReg<REG>(), ReplaceableValue<U8::type>(offset));
 		}
 
 		template<class REG, class BLOCK>
-		static std::tuple<ReplaceableReg<REG>, ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_prshift_operands(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2, const U8& imm) {
+		constexpr static std::tuple<ReplaceableReg<REG>, ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_prshift_operands(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "i386: Param must be register");
 			static_assert(TypeMemSize<REG>::value == WORD_PTR || TypeMemSize<REG>::value == DWORD_PTR, "Invalid precision shift size prefix");
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode);
@@ -442,7 +442,7 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, class BLOCK>
-		static std::pair<ReplaceableReg<Reg8>, ReplaceableReg<Reg8>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Reg8& src) {
+		constexpr static std::pair<ReplaceableReg<Reg8>, ReplaceableReg<Reg8>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Reg8& src) {
 			write_Opcode<BYTE_PTR>(block, opcode, MODE_RR);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -451,23 +451,23 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<Reg8>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Mem32<MODE>& src) {
+		constexpr static std::pair<ReplaceableReg<Reg8>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Mem32<MODE>& src) {
 			src.writeSegmPrefix(block);
 			write_Opcode<BYTE_PTR>(block, opcode, MODE_RM);
 			auto replaceMem = src.write(block, dst);
-			return std::make_pair(replaceMem.getOtherReg<Reg8>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<Reg8>(), replaceMem);
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg8>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg8& src) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg8>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg8& src) {
 			dst.writeSegmPrefix(block);
 			write_Opcode<BYTE_PTR, L>(block, opcode, MODE_MR);
 			auto replaceMem = dst.write(block, src);
-			return std::make_pair(replaceMem, replaceMem.getOtherReg<Reg8>());
+			return std::make_pair(replaceMem, replaceMem.template getOtherReg<Reg8>());
 		}
 
 		template<LockPrefix L = NO_LOCK, class BLOCK>
-		static std::pair<ReplaceableReg<Reg16>, ReplaceableReg<Reg16>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg16& src) {
+		constexpr static std::pair<ReplaceableReg<Reg16>, ReplaceableReg<Reg16>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg16& src) {
 			write_Opcode<WORD_PTR>(block, opcode, MODE_RR);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -476,23 +476,23 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<Reg16>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Mem32<MODE>& src) {
+		constexpr static std::pair<ReplaceableReg<Reg16>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Mem32<MODE>& src) {
 			src.writeSegmPrefix(block);
 			write_Opcode<WORD_PTR>(block, opcode, MODE_RM);
 			auto replaceMem = src.write(block, dst);
-			return std::make_pair(replaceMem.getOtherReg<Reg16>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<Reg16>(), replaceMem);
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg16>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg16& src) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg16>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg16& src) {
 			dst.writeSegmPrefix(block);
 			write_Opcode<WORD_PTR, L>(block, opcode, MODE_MR);
 			auto replaceMem = dst.write(block, src);
-			return std::make_pair(replaceMem, replaceMem.getOtherReg<Reg16>());
+			return std::make_pair(replaceMem, replaceMem.template getOtherReg<Reg16>());
 		}
 
 		template<LockPrefix L = NO_LOCK, class BLOCK>
-		static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg32>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg32& src) {
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg32>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg32& src) {
 			write_Opcode<DWORD_PTR>(block, opcode, MODE_RR);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -501,19 +501,19 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<Reg32>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Mem32<MODE>& src) {
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableMem32<MODE>> template_2operands(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Mem32<MODE>& src) {
 			src.writeSegmPrefix(block);
 			write_Opcode<DWORD_PTR>(block, opcode, MODE_RM);
 			auto replaceMem = src.write(block, dst);
-			return std::make_pair(replaceMem.getOtherReg<Reg32>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<Reg32>(), replaceMem);
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg32>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg32& src) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<Reg32>> template_2operands(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg32& src) {
 			dst.writeSegmPrefix(block);
 			write_Opcode<DWORD_PTR, L>(block, opcode, MODE_MR);
 			auto replaceMem = dst.write(block, src);
-			return std::make_pair(replaceMem, replaceMem.getOtherReg<Reg32>());
+			return std::make_pair(replaceMem, replaceMem.template getOtherReg<Reg32>());
 		}
 
 		static uint8_t getSegmentRegIndex(RegSeg sreg) {
@@ -535,91 +535,91 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const Reg16& dst, const RegSeg& src) {
+		constexpr static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const Reg16& dst, const RegSeg& src) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, opcode);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, getSegmentRegIndex(src), dst);
 		}
 
 		template<class BLOCK>
-		static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const RegSeg& dst, const Reg16& src) {
+		constexpr static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const RegSeg& dst, const Reg16& src) {
 			write_Opcode_Only_RM_Mode(block, opcode, MODE_RR);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, getSegmentRegIndex(dst), src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const RegSeg& src) {
+		constexpr static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const RegSeg& src) {
 			dst.writeSegmPrefix(block);
 			write_Opcode_Only_RM_Mode(block, opcode, MODE_MR);
 			dst.write(block, getSegmentRegIndex(src));
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const RegSeg& dst, const Mem32<MODE>& src) {
+		constexpr static void template_2operands_segm(BLOCK& block, common::Opcode opcode, const RegSeg& dst, const Mem32<MODE>& src) {
 			src.writeSegmPrefix(block);
 			write_Opcode_Only_RM_Mode(block, opcode, MODE_RM);
 			src.write(block, getSegmentRegIndex(dst));
 		}
 
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const DST& dst, const SRC& src) {
+		constexpr static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const DST& dst, const SRC& src) {
 			return template_2operands<L>(block, opcodeSet.getMain(), dst, src);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T, class BLOCK>
-		static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg32& dst, const Imm<T>& src) {
+		constexpr static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg32& dst, const Imm<T>& src) {
 			return template_reg_imm_opt_operands(block, opcodeSet, dst, src);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T, class BLOCK>
-		static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg16& dst, const Imm<T>& src) {
+		constexpr static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg16& dst, const Imm<T>& src) {
 			return template_reg_imm_opt_operands(block, opcodeSet, dst, src);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T, class BLOCK>
-		static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg8& dst, const Imm<T>& src) {
+		constexpr static auto template_2operands_opt_imm(BLOCK& block, const detail::OpcodeSet& opcodeSet, const Reg8& dst, const Imm<T>& src) {
 			return template_reg_imm_opt_operands(block, opcodeSet, dst, src);
 		}
 
 		template<MemSize SIZE, class T, class BLOCK>
-		static void template_2operands_first_reg_imm(BLOCK& block, common::Opcode opcode, const Imm<T>& imm) {
+		constexpr static void template_2operands_first_reg_imm(BLOCK& block, common::Opcode opcode, const Imm<T>& imm) {
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "i386: Immediate size not equal output register size");
 			write_Opcode<SIZE>(block, opcode);
 			write_Imm_Size_Extend<SIZE>(block, imm);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg8& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg8& src) {
 			return template_2operands(block, opcode, dst, src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Mem32<MODE>& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg8& dst, const Mem32<MODE>& src) {
 			return template_2operands(block, opcode, src, dst);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg16& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg16& src) {
 			return template_2operands(block, opcode, dst, src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Mem32<MODE>& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Mem32<MODE>& src) {
 			return template_2operands(block, opcode, src, dst);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg32& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& dst, const Reg32& src) {
 			return template_2operands(block, opcode, dst, src);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Mem32<MODE>& src) {
+		constexpr static auto template_2operands_symetric(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Mem32<MODE>& src) {
 			return template_2operands(block, opcode, src, dst);
 		}
 
 		template<class BLOCK>
-		static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg16>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg16& src) {
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg16>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg16& src) {
 			write_Opcode_Extended<TypeMemSize<Reg32>::value>(block, opcode);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -628,7 +628,7 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg8>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg8& src) {
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableReg<Reg8>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& dst, const Reg8& src) {
 			write_Opcode_Extended<TypeMemSize<Reg8>::value>(block, opcode);
 			Offset offset = block.getOffset();
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -637,7 +637,7 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static std::pair<ReplaceableReg<Reg16>, ReplaceableReg<Reg8>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg8& src) {
+		constexpr static std::pair<ReplaceableReg<Reg16>, ReplaceableReg<Reg8>> template_2reg_operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& dst, const Reg8& src) {
 			common::write_Opcode_16bit_Prefix(block);
 			write_Opcode_Extended<TypeMemSize<Reg8>::value>(block, opcode);
 			Offset offset = block.getOffset();
@@ -647,7 +647,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<Reg32>, ReplaceableMem32<MODE>> template_2operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& reg, const Mem32<MODE>& mem) {
+		constexpr static std::pair<ReplaceableReg<Reg32>, ReplaceableMem32<MODE>> template_2operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg32& reg, const Mem32<MODE>& mem) {
 			static_assert(SIZE == BYTE_PTR || SIZE == WORD_PTR, "Invalid extend mem source size");
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
@@ -657,11 +657,11 @@ namespace CppAsm::X86
 				common::write_Opcode(block, opcode);
 			}
 			auto replaceMem = mem.write(block, reg);
-			return std::make_pair(replaceMem.getOtherReg<Reg32>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<Reg32>(), replaceMem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<Reg16>, ReplaceableMem32<MODE>> template_2operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& reg, const Mem32<MODE>& mem) {
+		constexpr static std::pair<ReplaceableReg<Reg16>, ReplaceableMem32<MODE>> template_2operands_extend_val(BLOCK& block, common::Opcode opcode, const Reg16& reg, const Mem32<MODE>& mem) {
 			static_assert(SIZE == BYTE_PTR || SIZE == WORD_PTR, "Invalid extend mem source size");
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
@@ -672,11 +672,11 @@ namespace CppAsm::X86
 				common::write_Opcode(block, opcode);
 			}
 			auto replaceMem = mem.write(block, reg);
-			return std::make_pair(replaceMem.getOtherReg<Reg16>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<Reg16>(), replaceMem);
 		}
 
 		template<class BLOCK>
-		static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg16 reg1, Reg16 reg2) {
+		constexpr static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg16 reg1, Reg16 reg2) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
@@ -684,7 +684,7 @@ namespace CppAsm::X86
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Extended_Prefix(block);
@@ -693,14 +693,14 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg32 reg1, Reg32 reg2) {
+		constexpr static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg32 reg1, Reg32 reg2) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg1, reg2);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_2_operands_ext(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
@@ -708,7 +708,7 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_bit_scan(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_bit_scan(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
 			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode);
@@ -719,17 +719,49 @@ namespace CppAsm::X86
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableMem32<MODE>> template_bit_scan(BLOCK& block, common::Opcode opcode, REG reg, const Mem32<MODE>& mem) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableMem32<MODE>> template_bit_scan(BLOCK& block, common::Opcode opcode, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
 			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode);
 			auto replaceMem = mem.write(block, reg);
-			return std::make_pair(replaceMem.getOtherReg<REG>(), replaceMem);
+			return std::make_pair(replaceMem.template getOtherReg<REG>(), replaceMem);
+		}
+
+		/* Bit count instructions (POPCNT, LZCNT, TZCNT) with mandatory REP prefix */
+		template<MemSize SIZE, class BLOCK>
+		constexpr static void write_Opcode_Bit_Count(BLOCK& block, common::Opcode opcode) {
+			/*constexpr*/ if (SIZE == WORD_PTR) {
+				common::write_Opcode_16bit_Prefix(block);
+			}
+			block.template pushRaw<uint8_t>(REP);
+			common::write_Opcode_Extended_Prefix(block);
+			common::write_Opcode(block, opcode);
+		}
+
+		template<class REG, class BLOCK>
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_bit_count(BLOCK& block, common::Opcode opcode, REG reg1, REG reg2) {
+			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
+			write_Opcode_Bit_Count<TypeMemSize<REG>::value>(block, opcode);
+			Offset offset = block.getOffset();
+			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg1, reg2);
+			return std::make_pair(ReplaceableReg<REG>(offset, common::MOD_REG_RM::REG_BIT_OFFSET),
+				ReplaceableReg<REG>(offset, common::MOD_REG_RM::RM_BIT_OFFSET));
+		}
+
+		template<class REG, AddressMode MODE, class BLOCK>
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableMem32<MODE>> template_bit_count(BLOCK& block, common::Opcode opcode, REG reg, const Mem32<MODE>& mem) {
+			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
+			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
+			mem.writeSegmPrefix(block);
+			write_Opcode_Bit_Count<TypeMemSize<REG>::value>(block, opcode);
+			auto replaceMem = mem.write(block, reg);
+			return std::make_pair(replaceMem.template getOtherReg<REG>(), replaceMem);
 		}
 
 		template<LockPrefix L = NO_LOCK, class REG, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, REG reg1, REG reg2) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableReg<REG>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
 			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode.getMain());
@@ -740,17 +772,17 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<REG>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, const Mem32<MODE>& mem, REG reg) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableReg<REG>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, const Mem32<MODE>& mem, REG reg) {
 			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
 			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value, L>(block, opcode.getMain());
 			auto replaceMem = mem.write(block, reg);
-			return std::make_pair(replaceMem, replaceMem.getOtherReg<REG>());
+			return std::make_pair(replaceMem, replaceMem.template getOtherReg<REG>());
 		}
 
 		template<LockPrefix L = NO_LOCK, class REG, class BLOCK>
-		static std::pair<ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, REG reg, U8 imm) {
+		constexpr static std::pair<ReplaceableReg<REG>, ReplaceableValue<U8::type>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, REG reg, U8 imm) {
 			static_assert(IsRegType<REG>::value, "i386: Invalid type of operand");
 			static_assert(TypeMemSize<REG>::value != BYTE_PTR, "i386: Invalid size of operand");
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, opcode.getSecond().getOpcode());
@@ -762,7 +794,7 @@ namespace CppAsm::X86
 		}
 
 		template<LockPrefix L = NO_LOCK, MemSize SIZE, AddressMode MODE, class BLOCK>
-		static std::pair<ReplaceableMem32<MODE>, ReplaceableValue<U8::type>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, const Mem32<MODE>& mem, U8 imm) {
+		constexpr static std::pair<ReplaceableMem32<MODE>, ReplaceableValue<U8::type>> template_bit_operation(BLOCK& block, const detail::OpcodeSet& opcode, const Mem32<MODE>& mem, U8 imm) {
 			static_assert(SIZE != BYTE_PTR, "i386: Invalid size of operand");
 			write_Opcode_Only_Extended_Prefixs<SIZE, L>(block, opcode.getSecond().getOpcode());
 			auto replaceMem = mem.write(block, opcode.getSecond().getMode());
@@ -772,7 +804,7 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static ReplaceableReg<Reg8> template_Setcc(BLOCK& block, common::Opcode opcode, const Reg8& reg) {
+		constexpr static ReplaceableReg<Reg8> template_Setcc(BLOCK& block, common::Opcode opcode, const Reg8& reg) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
 			Offset offset = block.getOffset();
@@ -781,7 +813,7 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE = BYTE_PTR, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_Setcc(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_Setcc(BLOCK& block, common::Opcode opcode, const Mem32<MODE>& mem) {
 			static_assert(SIZE == BYTE_PTR, "i386: Invalid size of Setcc operand");
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
@@ -794,14 +826,14 @@ namespace CppAsm::X86
 
 		template<class BLOCK>
 		struct JumpWriter<SHORT, BLOCK> {
-			static FwdLabel<SHORT> write(BLOCK& block) {
+			constexpr static FwdLabel<SHORT> write(BLOCK& block) {
 				common::write_Opcode(block, 0xEB);
 				Offset offset = block.getOffset();
 				block.skipBytes(FwdLabel<SHORT>::offset_size);
 				return FwdLabel<SHORT>(offset);
 			}
 
-			static FwdLabel<SHORT> writeConditional(BLOCK& block, common::Opcode opcode) {
+			constexpr static FwdLabel<SHORT> writeConditional(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode(block, opcode);
 				Offset offset = block.getOffset();
 				block.skipBytes(FwdLabel<SHORT>::offset_size);
@@ -811,14 +843,14 @@ namespace CppAsm::X86
 
 		template<class BLOCK>
 		struct JumpWriter<LONG, BLOCK> {
-			static FwdLabel<LONG> write(BLOCK& block) {
+			constexpr static FwdLabel<LONG> write(BLOCK& block) {
 				common::write_Opcode(block, 0xE9);
 				Offset offset = block.getOffset();
 				block.skipBytes(FwdLabel<LONG>::offset_size);
 				return FwdLabel<LONG>(offset);
 			}
 
-			static FwdLabel<LONG> writeConditional(BLOCK& block, common::Opcode opcode) {
+			constexpr static FwdLabel<LONG> writeConditional(BLOCK& block, common::Opcode opcode) {
 				common::write_Opcode_Extended_Prefix(block);
 				common::write_Opcode(block, opcode & 0x0F | 0x80);
 				Offset offset = block.getOffset();
@@ -828,18 +860,18 @@ namespace CppAsm::X86
 		};
 
 		template<JmpSize SIZE, class BLOCK>
-		static FwdLabel<SIZE> template_Jxx(BLOCK& block, common::Opcode opcode) {
+		constexpr static FwdLabel<SIZE> template_Jxx(BLOCK& block, common::Opcode opcode) {
 			return JumpWriter<SIZE, BLOCK>::writeConditional(block, opcode);
 		}
 
 		template<JmpSize SIZE, class BLOCK>
-		static FwdLabel<SIZE> template_Jmp(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> template_Jmp(BLOCK& block) {
 			static_assert(SIZE == SHORT || SIZE == LONG, "Jmp: Invalid jump size");
 			return JumpWriter<SIZE, BLOCK>::write(block);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_Jmp(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_Jmp(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(SIZE == DWORD_PTR || SIZE == FWORD_PTR, "Jmp: Invalid size modifier");
 			/*constexpr*/ if (SIZE == DWORD_PTR) {
 				return template_1mem_operand<DWORD_PTR>(block, detail::opcode_JMP_NEAR, mem);
@@ -848,20 +880,23 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, class BLOCK>
-		static ReplaceableReg<Reg32> template_Jmp(BLOCK& block, const Reg32& reg) {
+		constexpr static ReplaceableReg<Reg32> template_Jmp(BLOCK& block, const Reg32& reg) {
 			static_assert(SIZE == DWORD_PTR, "Jmp: Invalid size modifier");
 			return template_1reg_operand(block, detail::opcode_JMP_NEAR, reg);
 		}
 
 		template<MemSize SIZE, class BLOCK>
-		static void template_Call(BLOCK& block, const Addr& jumpAddress) {
+		constexpr static ReplaceableValue<int32_t> template_Call(BLOCK& block, const Addr& jumpAddress) {
 			static_assert(SIZE == DWORD_PTR, "Call: Invalid size modifier");
 			common::write_Opcode(block, 0xE8);
-			block.pushRaw(common::calc_Jump_Offset(block.getCurrentPtr(), jumpAddress, sizeof(Addr)));
+			Offset offset = block.getOffset();
+			recordRel32(block, jumpAddress);
+			block.pushRaw(static_cast<int32_t>(common::calc_Jump_Offset(block.getCurrentPtr(), jumpAddress, sizeof(int32_t))));
+			return ReplaceableValue<int32_t>(offset);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> template_Call(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> template_Call(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(SIZE == DWORD_PTR || SIZE == FWORD_PTR, "Call: Invalid size modifier");
 			/*constexpr*/ if (SIZE == DWORD_PTR) {
 				return template_1mem_operand<DWORD_PTR>(block, detail::opcode_CALL_NEAR, mem);
@@ -870,13 +905,13 @@ namespace CppAsm::X86
 		}
 
 		template<MemSize SIZE, class BLOCK>
-		static ReplaceableReg<Reg32> template_Call(BLOCK& block, const Reg32& reg) {
+		constexpr static ReplaceableReg<Reg32> template_Call(BLOCK& block, const Reg32& reg) {
 			static_assert(SIZE == DWORD_PTR, "Call: Invalid size modifier");
 			return template_1reg_operand(block, detail::opcode_CALL_NEAR, reg);
 		}
 
 		template<JmpSize SIZE, class BLOCK>
-		static FwdLabel<SIZE> template_Loop(BLOCK& block, common::Opcode opcode) {
+		constexpr static FwdLabel<SIZE> template_Loop(BLOCK& block, common::Opcode opcode) {
 			static_assert(SIZE == SHORT, "i386: unsupported loop jump size");
 			common::write_Opcode(block, opcode);
 			Offset offset = block.getOffset();
@@ -885,14 +920,14 @@ namespace CppAsm::X86
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_LoadSegReg(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_LoadSegReg(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode(block, opcode);
 			mem.write(block, reg);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_LoadSegReg(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_LoadSegReg(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, opcode);
@@ -900,7 +935,7 @@ namespace CppAsm::X86
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_LoadSegRegEx(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_LoadSegRegEx(BLOCK& block, common::Opcode opcode, Reg32 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
@@ -908,7 +943,7 @@ namespace CppAsm::X86
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void template_LoadSegRegEx(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void template_LoadSegRegEx(BLOCK& block, common::Opcode opcode, Reg16 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Extended_Prefix(block);
@@ -917,7 +952,7 @@ namespace CppAsm::X86
 		}
 
 		template<class BLOCK>
-		static void template_MovSpecReg(BLOCK& block, common::Opcode opcode, uint8_t specReg, Reg32 reg) {
+		constexpr static void template_MovSpecReg(BLOCK& block, common::Opcode opcode, uint8_t specReg, Reg32 reg) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, opcode);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, specReg, reg);
@@ -926,27 +961,27 @@ namespace CppAsm::X86
 #pragma region Data transfer [DONE]
 		/* Convert byte to word */
 		template <class BLOCK>
-		static void Cbw(BLOCK& block) {
+		constexpr static void Cbw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x98);
 		}
 
 		/* Convert byte to word */
 		template <class BLOCK>
-		static void Cdq(BLOCK& block) {
+		constexpr static void Cdq(BLOCK& block) {
 			common::write_Opcode(block, 0x99);
 		}
 
 		/* Convert word to double word */
 		template <class BLOCK>
-		static void Cwd(BLOCK& block) {
+		constexpr static void Cwd(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x99);
 		}
 
 		/* Convert word to double word */
 		template <class BLOCK>
-		static void Cwde(BLOCK& block) {
+		constexpr static void Cwde(BLOCK& block) {
 			common::write_Opcode(block, 0x98);
 		}
 
@@ -954,7 +989,7 @@ namespace CppAsm::X86
 		 - LEA reg16, [mem]
 		*/
 		template<AddressMode MODE, class BLOCK>
-		static auto Lea(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static auto Lea(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
 			return template_2operands(block, 0x8D, mem, reg);
 		}
 
@@ -962,7 +997,7 @@ namespace CppAsm::X86
 		 - LEA reg32, [mem]
 		*/
 		template<AddressMode MODE, class BLOCK>
-		static auto Lea(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static auto Lea(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
 			return template_2operands(block, 0x8D, mem, reg);
 		}
 
@@ -972,7 +1007,7 @@ namespace CppAsm::X86
 		 - MOV [mem],reg
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Mov(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Mov(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands(block, detail::opcode_MOV.getMain(), dst, src);
 		}
 
@@ -980,7 +1015,7 @@ namespace CppAsm::X86
 		 - MOV [mem],imm
 		*/
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static auto Mov(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Mov(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Mov: Invalid size modifier");
 			return template_mem_imm_operands<SIZE>(block, detail::opcode_MOV, mem, imm);
 		}
@@ -989,7 +1024,7 @@ namespace CppAsm::X86
 		 - MOV [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Mov(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Mov(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Mov<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -997,7 +1032,7 @@ namespace CppAsm::X86
 		 - MOV reg,imm
 		*/
 		template<class REG, class T, class BLOCK>
-		static auto Mov(BLOCK& block, const REG& reg, const Imm<T>& imm) {
+		constexpr static auto Mov(BLOCK& block, const REG& reg, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "Mov: First parameter is not register");
 			return template_reg_imm_operands(block, detail::opcode_MOV, reg, imm);
 		}
@@ -1007,7 +1042,7 @@ namespace CppAsm::X86
 		 - MOV [mem],sreg
 		*/
 		template<class DST, class BLOCK>
-		static auto Mov(BLOCK& block, const DST& dst, RegSeg sreg) {
+		constexpr static auto Mov(BLOCK& block, const DST& dst, RegSeg sreg) {
 			return template_2operands_segm(block, 0x8c, dst, sreg);
 		}
 
@@ -1016,7 +1051,7 @@ namespace CppAsm::X86
 		 - MOV sreg,[mem]
 		*/
 		template<class SRC, class BLOCK>
-		static auto Mov(BLOCK& block, RegSeg sreg, const SRC& src) {
+		constexpr static auto Mov(BLOCK& block, RegSeg sreg, const SRC& src) {
 			return template_2operands_segm(block, 0x8c, sreg, src);
 		}
 
@@ -1024,7 +1059,7 @@ namespace CppAsm::X86
 		 - MOV creg,reg
 		*/
 		template<class BLOCK>
-		static void Mov(BLOCK& block, RegControl dst, Reg32 src) {
+		constexpr static void Mov(BLOCK& block, RegControl dst, Reg32 src) {
 			template_MovSpecReg(block, 0x22, dst, src);
 		}
 
@@ -1032,7 +1067,7 @@ namespace CppAsm::X86
 		 - MOV reg,creg
 		*/
 		template<class BLOCK>
-		static void Mov(BLOCK& block, Reg32 dst, RegControl src) {
+		constexpr static void Mov(BLOCK& block, Reg32 dst, RegControl src) {
 			template_MovSpecReg(block, 0x20, src, dst);
 		}
 
@@ -1040,7 +1075,7 @@ namespace CppAsm::X86
 		 - MOV dreg,reg
 		*/
 		template<class BLOCK>
-		static void Mov(BLOCK& block, RegDebug dst, Reg32 src) {
+		constexpr static void Mov(BLOCK& block, RegDebug dst, Reg32 src) {
 			template_MovSpecReg(block, 0x23, dst, src);
 		}
 
@@ -1048,7 +1083,7 @@ namespace CppAsm::X86
 		 - MOV reg,dreg
 		*/
 		template<class BLOCK>
-		static void Mov(BLOCK& block, Reg32 dst, RegDebug src) {
+		constexpr static void Mov(BLOCK& block, Reg32 dst, RegDebug src) {
 			template_MovSpecReg(block, 0x21, src, dst);
 		}
 
@@ -1056,7 +1091,7 @@ namespace CppAsm::X86
 		 - MOVSX reg,reg
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Movsx(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Movsx(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2reg_operands_extend_val(block, 0xBE, dst, src);
 		}
 
@@ -1064,7 +1099,7 @@ namespace CppAsm::X86
 		 - MOVSX reg,[mem]
 		*/
 		template<MemSize SIZE, class REG, AddressMode MODE, class BLOCK>
-		static auto Movsx(BLOCK& block, const REG& dst, const Mem32<MODE>& src) {
+		constexpr static auto Movsx(BLOCK& block, const REG& dst, const Mem32<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Movsx: First parameter is not register");
 			return template_2operands_extend_val<SIZE>(block, 0xBE, dst, src);
 		}
@@ -1073,7 +1108,7 @@ namespace CppAsm::X86
 		 - MOVZX reg,reg
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Movzx(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Movzx(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2reg_operands_extend_val(block, 0xB6, dst, src);
 		}
 
@@ -1081,7 +1116,7 @@ namespace CppAsm::X86
 		 - MOVZX reg,[mem]
 		*/
 		template<MemSize SIZE, class REG, AddressMode MODE, class BLOCK>
-		static auto Movzx(BLOCK& block, const REG& dst, const Mem32<MODE>& src) {
+		constexpr static auto Movzx(BLOCK& block, const REG& dst, const Mem32<MODE>& src) {
 			static_assert(IsRegType<REG>::value, "Movzx: First parameter is not register");
 			return template_2operands_extend_val<SIZE>(block, 0xB6, dst, src);
 		}
@@ -1090,7 +1125,7 @@ namespace CppAsm::X86
 		 - PUSH reg16
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg16> Push(BLOCK& block, Reg16 reg) {
+		constexpr static ReplaceableReg<Reg16> Push(BLOCK& block, Reg16 reg) {
 			common::write_Opcode_16bit_Prefix(block);
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x50 | reg);
@@ -1101,7 +1136,7 @@ namespace CppAsm::X86
 		 - PUSH reg32
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg32> Push(BLOCK& block, Reg32 reg) {
+		constexpr static ReplaceableReg<Reg32> Push(BLOCK& block, Reg32 reg) {
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x50 | reg);
 			return ReplaceableReg<Reg32>(offset, 0);
@@ -1111,7 +1146,7 @@ namespace CppAsm::X86
 		 - PUSH imm8
 		*/
 		template<class BLOCK>
-		static ReplaceableValue<S8> Push(BLOCK& block, S8 number) {
+		constexpr static ReplaceableValue<S8> Push(BLOCK& block, S8 number) {
 			common::write_Opcode(block, 0x6A);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, number);
@@ -1122,7 +1157,7 @@ namespace CppAsm::X86
 		 - PUSH imm16
 		*/
 		template<class BLOCK>
-		static ReplaceableValue<S16> Push(BLOCK& block, S16 number) {
+		constexpr static ReplaceableValue<S16> Push(BLOCK& block, S16 number) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x68);
 			Offset offset = block.getOffset();
@@ -1134,7 +1169,7 @@ namespace CppAsm::X86
 		 - PUSH imm32
 		*/
 		template<class BLOCK>
-		static ReplaceableValue<S32> Push(BLOCK& block, S32 number) {
+		constexpr static ReplaceableValue<S32> Push(BLOCK& block, S32 number) {
 			common::write_Opcode(block, 0x68);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, number);
@@ -1145,7 +1180,7 @@ namespace CppAsm::X86
 		 - PUSH [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Push(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Push(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Push: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_PUSH, mem);
 		}
@@ -1154,7 +1189,7 @@ namespace CppAsm::X86
 		 - PUSH sreg
 		*/
 		template<class BLOCK>
-		static void Push(BLOCK& block, RegSeg sreg) {
+		constexpr static void Push(BLOCK& block, RegSeg sreg) {
 			if (sreg == ES) {
 				common::write_Opcode(block, 0x06);
 			} else if (sreg == CS) {
@@ -1174,14 +1209,14 @@ namespace CppAsm::X86
 
 		/* Store all 16 bit general registers to stack */
 		template<class BLOCK>
-		static void Pusha(BLOCK& block) {
+		constexpr static void Pusha(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x60);
 		}
 
 		/* Store all 32 bit general registers to stack */
 		template<class BLOCK>
-		static void Pushad(BLOCK& block) {
+		constexpr static void Pushad(BLOCK& block) {
 			common::write_Opcode(block, 0x60);
 		}
 
@@ -1189,7 +1224,7 @@ namespace CppAsm::X86
 		 - POP reg16
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg16> Pop(BLOCK& block, Reg16 reg) {
+		constexpr static ReplaceableReg<Reg16> Pop(BLOCK& block, Reg16 reg) {
 			common::write_Opcode_16bit_Prefix(block);
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x58 | reg);
@@ -1200,7 +1235,7 @@ namespace CppAsm::X86
 		 - POP reg32
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg32> Pop(BLOCK& block, Reg32 reg) {
+		constexpr static ReplaceableReg<Reg32> Pop(BLOCK& block, Reg32 reg) {
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x58 | reg);
 			return ReplaceableReg<Reg32>(offset, 0);
@@ -1210,7 +1245,7 @@ namespace CppAsm::X86
 		 - POP [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Pop(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Pop(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Pop: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_POP, mem);
 		}
@@ -1219,7 +1254,7 @@ namespace CppAsm::X86
 		 - POP sreg
 		*/
 		template<class BLOCK>
-		static void Pop(BLOCK& block, RegSeg sreg) {
+		constexpr static void Pop(BLOCK& block, RegSeg sreg) {
 			if (sreg == ES) {
 				common::write_Opcode(block, 0x07);
 			} else if (sreg == SS) {
@@ -1237,14 +1272,14 @@ namespace CppAsm::X86
 
 		/* Load all 16 bit general registers from stack */
 		template<class BLOCK>
-		static void Popa(BLOCK& block) {
+		constexpr static void Popa(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x61);
 		}
 
 		/* Load all 32 bit general registers from stack */
 		template<class BLOCK>
-		static void Popad(BLOCK& block) {
+		constexpr static void Popad(BLOCK& block) {
 			common::write_Opcode(block, 0x61);
 		}
 
@@ -1252,7 +1287,7 @@ namespace CppAsm::X86
 		 - XCHG EAX,reg32
 		*/
 		template<class BLOCK>
-		static void Xchg(BLOCK& block, Reg32 reg) {
+		constexpr static void Xchg(BLOCK& block, Reg32 reg) {
 			common::write_Opcode(block, 0x90 | reg);
 		}
 
@@ -1260,7 +1295,7 @@ namespace CppAsm::X86
 		 - XCHG reg32,reg32
 		*/
 		template<class BLOCK>
-		static void Xchg(BLOCK& block, Reg32 dst, Reg32 src) {
+		constexpr static void Xchg(BLOCK& block, Reg32 dst, Reg32 src) {
 			common::write_Opcode(block, 0x87);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
 		}
@@ -1269,7 +1304,7 @@ namespace CppAsm::X86
 		 - XCHG AX,reg16
 		*/
 		template<class BLOCK>
-		static void Xchg(BLOCK& block, Reg16 reg) {
+		constexpr static void Xchg(BLOCK& block, Reg16 reg) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x90 | reg);
 		}
@@ -1278,7 +1313,7 @@ namespace CppAsm::X86
 		 - XCHG reg16,reg16
 		*/
 		template<class BLOCK>
-		static void Xchg(BLOCK& block, Reg16 dst, Reg16 src) {
+		constexpr static void Xchg(BLOCK& block, Reg16 dst, Reg16 src) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x87);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -1288,7 +1323,7 @@ namespace CppAsm::X86
 		 - XCHG reg8,reg8
 		*/
 		template<class BLOCK>
-		static void Xchg(BLOCK& block, Reg8 dst, Reg8 src) {
+		constexpr static void Xchg(BLOCK& block, Reg8 dst, Reg8 src) {
 			common::write_Opcode(block, 0x86);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
 		}
@@ -1298,13 +1333,13 @@ namespace CppAsm::X86
 		 - XCHG [mem],reg
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Xchg(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Xchg(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_symetric(block, 0x86, dst, src);
 		}
 
 		/* Translate by table */
 		template<class BLOCK>
-		static void Xlat(BLOCK& block) {
+		constexpr static void Xlat(BLOCK& block) {
 			common::write_Opcode(block, 0xD7);
 		}
 
@@ -1312,7 +1347,7 @@ namespace CppAsm::X86
 		 - IN reg,imm
 		*/
 		template<MemSize SIZE, class BLOCK>
-		static ReplaceableValue<U8> In(BLOCK& block, const U8& imm) {
+		constexpr static ReplaceableValue<U8> In(BLOCK& block, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "In: Invalid size modifier");
 			write_Opcode<SIZE>(block, 0xE4);
 			Offset offset = block.getOffset();
@@ -1324,7 +1359,7 @@ namespace CppAsm::X86
 		 - IN eax/ax/al,dx
 		*/
 		template<MemSize SIZE, Reg16 PORT_REG, class BLOCK>
-		static void In(BLOCK& block) {
+		constexpr static void In(BLOCK& block) {
 			static_assert(isGeneralMemSize(SIZE), "In: Invalid size modifier");
 			write_Opcode<SIZE>(block, 0xEC);
 		}
@@ -1333,7 +1368,7 @@ namespace CppAsm::X86
 		 - OUT imm, reg
 		*/
 		template<MemSize SIZE, class BLOCK>
-		static ReplaceableValue<U8> Out(BLOCK& block, const U8& imm) {
+		constexpr static ReplaceableValue<U8> Out(BLOCK& block, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Out: Invalid size modifier");
 			write_Opcode<SIZE>(block, 0xE6);
 			Offset offset = block.getOffset();
@@ -1345,7 +1380,7 @@ namespace CppAsm::X86
 		 - OUT dx,eax/ax
 		*/
 		template<MemSize SIZE, Reg16 PORT_REG, class BLOCK>
-		static void Out(BLOCK& block) {
+		constexpr static void Out(BLOCK& block) {
 			static_assert(isGeneralMemSize(SIZE), "Out: Invalid size modifier");
 			write_Opcode<SIZE>(block, 0xEE);
 		}
@@ -1359,7 +1394,7 @@ namespace CppAsm::X86
 		 - ADC reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Adc(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Adc(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_ADC, dst, src);
 		}
 
@@ -1367,7 +1402,7 @@ namespace CppAsm::X86
 		 - ADC EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Adc(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Adc(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Adc: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Adc: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x14, imm);
@@ -1377,7 +1412,7 @@ namespace CppAsm::X86
 		 - ADC [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Adc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Adc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Adc: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_ADC, mem, imm);
 		}
@@ -1386,7 +1421,7 @@ namespace CppAsm::X86
 		 - ADC [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Adc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Adc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Adc<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1397,7 +1432,7 @@ namespace CppAsm::X86
 		 - ADD reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Add(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Add(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_ADD, dst, src);
 		}
 
@@ -1405,7 +1440,7 @@ namespace CppAsm::X86
 		 - ADD EAX,AX,AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Add(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Add(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Add: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Add: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x04, imm);
@@ -1415,7 +1450,7 @@ namespace CppAsm::X86
 		 - ADD [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Add(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Add(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Add: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_ADD, mem, imm);
 		}
@@ -1424,7 +1459,7 @@ namespace CppAsm::X86
 		 - ADD [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Add(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Add(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Add<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1435,12 +1470,12 @@ namespace CppAsm::X86
 		 - CMP reg,imm
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Cmp(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Cmp(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm(block, detail::opcode_CMP, dst, src);
 		}
 
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Cmp(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Cmp(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Cmp: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Cmp: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x3C, imm);
@@ -1450,7 +1485,7 @@ namespace CppAsm::X86
 		 - CMP [mem],imm
 		*/
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static auto Cmp(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Cmp(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Cmp: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, NO_LOCK>(block, detail::opcode_CMP, mem, imm);
 		}
@@ -1459,7 +1494,7 @@ namespace CppAsm::X86
 		 - CMP [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Cmp(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Cmp(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Cmp<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1467,7 +1502,7 @@ namespace CppAsm::X86
 		 - CMP imm,[mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static auto Cmp(BLOCK& block, const Imm<T>& imm, const Mem32<MODE>& mem) {
+		constexpr static auto Cmp(BLOCK& block, const Imm<T>& imm, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Cmp: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, NO_LOCK>(block, detail::opcode_CMP, mem, imm);
 		}
@@ -1476,7 +1511,7 @@ namespace CppAsm::X86
 		 - CMP imm,[mem] (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Cmp(BLOCK& block, const Imm<T>& imm, const Mem32<MODE>& mem) {
+		constexpr static auto Cmp(BLOCK& block, const Imm<T>& imm, const Mem32<MODE>& mem) {
 			return Cmp<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1484,7 +1519,7 @@ namespace CppAsm::X86
 		 - INC reg32
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg32> Inc(BLOCK& block, Reg32 reg) {
+		constexpr static ReplaceableReg<Reg32> Inc(BLOCK& block, Reg32 reg) {
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x40 | reg);
 			return ReplaceableReg<Reg32>(offset, 0);
@@ -1494,7 +1529,7 @@ namespace CppAsm::X86
 		 - INC reg16
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg16> Inc(BLOCK& block, Reg16 reg) {
+		constexpr static ReplaceableReg<Reg16> Inc(BLOCK& block, Reg16 reg) {
 			common::write_Opcode_16bit_Prefix(block);
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x40 | reg);
@@ -1505,7 +1540,7 @@ namespace CppAsm::X86
 		 - INC reg8
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg8> Inc(BLOCK& block, Reg8 reg) {
+		constexpr static ReplaceableReg<Reg8> Inc(BLOCK& block, Reg8 reg) {
 			return template_1reg_operand(block, detail::opcode_INC, reg);
 		}
 
@@ -1513,7 +1548,7 @@ namespace CppAsm::X86
 		 - INC [mem]
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Inc(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Inc(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Inc: Invalid size modifier");
 			return template_1mem_operand<SIZE, L>(block, detail::opcode_INC, mem);
 		}
@@ -1522,7 +1557,7 @@ namespace CppAsm::X86
 		 - DEC reg32
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg32> Dec(BLOCK& block, Reg32 reg) {
+		constexpr static ReplaceableReg<Reg32> Dec(BLOCK& block, Reg32 reg) {
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x48 | reg);
 			return ReplaceableReg<Reg32>(offset, 0);
@@ -1532,7 +1567,7 @@ namespace CppAsm::X86
 		 - DEC reg16
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg16> Dec(BLOCK& block, Reg16 reg) {
+		constexpr static ReplaceableReg<Reg16> Dec(BLOCK& block, Reg16 reg) {
 			common::write_Opcode_16bit_Prefix(block);
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0x48 | reg);
@@ -1543,7 +1578,7 @@ namespace CppAsm::X86
 		 - DEC reg8
 		*/
 		template<class BLOCK>
-		static ReplaceableReg<Reg8> Dec(BLOCK& block, Reg8 reg) {
+		constexpr static ReplaceableReg<Reg8> Dec(BLOCK& block, Reg8 reg) {
 			return template_1reg_operand(block, detail::opcode_DEC, reg);
 		}
 
@@ -1551,7 +1586,7 @@ namespace CppAsm::X86
 		- DEC [mem]
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Dec(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Dec(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Dec: Invalid size modifier");
 			return template_1mem_operand<SIZE, L>(block, detail::opcode_DEC, mem);
 		}
@@ -1560,7 +1595,7 @@ namespace CppAsm::X86
 		 - NEG reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Neg(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Neg(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Neg: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_NEG, reg);
 		}
@@ -1569,7 +1604,7 @@ namespace CppAsm::X86
 		 - NEG [mem]
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Neg(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Neg(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Neg: Invalid size modifier");
 			return template_1mem_operand<SIZE, L>(block, detail::opcode_NEG, mem);
 		}
@@ -1578,7 +1613,7 @@ namespace CppAsm::X86
 		 - MUL reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Mul(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Mul(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Mul: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_MUL, reg);
 		}
@@ -1587,7 +1622,7 @@ namespace CppAsm::X86
 		 - MUL [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Mul(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Mul(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Mul: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_MUL, mem);
 		}
@@ -1596,7 +1631,7 @@ namespace CppAsm::X86
 		 - IMUL reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Imul(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Imul(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Imul: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_IMUL, reg);
 		}
@@ -1605,7 +1640,7 @@ namespace CppAsm::X86
 		 - IMUL [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Imul(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Imul(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Imul: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_IMUL, mem);
 		}
@@ -1614,7 +1649,7 @@ namespace CppAsm::X86
 		 - IMUL reg,reg
 		*/
 		template<class REG, class BLOCK>
-		static void Imul(BLOCK& block, REG reg1, REG reg2) {
+		constexpr static void Imul(BLOCK& block, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "Imul: First and second parameter is not register");
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, 0xAF);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg1, reg2);
@@ -1624,7 +1659,7 @@ namespace CppAsm::X86
 		 - IMUL reg,[mem]
 		*/
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Imul(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Imul(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Imul: First parameter is not register");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Only_Extended_Prefixs<TypeMemSize<REG>::value>(block, 0xAF);
@@ -1635,7 +1670,7 @@ namespace CppAsm::X86
 		 - IMUL reg16,imm8
 		*/
 		template<class BLOCK>
-		static void Imul(BLOCK& block, Reg16 reg, S8 imm) {
+		constexpr static void Imul(BLOCK& block, Reg16 reg, S8 imm) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x6B);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, 0);
@@ -1646,7 +1681,7 @@ namespace CppAsm::X86
 		 - IMUL reg32,imm8
 		*/
 		template<class BLOCK>
-		static void Imul(BLOCK& block, Reg32 reg, S8 imm) {
+		constexpr static void Imul(BLOCK& block, Reg32 reg, S8 imm) {
 			common::write_Opcode(block, 0x6B);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, 0);
 			common::write_Immediate(block, imm);
@@ -1656,7 +1691,7 @@ namespace CppAsm::X86
 		 - IMUL reg16,imm16
 		*/
 		template<class BLOCK>
-		static void Imul(BLOCK& block, Reg16 reg, S16 imm) {
+		constexpr static void Imul(BLOCK& block, Reg16 reg, S16 imm) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x69);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, 0);
@@ -1667,7 +1702,7 @@ namespace CppAsm::X86
 		 - IMUL reg32,imm32
 		*/
 		template<class BLOCK>
-		static void Imul(BLOCK& block, Reg32 reg, S32 imm) {
+		constexpr static void Imul(BLOCK& block, Reg32 reg, S32 imm) {
 			common::write_Opcode(block, 0x69);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg, 0);
 			common::write_Immediate(block, imm);
@@ -1677,7 +1712,7 @@ namespace CppAsm::X86
 		 - IMUL reg,reg,imm
 		*/
 		template<class REG, class T, class BLOCK>
-		static void Imul(BLOCK& block, REG reg1, REG reg2, const Imm<T>& imm) {
+		constexpr static void Imul(BLOCK& block, REG reg1, REG reg2, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "Imul: First and second parameter is not register");
 			write_Opcode_Imm_Optimized<TypeMemSize<REG>::value, TypeMemSize<Imm<T>>::value>(block, 0x69);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg1, reg2);
@@ -1688,7 +1723,7 @@ namespace CppAsm::X86
 		 - IMUL reg,reg,imm
 		*/
 		template<class REG, AddressMode MODE, class T, class BLOCK>
-		static void Imul(BLOCK& block, REG reg, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static void Imul(BLOCK& block, REG reg, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "Imul: First parameter is not register");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Imm_Optimized<TypeMemSize<REG>::value, TypeMemSize<Imm<T>>::value>(block, 0x69);
@@ -1700,7 +1735,7 @@ namespace CppAsm::X86
 		 - DIV reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Div(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Div(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Div: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_DIV, reg);
 		}
@@ -1709,7 +1744,7 @@ namespace CppAsm::X86
 		 - DIV [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Div(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Div(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Div: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_DIV, mem);
 		}
@@ -1718,7 +1753,7 @@ namespace CppAsm::X86
 		 - IDIV reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Idiv(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Idiv(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Idiv: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_IDIV, reg);
 		}
@@ -1727,7 +1762,7 @@ namespace CppAsm::X86
 		 - IDIV [mem]
 		*/
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Idiv(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Idiv(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Idiv: Invalid size modifier");
 			return template_1mem_operand<SIZE>(block, detail::opcode_IDIV, mem);
 		}
@@ -1739,7 +1774,7 @@ namespace CppAsm::X86
 		 - SBB reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Sbb(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Sbb(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_SBB, dst, src);
 		}
 
@@ -1747,7 +1782,7 @@ namespace CppAsm::X86
 		 - SBB EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Sbb(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Sbb(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sbb: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Sbb: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x1C, imm);
@@ -1757,7 +1792,7 @@ namespace CppAsm::X86
 		 - SBB [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Sbb(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Sbb(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sbb: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_SBB, mem, imm);
 		}
@@ -1766,7 +1801,7 @@ namespace CppAsm::X86
 		 - SBB [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Sbb(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Sbb(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Sbb<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1777,7 +1812,7 @@ namespace CppAsm::X86
 		 - SUB reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Sub(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Sub(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_SUB, dst, src);
 		}
 
@@ -1785,7 +1820,7 @@ namespace CppAsm::X86
 		 - SUB EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Sub(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Sub(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sub: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Sub: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x2C, imm);
@@ -1795,7 +1830,7 @@ namespace CppAsm::X86
 		 - SUB [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Sub(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Sub(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sub: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_SUB, mem, imm);
 		}
@@ -1804,7 +1839,7 @@ namespace CppAsm::X86
 		 - SUB [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Sub(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Sub(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Sub<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 #pragma endregion
@@ -1812,7 +1847,7 @@ namespace CppAsm::X86
 #pragma region Decimal arithmetics [DONE]
 		/* ACII correction after addition */
 		template<class BLOCK>
-		static void Aaa(BLOCK& block) {
+		constexpr static void Aaa(BLOCK& block) {
 			common::write_Opcode(block, 0x37);
 		}
 
@@ -1820,7 +1855,7 @@ namespace CppAsm::X86
 		 - AAD {imm} 
 		 */
 		template<class BLOCK>
-		static ReplaceableValue<S8::type> Aad(BLOCK& block, S8 base = S8(10)) {
+		constexpr static ReplaceableValue<S8::type> Aad(BLOCK& block, S8 base = S8(10)) {
 			common::write_Opcode(block, 0xD5);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, base);
@@ -1831,7 +1866,7 @@ namespace CppAsm::X86
 		 - AAM {imm}
 		 */
 		template<class BLOCK>
-		static ReplaceableValue<S8::type> Aam(BLOCK& block, S8 base = S8(10)) {
+		constexpr static ReplaceableValue<S8::type> Aam(BLOCK& block, S8 base = S8(10)) {
 			common::write_Opcode(block, 0xD4);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, base);
@@ -1840,19 +1875,19 @@ namespace CppAsm::X86
 
 		/* ASCII correction after subtraction */
 		template<class BLOCK>
-		static void Aas(BLOCK& block) {
+		constexpr static void Aas(BLOCK& block) {
 			common::write_Opcode(block, 0x3F);
 		}
 
 		/* BCD-correction after addition */
 		template<class BLOCK>
-		static void Daa(BLOCK& block) {
+		constexpr static void Daa(BLOCK& block) {
 			common::write_Opcode(block, 0x27);
 		}
 
 		/* BCD-correction after subtraction */
 		template<class BLOCK>
-		static void Das(BLOCK& block) {
+		constexpr static void Das(BLOCK& block) {
 			common::write_Opcode(block, 0x2F);
 		}
 #pragma endregion
@@ -1865,7 +1900,7 @@ namespace CppAsm::X86
 		 - AND reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto And(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto And(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_AND, dst, src);
 		}
 
@@ -1873,7 +1908,7 @@ namespace CppAsm::X86
 		 - AND EAX/AX/Al,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void And(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void And(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "And: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "And: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x24, imm);
@@ -1883,7 +1918,7 @@ namespace CppAsm::X86
 		 - AND [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto And(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto And(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "And: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_AND, mem, imm);
 		}
@@ -1892,7 +1927,7 @@ namespace CppAsm::X86
 		 - AND [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto And(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto And(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return And<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1900,7 +1935,7 @@ namespace CppAsm::X86
 		 - NOT reg
 		*/
 		template<class REG, class BLOCK>
-		static ReplaceableReg<REG> Not(BLOCK& block, REG reg) {
+		constexpr static ReplaceableReg<REG> Not(BLOCK& block, REG reg) {
 			static_assert(IsRegType<REG>::value, "Not: Parameter is not register");
 			return template_1reg_operand(block, detail::opcode_NOT, reg);
 		}
@@ -1909,7 +1944,7 @@ namespace CppAsm::X86
 		 - NOT [mem]
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class BLOCK>
-		static ReplaceableMem32<MODE> Not(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static ReplaceableMem32<MODE> Not(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Not: Invalid size modifier");
 			return template_1mem_operand<SIZE, L>(block, detail::opcode_NOT, mem);
 		}
@@ -1921,7 +1956,7 @@ namespace CppAsm::X86
 		 - OR reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Or(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Or(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_OR, dst, src);
 		}
 
@@ -1929,7 +1964,7 @@ namespace CppAsm::X86
 		 - OR EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Or(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Or(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Or: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Or: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x0C, imm);
@@ -1939,7 +1974,7 @@ namespace CppAsm::X86
 		 - OR [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Or(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Or(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Or: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_OR, mem, imm);
 		}
@@ -1948,7 +1983,7 @@ namespace CppAsm::X86
 		 - OR [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Or(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Or(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Or<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -1956,7 +1991,7 @@ namespace CppAsm::X86
 		 - TEST reg32,reg32
 		*/
 		template<class BLOCK>
-		static void Test(BLOCK& block, Reg32 dst, Reg32 src) {
+		constexpr static void Test(BLOCK& block, Reg32 dst, Reg32 src) {
 			common::write_Opcode(block, detail::opcode_TEST.getMain() | 1);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
 		}
@@ -1965,7 +2000,7 @@ namespace CppAsm::X86
 		 - TEST reg16,reg16
 		*/
 		template<class BLOCK>
-		static void Test(BLOCK& block, Reg16 dst, Reg16 src) {
+		constexpr static void Test(BLOCK& block, Reg16 dst, Reg16 src) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, detail::opcode_TEST.getMain() | 1);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
@@ -1975,7 +2010,7 @@ namespace CppAsm::X86
 		 - TEST reg8,reg8
 		*/
 		template<class BLOCK>
-		static void Test(BLOCK& block, Reg8 dst, Reg8 src) {
+		constexpr static void Test(BLOCK& block, Reg8 dst, Reg8 src) {
 			common::write_Opcode(block, detail::opcode_TEST.getMain());
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, dst, src);
 		}
@@ -1984,7 +2019,7 @@ namespace CppAsm::X86
 		 - TEST reg,imm
 		*/
 		template<class REG, class T, class BLOCK>
-		static auto Test(BLOCK& block, REG reg, const Imm<T>& imm) {
+		constexpr static auto Test(BLOCK& block, REG reg, const Imm<T>& imm) {
 			static_assert(IsRegType<REG>::value, "Test: First parameter is not register");
 			return template_reg_imm_operands(block, detail::opcode_TEST, reg, imm);
 		}
@@ -1994,7 +2029,7 @@ namespace CppAsm::X86
 		 - TEST [mem],reg
 		*/
 		template<class DST, class SRC, class BLOCK>
-		static auto Test(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Test(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_symetric(block, detail::opcode_TEST.getMain(), dst, src);
 		}
 
@@ -2002,7 +2037,7 @@ namespace CppAsm::X86
 		 - TEST [mem],imm
 		 */
 		template<MemSize SIZE, AddressMode MODE, class T, class BLOCK>
-		static auto Test(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Test(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Test: Invalid size modifier");
 			return template_mem_imm_operands<SIZE>(block, detail::opcode_TEST, mem, imm);
 		}
@@ -2011,7 +2046,7 @@ namespace CppAsm::X86
 		 - TEST [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Test(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Test(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Test<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 
@@ -2019,7 +2054,7 @@ namespace CppAsm::X86
 		 - TEST EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Test(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Test(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Test: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Test: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0xA8, imm);
@@ -2032,7 +2067,7 @@ namespace CppAsm::X86
 		 - XOR reg,imm
 		*/
 		template<LockPrefix L = NO_LOCK, class DST, class SRC, class BLOCK>
-		static auto Xor(BLOCK& block, const DST& dst, const SRC& src) {
+		constexpr static auto Xor(BLOCK& block, const DST& dst, const SRC& src) {
 			return template_2operands_opt_imm<L>(block, detail::opcode_XOR, dst, src);
 		}
 
@@ -2040,7 +2075,7 @@ namespace CppAsm::X86
 		 - XOR EAX/AX/AL,imm
 		*/
 		template<MemSize SIZE, class T, class BLOCK>
-		static void Xor(BLOCK& block, const Imm<T>& imm) {
+		constexpr static void Xor(BLOCK& block, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Xor: Invalid size modifier");
 			static_assert(TypeMemSize<Imm<T>>::value == SIZE, "Xor: Immediate size not equal size modifier");
 			template_2operands_first_reg_imm<SIZE>(block, 0x34, imm);
@@ -2050,7 +2085,7 @@ namespace CppAsm::X86
 		 - XOR [mem],imm
 		*/
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Xor(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Xor(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Xor: Invalid size modifier");
 			return template_mem_imm_opt_operands<SIZE, L>(block, detail::opcode_XOR, mem, imm);
 		}
@@ -2059,317 +2094,317 @@ namespace CppAsm::X86
 		 - XOR [mem],imm (auto mem size)
 		*/
 		template<AddressMode MODE, class T, class BLOCK>
-		static auto Xor(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Xor(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			return Xor<TypeMemSize<Imm<T>>::value>(block, mem, imm);
 		}
 #pragma endregion
 		
 #pragma region Bit shift operations [DONE]
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Rol(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rol(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rol: Invalid size modifier");
 			static_assert(SH_REG == CL, "Rol: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_ROL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rol(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rol(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rol: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_ROL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rol(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Rol(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Rol: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_ROL, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rol(BLOCK& block, const REG& reg) {
+		constexpr static auto Rol(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Rol: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_ROL, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Rol(BLOCK& block, const REG& reg) {
+		constexpr static auto Rol(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Rol: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Rol: Parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_ROL, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rol(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Rol(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Rol: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_ROL, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Ror(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Ror(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Ror: Invalid size modifier");
 			static_assert(SH_REG == CL, "Ror: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_ROR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Ror(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Ror(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Ror: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_ROR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Ror(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Ror(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Ror: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_ROR, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Ror(BLOCK& block, const REG& reg) {
+		constexpr static auto Ror(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Ror: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_ROR, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Ror(BLOCK& block, const REG& reg) {
+		constexpr static auto Ror(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Rol: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Ror: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_ROR, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Ror(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Ror(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Ror: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_ROR, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Rcl(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rcl(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rcl: Invalid size modifier");
 			static_assert(SH_REG == CL, "Rcl: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_RCL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rcl(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rcl(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rcl: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_RCL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rcl(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Rcl(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Rcl: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_RCL, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rcl(BLOCK& block, const REG& reg) {
+		constexpr static auto Rcl(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Rcl: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_RCL, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Rcl(BLOCK& block, const REG& reg) {
+		constexpr static auto Rcl(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Rcl: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Rcl: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_RCL, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rcl(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Rcl(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Rcl: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_RCL, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Rcr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rcr(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rcr: Invalid size modifier");
 			static_assert(SH_REG == CL, "Rcr: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_RCR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rcr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Rcr(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Rcr: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_RCR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Rcr(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Rcr(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Rcr: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_RCR, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rcr(BLOCK& block, const REG& reg) {
+		constexpr static auto Rcr(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Rcr: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_RCR, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Rcr(BLOCK& block, const REG& reg) {
+		constexpr static auto Rcr(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Rcr: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Rcr: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_RCR, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Rcr(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Rcr(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Rcr: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_RCR, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Sal(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Sal(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Sal: Invalid size modifier");
 			static_assert(SH_REG == CL, "Rcr: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_SAL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Sal(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Sal(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Sal: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SAL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Sal(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Sal(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sal: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SAL, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Sal(BLOCK& block, const REG& reg) {
+		constexpr static auto Sal(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Sal: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SAL, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Sal(BLOCK& block, const REG& reg) {
+		constexpr static auto Sal(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Sal: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_SAL, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Sal(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Sal(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Sal: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SAL, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Shl(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Shl(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Shl: Invalid size modifier");
 			static_assert(SH_REG == CL, "Shl: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_SHL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Shl(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Shl(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Shl: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SHL, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Shl(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Shl(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Shl: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SHL, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shl(BLOCK& block, const REG& reg) {
+		constexpr static auto Shl(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Shl: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SHL, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Shl(BLOCK& block, const REG& reg) {
+		constexpr static auto Shl(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Shl: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Shl: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_SHL, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shl(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Shl(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Shl: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SHL, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Shr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Shr(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Shr: Invalid size modifier");
 			static_assert(SH_REG == CL, "Shr: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_SHR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Shr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Shr(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Shr: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SHR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Shr(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Shr(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Shr: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SHR, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shr(BLOCK& block, const REG& reg) {
+		constexpr static auto Shr(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Shr: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SHR, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Shr(BLOCK& block, const REG& reg) {
+		constexpr static auto Shr(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Shr: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Shr: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_SHR, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shr(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Shr(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Shr: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SHR, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 SH_REG, AddressMode MODE, class BLOCK>
-		static auto Sar(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Sar(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Sar: Invalid size modifier");
 			static_assert(SH_REG == CL, "Sar: Invalid shift register");
 			return template_shift_operands<SIZE, SH_REG>(block, detail::opcode_SAR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Sar(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static auto Sar(BLOCK& block, const Mem32<MODE>& mem) {
 			static_assert(isGeneralMemSize(SIZE), "Sar: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SAR, mem);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Sar(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
+		constexpr static auto Sar(BLOCK& block, const Mem32<MODE>& mem, const U8& imm) {
 			static_assert(isGeneralMemSize(SIZE), "Sar: Invalid size modifier");
 			return template_shift_operands<SIZE>(block, detail::opcode_SAR, mem, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Sar(BLOCK& block, const REG& reg) {
+		constexpr static auto Sar(BLOCK& block, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Sar: Parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SAR, reg);
 		}
 
 		template<Reg8 SH_REG, class REG, class BLOCK>
-		static auto Sar(BLOCK& block, const REG& reg) {
+		constexpr static auto Sar(BLOCK& block, const REG& reg) {
 			static_assert(SH_REG == CL, "Sar: Invalid shift register");
 			static_assert(IsRegType<REG>::value, "Sar: First parameter is not register");
 			return template_shift_operands<REG, SH_REG>(block, detail::opcode_SAR, reg);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Sar(BLOCK& block, const REG& reg, const U8& imm) {
+		constexpr static auto Sar(BLOCK& block, const REG& reg, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Sar: First parameter is not register");
 			return template_shift_operands<REG>(block, detail::opcode_SAR, reg, imm);
 		}
 
 		template<MemSize SIZE, Reg8 COUNT_REG, class REG, AddressMode MODE, class BLOCK>
-		static auto Shrd(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
+		constexpr static auto Shrd(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Shrd: Invalid size modifier");
 			static_assert(COUNT_REG == CL, "Shrd: Invalid count register");
 			static_assert(IsRegType<REG>::value, "Shrd: Second parameter is not register");
@@ -2377,26 +2412,26 @@ namespace CppAsm::X86
 		}
 
 		template<Reg8 COUNT_REG, class REG, class BLOCK>
-		static auto Shrd(BLOCK& block, REG reg1, REG reg2) {
+		constexpr static auto Shrd(BLOCK& block, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "Shrd: First and second parameter is not register");
 			return template_prshift_operands<COUNT_REG>(block, 0xAC, reg1, reg2);
 		}
 
 		template<MemSize SIZE, class REG, AddressMode MODE, class BLOCK>
-		static auto Shrd(BLOCK& block, const Mem32<MODE>& mem, REG reg, const U8& imm) {
+		constexpr static auto Shrd(BLOCK& block, const Mem32<MODE>& mem, REG reg, const U8& imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Shrd: Invalid size modifier");
 			static_assert(IsRegType<REG>::value, "Shrd: Second parameter is not register");
 			return template_prshift_operands<SIZE>(block, 0xAC, mem, reg, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shrd(BLOCK& block, REG reg1, REG reg2, const U8& imm) {
+		constexpr static auto Shrd(BLOCK& block, REG reg1, REG reg2, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Shrd: First and second parameter is not register");
 			return template_prshift_operands(block, 0xAC, reg1, reg2, imm);
 		}
 
 		template<MemSize SIZE, Reg8 COUNT_REG, class REG, AddressMode MODE, class BLOCK>
-		static auto Shld(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
+		constexpr static auto Shld(BLOCK& block, const Mem32<MODE>& mem, REG reg) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Shld: Invalid size modifier");
 			static_assert(COUNT_REG == CL, "Shld: Invalid count register");
 			static_assert(IsRegType<REG>::value, "Shld: Second parameter is not register");
@@ -2404,20 +2439,20 @@ namespace CppAsm::X86
 		}
 
 		template<Reg8 COUNT_REG, class REG, class BLOCK>
-		static auto Shld(BLOCK& block, REG reg1, REG reg2) {
+		constexpr static auto Shld(BLOCK& block, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "Shld: First and second parameter is not register");
 			return template_prshift_operands<COUNT_REG>(block, 0xA4, reg1, reg2);
 		}
 
 		template<MemSize SIZE, class REG, AddressMode MODE, class BLOCK>
-		static auto Shld(BLOCK& block, const Mem32<MODE>& mem, REG reg, const U8& imm) {
+		constexpr static auto Shld(BLOCK& block, const Mem32<MODE>& mem, REG reg, const U8& imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Shld: Invalid size modifier");
 			static_assert(IsRegType<REG>::value, "Shld: Second parameter is not register");
 			return template_prshift_operands<SIZE>(block, 0xA4, mem, reg, imm);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Shld(BLOCK& block, REG reg1, REG reg2, const U8& imm) {
+		constexpr static auto Shld(BLOCK& block, REG reg1, REG reg2, const U8& imm) {
 			static_assert(IsRegType<REG>::value, "Shld: First and second parameter is not register");
 			return template_prshift_operands(block, 0xA4, reg1, reg2, imm);
 		}
@@ -2425,250 +2460,250 @@ namespace CppAsm::X86
 
 #pragma region Bit manipulations [DONE]
 		template<class REG, class BLOCK>
-		static auto Bsf(BLOCK& block, REG reg1, REG reg2) {
+		constexpr static auto Bsf(BLOCK& block, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "Bsf: First and second parameter is not register");
 			return template_bit_scan(block, 0xBC, reg1, reg2);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static auto Bsf(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static auto Bsf(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Bsf: First parameter is not register");
 			return template_bit_scan(block, 0xBC, reg, mem);
 		}
 
 		template<class REG, class BLOCK>
-		static auto Bsr(BLOCK& block, REG reg1, REG reg2) {
+		constexpr static auto Bsr(BLOCK& block, REG reg1, REG reg2) {
 			static_assert(IsRegType<REG>::value, "Bsr: First and second parameter is not register");
 			return template_bit_scan(block, 0xBD, reg1, reg2);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static auto Bsr(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static auto Bsr(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Bsr: First parameter is not register");
 			return template_bit_scan(block, 0xBD, reg, mem);
 		}
 
 		template<class T1, class T2, class BLOCK>
-		static auto Bt(BLOCK& block, T1 val1, T2 val2) {
+		constexpr static auto Bt(BLOCK& block, T1 val1, T2 val2) {
 			return template_bit_operation(block, detail::opcode_BT, val1, val2);
 		}
 
 		template<MemSize SIZE, AddressMode MODE, class BLOCK>
-		static auto Bt(BLOCK& block, const Mem32<MODE>& mem, U8 imm) {
+		constexpr static auto Bt(BLOCK& block, const Mem32<MODE>& mem, U8 imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Bt: Invalid size modifier");
 			return template_bit_operation<NO_LOCK, SIZE>(block, detail::opcode_BT, mem, imm);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T1, class T2, class BLOCK>
-		static auto Btc(BLOCK& block, T1 val1, T2 val2) {
+		constexpr static auto Btc(BLOCK& block, T1 val1, T2 val2) {
 			return template_bit_operation<L>(block, detail::opcode_BTC, val1, val2);
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Btc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Btc(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Btc: Invalid size modifier");
 			return template_bit_operation<L, SIZE>(block, detail::opcode_BTC, mem, imm);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T1, class T2, class BLOCK>
-		static auto Btr(BLOCK& block, T1 val1, T2 val2) {
+		constexpr static auto Btr(BLOCK& block, T1 val1, T2 val2) {
 			return template_bit_operation<L>(block, detail::opcode_BTR, val1, val2);
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Btr(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Btr(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Btr: Invalid size modifier");
 			return template_bit_operation<L, SIZE>(block, detail::opcode_BTR, mem, imm);
 		}
 
 		template<LockPrefix L = NO_LOCK, class T1, class T2, class BLOCK>
-		static auto Bts(BLOCK& block, T1 val1, T2 val2) {
+		constexpr static auto Bts(BLOCK& block, T1 val1, T2 val2) {
 			return template_bit_operation<L>(block, detail::opcode_BTS, val1, val2);
 		}
 
 		template<MemSize SIZE, LockPrefix L = NO_LOCK, AddressMode MODE, class T, class BLOCK>
-		static auto Bts(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
+		constexpr static auto Bts(BLOCK& block, const Mem32<MODE>& mem, const Imm<T>& imm) {
 			static_assert(SIZE == WORD_PTR || SIZE == DWORD_PTR, "Bts: Invalid size modifier");
 			return template_bit_operation<L, SIZE>(block, detail::opcode_BTS, mem, imm);
 		}
 
 		/* Set byte if overflow (OF == 1) */
 		template<class T, class BLOCK>
-		static auto Seto(BLOCK& block, const T& val) {
+		constexpr static auto Seto(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x90, val);
 		}
 
 		/* Set byte if no overflow (OF == 0) */
 		template<class T, class BLOCK>
-		static auto Setno(BLOCK& block, const T& val) {
+		constexpr static auto Setno(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x91, val);
 		}
 
 		/* Set byte if unsigned lower (CF == 1) */
 		template<class T, class BLOCK>
-		static auto Setb(BLOCK& block, const T& val) {
+		constexpr static auto Setb(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x92, val);
 		}
 
 		/* Set byte if carry (CF == 1) */
 		template<class T, class BLOCK>
-		static auto Setc(BLOCK& block, const T& val) {
+		constexpr static auto Setc(BLOCK& block, const T& val) {
 			return Setb(block, val);
 		}
 
 		/* Set byte if unsigned not greater-equal (CF == 1) */
 		template<class T, class BLOCK>
-		static auto Setnae(BLOCK& block, const T& val) {
+		constexpr static auto Setnae(BLOCK& block, const T& val) {
 			return Setb(block, val);
 		}
 
 		/* Set byte if unsigned greater-equal (CF == 0) */
 		template<class T, class BLOCK>
-		static auto Setae(BLOCK& block, const T& val) {
+		constexpr static auto Setae(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x93, val);
 		}
 
 		/* Set byte if no carry (CF == 0) */
 		template<class T, class BLOCK>
-		static auto Setnc(BLOCK& block, const T& val) {
+		constexpr static auto Setnc(BLOCK& block, const T& val) {
 			return Setae(block, val);
 		}
 
 		/* Set byte if unsigned not lower (CF == 0) */
 		template<class T, class BLOCK>
-		static auto Setnb(BLOCK& block, const T& val) {
+		constexpr static auto Setnb(BLOCK& block, const T& val) {
 			return Setae(block, val);
 		}
 
 		/* Set byte if equal (ZF == 1) */
 		template<class T, class BLOCK>
-		static auto Sete(BLOCK& block, const T& val) {
+		constexpr static auto Sete(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x94, val);
 		}
 
 		/* Set byte if zero (ZF == 1) */
 		template<class T, class BLOCK>
-		static auto Setz(BLOCK& block, const T& val) {
+		constexpr static auto Setz(BLOCK& block, const T& val) {
 			return Sete(block, val);
 		}
 
 		/* Set byte if not equal (ZF == 0) */
 		template<class T, class BLOCK>
-		static auto Setne(BLOCK& block, const T& val) {
+		constexpr static auto Setne(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x95, val);
 		}
 
 		/* Set byte if not zero (ZF == 0) */
 		template<class T, class BLOCK>
-		static auto Setnz(BLOCK& block, const T& val) {
+		constexpr static auto Setnz(BLOCK& block, const T& val) {
 			return Setne(block, val);
 		}
 
 		/* Set byte if unsigned lower-equal (CF == 1 || ZF == 1) */
 		template<class T, class BLOCK>
-		static auto Setbe(BLOCK& block, const T& val) {
+		constexpr static auto Setbe(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x96, val);
 		}
 
 		/* Set byte if unsigned not greater (CF == 1 || ZF == 1) */
 		template<class T, class BLOCK>
-		static auto Setna(BLOCK& block, const T& val) {
+		constexpr static auto Setna(BLOCK& block, const T& val) {
 			return Setbe(block, val);
 		}
 
 		/* Set byte if unsigned greater (CF == 0 && ZF == 0) */
 		template<class T, class BLOCK>
-		static auto Seta(BLOCK& block, const T& val) {
+		constexpr static auto Seta(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x97, val);
 		}
 
 		/* Set byte if unsigned not lower-equal (CF == 0 && ZF == 0) */
 		template<class T, class BLOCK>
-		static auto Setnbe(BLOCK& block, const T& val) {
+		constexpr static auto Setnbe(BLOCK& block, const T& val) {
 			return Seta(block, val);
 		}
 
 		/* Set byte if sign (SF == 1) */
 		template<class T, class BLOCK>
-		static auto Sets(BLOCK& block, const T& val) {
+		constexpr static auto Sets(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x98, val);
 		}
 
 		/* Set byte if no sign (SF == 0) */
 		template<class T, class BLOCK>
-		static auto Setns(BLOCK& block, const T& val) {
+		constexpr static auto Setns(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x99, val);
 		}
 
 		/* Set byte if parity (PF == 1) */
 		template<class T, class BLOCK>
-		static auto Setp(BLOCK& block, const T& val) {
+		constexpr static auto Setp(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9A, val);
 		}
 
 		/* Set byte if parity (PF == 1) */
 		template<class T, class BLOCK>
-		static auto Setpe(BLOCK& block, const T& val) {
+		constexpr static auto Setpe(BLOCK& block, const T& val) {
 			return Setp(block, val);
 		}
 
 		/* Set byte if no parity (PF == 0) */
 		template<class T, class BLOCK>
-		static auto Setnp(BLOCK& block, const T& val) {
+		constexpr static auto Setnp(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9B, val);
 		}
 
 		/* Set byte if no parity (PF == 0) */
 		template<class T, class BLOCK>
-		static auto Setpo(BLOCK& block, const T& val) {
+		constexpr static auto Setpo(BLOCK& block, const T& val) {
 			return Setnp(block, val);
 		}
 
 		/* Set byte if signed lower (SF != OF) */
 		template<class T, class BLOCK>
-		static auto Setl(BLOCK& block, const T& val) {
+		constexpr static auto Setl(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9C, val);
 		}
 
 		/* Set byte if signed not greater-equal (SF != OF) */
 		template<class T, class BLOCK>
-		static auto Setnge(BLOCK& block, const T& val) {
+		constexpr static auto Setnge(BLOCK& block, const T& val) {
 			return Setl(block, val);
 		}
 
-		/* Set byte if signed greater-equal (ZF == 0 && SF == OF) */
+		/* Set byte if signed greater-equal (SF == OF) */
 		template<class T, class BLOCK>
-		static auto Setge(BLOCK& block, const T& val) {
+		constexpr static auto Setge(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9D, val);
 		}
 
 		/* Set byte if signed not lower (ZF == 0 && SF == OF) */
 		template<class T, class BLOCK>
-		static auto Setnl(BLOCK& block, const T& val) {
+		constexpr static auto Setnl(BLOCK& block, const T& val) {
 			return Setge(block, val);
 		}
 
-		/* Set byte if signed lower-equal (ZF == 1 && SF != OF) */
+		/* Set byte if signed lower-equal (ZF == 1 || SF != OF) */
 		template<class T, class BLOCK>
-		static auto Setle(BLOCK& block, const T& val) {
+		constexpr static auto Setle(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9E, val);
 		}
 
 		/* Set byte if signed not greater (ZF == 1 && SF != OF) */
 		template<class T, class BLOCK>
-		static auto Setng(BLOCK& block, const T& val) {
+		constexpr static auto Setng(BLOCK& block, const T& val) {
 			return Setle(block, val);
 		}
 
 		/* Set byte if signed greater (ZF == 0 && SF == OF) */
 		template<class T, class BLOCK>
-		static auto Setg(BLOCK& block, const T& val) {
+		constexpr static auto Setg(BLOCK& block, const T& val) {
 			return template_Setcc(block, 0x9F, val);
 		}
 
 		/* Set byte if signed not lower-equal (ZF == 0 && SF == OF) */
 		template<class T, class BLOCK>
-		static auto Setnle(BLOCK& block, const T& val) {
+		constexpr static auto Setnle(BLOCK& block, const T& val) {
 			return Setg(block, val);
 		}
 #pragma endregion
@@ -2679,7 +2714,7 @@ namespace CppAsm::X86
 		 - CALL [mem] (near/far)
 		*/
 		template<MemSize SIZE = DWORD_PTR, class T, class BLOCK>
-		static auto Call(BLOCK& block, const T& addr) {
+		constexpr static auto Call(BLOCK& block, const T& addr) {
 			return template_Call<SIZE>(block, addr);
 		}
 
@@ -2688,7 +2723,7 @@ namespace CppAsm::X86
 		 - CALL label
 		*/
 		template<class BLOCK>
-		static FwdLabel<LONG> Call(BLOCK& block) {
+		constexpr static FwdLabel<LONG> Call(BLOCK& block) {
 			common::write_Opcode(block, 0xE8);
 			Offset offset = block.getOffset();
 			block.skipBytes(FwdLabel<LONG>::offset_size);
@@ -2699,7 +2734,7 @@ namespace CppAsm::X86
 		 - CALL imm16:32
 		*/
 		template<class BLOCK>
-		static void Call(BLOCK& block, S16 sel, S32 addr) {
+		constexpr static void Call(BLOCK& block, S16 sel, S32 addr) {
 			common::write_Opcode(block, 0x9A);
 			common::write_Immediate(block, addr);
 			common::write_Immediate(block, sel);
@@ -2710,7 +2745,7 @@ namespace CppAsm::X86
 		 - JMP [mem]
 		*/
 		template<MemSize SIZE = DWORD_PTR, class T, class BLOCK>
-		static auto Jmp(BLOCK& block, const T& addr) {
+		constexpr static auto Jmp(BLOCK& block, const T& addr) {
 			return template_Jmp<SIZE>(block, addr);
 		}
 
@@ -2719,7 +2754,7 @@ namespace CppAsm::X86
 		 - JMP label
 		*/
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jmp(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jmp(BLOCK& block) {
 			return template_Jmp<SIZE>(block);
 		}
 
@@ -2727,7 +2762,7 @@ namespace CppAsm::X86
 		 - JMP imm16:32
 		*/
 		template<class BLOCK>
-		static void Jmp(BLOCK& block, S16 sel, S32 addr) {
+		constexpr static void Jmp(BLOCK& block, S16 sel, S32 addr) {
 			common::write_Opcode(block, 0xEA);
 			common::write_Immediate(block, addr);
 			common::write_Immediate(block, sel);
@@ -2735,181 +2770,181 @@ namespace CppAsm::X86
 
 		/* Jump in overflow (OF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jo(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jo(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x70);
 		}
 
 		/* Jump in no overflow (OF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jno(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jno(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x71);
 		}
 
 		/* Jump if unsigned lower (CF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jb(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jb(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x72);
 		}
 
 		/* Jump if carry (CF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jc(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jc(BLOCK& block) {
 			return Jb<SIZE>(block);
 		}
 
 		/* Jump if unsigned not greater-equal (CF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnae(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnae(BLOCK& block) {
 			return Jb<SIZE>(block);
 		}
 
 		/* Jump if unsigned greater-equal (CF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jae(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jae(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x73);
 		}
 
 		/* Jump if no carry (CF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnc(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnc(BLOCK& block) {
 			return Jae<SIZE>(block);
 		}
 
 		/* Jump if unsigned not lower (CF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnb(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnb(BLOCK& block) {
 			return Jae<SIZE>(block);
 		}
 
 		/* Jump if equal (ZF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Je(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Je(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x74);
 		}
 
 		/* Jump if zero (ZF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jz(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jz(BLOCK& block) {
 			return Je<SIZE>(block);
 		}
 
 		/* Jump if not equal (ZF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jne(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jne(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x75);
 		}
 
 		/* Jump if not zero (ZF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnz(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnz(BLOCK& block) {
 			return Jne<SIZE>(block);
 		}
 
 		/* Jump if unsigned lower-equal (CF == 1 || ZF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jbe(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jbe(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x76);
 		}
 
 		/* Jump if unsigned not greater (CF == 1 || ZF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jna(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jna(BLOCK& block) {
 			return Jbe<SIZE>(block);
 		}
 
 		/* Jump if unsigned greater (CF == 0 && ZF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Ja(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Ja(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x77);
 		}
 
 		/* Jump if unsigned not lower-equal (CF == 0 && ZF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnbe(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnbe(BLOCK& block) {
 			return Ja<SIZE>(block);
 		}
 
 		/* Jump if sign (SF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Js(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Js(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x78);
 		}
 
 		/* Jump if no sign (SF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jns(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jns(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x79);
 		}
 
 		/* Jump if parity (PF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jp(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jp(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7A);
 		}
 
 		/* Jump if parity (PF == 1) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jpe(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jpe(BLOCK& block) {
 			return Jp<SIZE>(block);
 		}
 
 		/* Jump if no parity (PF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnp(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnp(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7B);
 		}
 
 		/* Jump if no parity (PF == 0) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jpo(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jpo(BLOCK& block) {
 			return Jnp<SIZE>(block);
 		}
 
 		/* Jump if signed lower (SF != OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jl(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jl(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7C);
 		}
 
 		/* Jump if signed not greater-equal (SF != OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnge(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnge(BLOCK& block) {
 			return Jl<SIZE>(block);
 		}
 
-		/* Jump if signed greater-equal (ZF == 0 && SF == OF) */
+		/* Jump if signed greater-equal (SF == OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jge(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jge(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7D);
 		}
 
 		/* Jump if signed not lower (ZF == 0 && SF == OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnl(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnl(BLOCK& block) {
 			return Jge<SIZE>(block);
 		}
 
-		/* Jump if signed lower-equal (ZF == 1 && SF != OF) */
+		/* Jump if signed lower-equal (ZF == 1 || SF != OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jle(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jle(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7E);
 		}
 
 		/* Jump if signed not greater (ZF == 1 && SF != OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jng(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jng(BLOCK& block) {
 			return Jle<SIZE>(block);
 		}
 
 		/* Jump if signed greater (ZF == 0 && SF == OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jg(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jg(BLOCK& block) {
 			return template_Jxx<SIZE>(block, 0x7F);
 		}
 
 		/* Jump if signed not lower-equal (ZF == 0 && SF == OF) */
 		template<JmpSize SIZE = SHORT, class BLOCK>
-		static FwdLabel<SIZE> Jnle(BLOCK& block) {
+		constexpr static FwdLabel<SIZE> Jnle(BLOCK& block) {
 			return Jg<SIZE>(block);
 		}
 
@@ -2917,7 +2952,7 @@ namespace CppAsm::X86
 		 - INT imm
 		*/
 		template<class BLOCK>
-		static ReplaceableValue<U8::type> Int(BLOCK& block, U8 number) {
+		constexpr static ReplaceableValue<U8::type> Int(BLOCK& block, U8 number) {
 			common::write_Opcode(block, 0xCD);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, number);
@@ -2926,25 +2961,25 @@ namespace CppAsm::X86
 
 		/* Launch interrupt number 3 */
 		template<class BLOCK>
-		static void Int3(BLOCK& block) {
+		constexpr static void Int3(BLOCK& block) {
 			common::write_Opcode(block, 0xCC);
 		}
 
 		/* Launch interrupt number 4 if overflow flag (OF) is set */
 		template<class BLOCK>
-		static void IntO(BLOCK& block) {
+		constexpr static void IntO(BLOCK& block) {
 			common::write_Opcode(block, 0xCE);
 		}
 
 		/* Return from interrupt */
 		template<class BLOCK>
-		static void Iret(BLOCK& block) {
+		constexpr static void Iret(BLOCK& block) {
 			common::write_Opcode(block, 0xCF);
 		}
 
 		/* Create enter procedure stack frame */
 		template<class BLOCK>
-		static auto Enter(BLOCK& block, U16 size, U8 level) {
+		constexpr static auto Enter(BLOCK& block, U16 size, U8 level) {
 			common::write_Opcode(block, 0xC8);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, size);
@@ -2955,19 +2990,19 @@ namespace CppAsm::X86
 
 		/* Create leave procedure stack frame */
 		template<class BLOCK>
-		static void Leave(BLOCK& block) {
+		constexpr static void Leave(BLOCK& block) {
 			common::write_Opcode(block, 0xC9);
 		}
 
 		/* Return from near procedure */
 		template<class BLOCK>
-		static void Ret(BLOCK& block) {
+		constexpr static void Ret(BLOCK& block) {
 			common::write_Opcode(block, 0xC3);
 		}
 
 		/* Return from near procedure */
 		template<class BLOCK>
-		static ReplaceableValue<U16::type> Ret(BLOCK& block, U16 number) {
+		constexpr static ReplaceableValue<U16::type> Ret(BLOCK& block, U16 number) {
 			common::write_Opcode(block, 0xC2);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, number);
@@ -2976,25 +3011,25 @@ namespace CppAsm::X86
 
 		/* Return from near procedure */
 		template<class BLOCK>
-		static void Retn(BLOCK& block) {
+		constexpr static void Retn(BLOCK& block) {
 			Ret(block);
 		}
 
 		/* Return from near procedure */
 		template<class BLOCK>
-		static auto Retn(BLOCK& block, U16 number) {
+		constexpr static auto Retn(BLOCK& block, U16 number) {
 			return Ret(block, number);
 		}
 
 		/* Return from far procedure */
 		template<class BLOCK>
-		static void Retf(BLOCK& block) {
+		constexpr static void Retf(BLOCK& block) {
 			common::write_Opcode(block, 0xCB);
 		}
 
 		/* Return from far procedure */
 		template<class BLOCK>
-		static ReplaceableValue<U16::type> Retf(BLOCK& block, U16 number) {
+		constexpr static ReplaceableValue<U16::type> Retf(BLOCK& block, U16 number) {
 			common::write_Opcode(block, 0xCA);
 			Offset offset = block.getOffset();
 			common::write_Immediate(block, number);
@@ -3003,44 +3038,44 @@ namespace CppAsm::X86
 
 		/* Jump if ECX == 0 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Jecxz(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Jecxz(BLOCK& block) {
 			return template_Loop<SHORT>(block, 0xE3);
 		}
 
 		/* Jump if CX == 0 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Jcxz(BLOCK& block) {
-			block.pushRaw<uint8_t>(0x67);
+		constexpr static FwdLabel<SHORT> Jcxz(BLOCK& block) {
+			block.template pushRaw<uint8_t>(0x67);
 			return Jecxz(block);
 		}
 
 		/* Decrement ECX and jump if ECX != 0 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Loop(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Loop(BLOCK& block) {
 			return template_Loop<SHORT>(block, 0xE2);
 		}
 
 		/* Decrement ECX and jump if ECX != 0 and ZF == 1 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Loope(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Loope(BLOCK& block) {
 			return template_Loop<SHORT>(block, 0xE1);
 		}
 
 		/* Decrement ECX and jump if ECX != 0 and ZF == 1 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Loopz(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Loopz(BLOCK& block) {
 			return Loope(block);
 		}
 
 		/* Decrement ECX and jump if ECX != 0 and ZF == 0 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Loopne(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Loopne(BLOCK& block) {
 			return template_Loop<SHORT>(block, 0xE0);
 		}
 
 		/* Decrement ECX and jump if ECX != 0 and ZF == 0 */
 		template<class BLOCK>
-		static FwdLabel<SHORT> Loopnz(BLOCK& block) {
+		constexpr static FwdLabel<SHORT> Loopnz(BLOCK& block) {
 			return Loopne(block);
 		}
 #pragma endregion
@@ -3048,63 +3083,63 @@ namespace CppAsm::X86
 #pragma region Flags manipulations [DONE]
 		/* Reset carry flag (CF) */
 		template<class BLOCK>
-		static void Clc(BLOCK& block) {
+		constexpr static void Clc(BLOCK& block) {
 			common::write_Opcode(block, 0xF8);
 		}
 
 		/* Reset direction flag (DF) */
 		template<class BLOCK>
-		static void Cld(BLOCK& block) {
+		constexpr static void Cld(BLOCK& block) {
 			common::write_Opcode(block, 0xFC);
 		}
 
 		/* Clear interrupt flag (IF) */
 		template<class BLOCK>
-		static void Cli(BLOCK& block) {
+		constexpr static void Cli(BLOCK& block) {
 			common::write_Opcode(block, 0xFA);
 		}
 
 		/* Invert carry flag (CF) */
 		template<class BLOCK>
-		static void Cmc(BLOCK& block) {
+		constexpr static void Cmc(BLOCK& block) {
 			common::write_Opcode(block, 0xF5);
 		}
 
 		/* Load flags to register AH */
 		template<class BLOCK>
-		static void Lahf(BLOCK& block) {
+		constexpr static void Lahf(BLOCK& block) {
 			common::write_Opcode(block, 0x9F);
 		}
 
 		/* Save FLAGS to stack */
 		template<class BLOCK>
-		static void Pushf(BLOCK& block) {
+		constexpr static void Pushf(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x9C);
 		}
 
 		/* Save EFLAGS to stack */
 		template<class BLOCK>
-		static void Pushfd(BLOCK& block) {
+		constexpr static void Pushfd(BLOCK& block) {
 			common::write_Opcode(block, 0x9C);
 		}
 
 		/* Load FLAGS from stack */
 		template<class BLOCK>
-		static void Popf(BLOCK& block) {
+		constexpr static void Popf(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x9D);
 		}
 
 		/* Load EFLAGS from stack */
 		template<class BLOCK>
-		static void Popfd(BLOCK& block) {
+		constexpr static void Popfd(BLOCK& block) {
 			common::write_Opcode(block, 0x9D);
 		}
 
 		/* Store register AH to flags */
 		template<class BLOCK>
-		static void Sahf(BLOCK& block) {
+		constexpr static void Sahf(BLOCK& block) {
 			common::write_Opcode(block, 0x9E);
 		}
 
@@ -3112,25 +3147,25 @@ namespace CppAsm::X86
 		 - Remark: Not documented Intel instruction
 		*/
 		template<class BLOCK>
-		static void Salc(BLOCK& block) {
+		constexpr static void Salc(BLOCK& block) {
 			common::write_Opcode(block, 0xD6);
 		}
 
 		/* Set carry flag (CF) */
 		template<class BLOCK>
-		static void Stc(BLOCK& block) {
+		constexpr static void Stc(BLOCK& block) {
 			common::write_Opcode(block, 0xF9);
 		}
 
 		/* Set direction flag (DF) */
 		template<class BLOCK>
-		static void Std(BLOCK& block) {
+		constexpr static void Std(BLOCK& block) {
 			common::write_Opcode(block, 0xFD);
 		}
 
 		/* Set interrupt flag (IF) */
 		template<class BLOCK>
-		static void Sti(BLOCK& block) {
+		constexpr static void Sti(BLOCK& block) {
 			common::write_Opcode(block, 0xFB);
 		}
 #pragma endregion
@@ -3138,114 +3173,114 @@ namespace CppAsm::X86
 #pragma region String operations
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Insb(BLOCK& block) {
+		constexpr static void Insb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0x6C);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Insw(BLOCK& block) {
+		constexpr static void Insw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0x6D);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Insd(BLOCK& block) {
+		constexpr static void Insd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0x6D);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Outsb(BLOCK& block) {
+		constexpr static void Outsb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0x6E);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Outsw(BLOCK& block) {
+		constexpr static void Outsw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0x6F);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Outsd(BLOCK& block) {
+		constexpr static void Outsd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0x6F);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Lodsb(BLOCK& block) {
+		constexpr static void Lodsb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAC);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Lodsw(BLOCK& block) {
+		constexpr static void Lodsw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0xAD);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Lodsd(BLOCK& block) {
+		constexpr static void Lodsd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAD);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Movsb(BLOCK& block) {
+		constexpr static void Movsb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xA4);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Movsw(BLOCK& block) {
+		constexpr static void Movsw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0xA5);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Movsd(BLOCK& block) {
+		constexpr static void Movsd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xA5);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Scasb(BLOCK& block) {
+		constexpr static void Scasb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAE);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Scasw(BLOCK& block) {
+		constexpr static void Scasw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0xAF);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Scasd(BLOCK& block) {
+		constexpr static void Scasd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAF);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Stosb(BLOCK& block) {
+		constexpr static void Stosb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAA);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Stosw(BLOCK& block) {
+		constexpr static void Stosw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0xAB);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Stosd(BLOCK& block) {
+		constexpr static void Stosd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xAB);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Cmpsb(BLOCK& block) {
+		constexpr static void Cmpsb(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xA6);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Cmpsw(BLOCK& block) {
+		constexpr static void Cmpsw(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode_Rep<R>(block, 0xA7);
 		}
 
 		template<RepPrefix R = NO_REP, class BLOCK>
-		static void Cmpsd(BLOCK& block) {
+		constexpr static void Cmpsd(BLOCK& block) {
 			common::write_Opcode_Rep<R>(block, 0xA7);
 		}
 
@@ -3253,31 +3288,31 @@ namespace CppAsm::X86
 
 #pragma region Load segment registers
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Lds(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Lds(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Lds: First parameter is not register");
 			template_LoadSegReg(block, 0xC5, reg, mem);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Les(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Les(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Les: First parameter is not register");
 			template_LoadSegReg(block, 0xC4, reg, mem);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Lfs(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Lfs(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Lfs: First parameter is not register");
 			template_LoadSegRegEx(block, 0xB4, reg, mem);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Lgs(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Lgs(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Lgs: First parameter is not register");
 			template_LoadSegRegEx(block, 0xB5, reg, mem);
 		}
 
 		template<class REG, AddressMode MODE, class BLOCK>
-		static void Lss(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
+		constexpr static void Lss(BLOCK& block, REG reg, const Mem32<MODE>& mem) {
 			static_assert(IsRegType<REG>::value, "Lss: First parameter is not register");
 			template_LoadSegRegEx(block, 0xB2, reg, mem);
 		}
@@ -3286,12 +3321,12 @@ namespace CppAsm::X86
 #pragma region Other operations
 		/* TODO: Lock processor memory bus */
 		template<class BLOCK>
-		static void Lock(BLOCK& block) {
+		constexpr static void Lock(BLOCK& block) {
 			common::write_Opcode(block, 0xF0);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Bound(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void Bound(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x62);
@@ -3299,7 +3334,7 @@ namespace CppAsm::X86
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Bound(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void Bound(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode(block, 0x62);
 			mem.write(block, reg);
@@ -3307,33 +3342,39 @@ namespace CppAsm::X86
 
 		/* No operation */
 		template<class BLOCK>
-		static void Nop(BLOCK& block) {
+		constexpr static void Nop(BLOCK& block) {
 			common::write_Opcode(block, 0x90);
 		}
 
 		/* No operation */
 		template<class BLOCK>
-		static void Nop(BLOCK& block, Size count) {
+		constexpr static void Nop(BLOCK& block, Size count) {
 			for (; count > 0; count--) {
 				common::write_Opcode(block, 0x90);
 			}
 		}
 
+		/* Spin-wait loop hint (REP NOP), executed as NOP by processors without SSE2 */
+		template<class BLOCK>
+		constexpr static void Pause(BLOCK& block) {
+			common::write_Opcode_Rep<REP>(block, 0x90);
+		}
+
 		/* FPU wait */
 		template<class BLOCK>
-		static void Fwait(BLOCK& block) {
+		constexpr static void Fwait(BLOCK& block) {
 			Wait(block);
 		}
 
 		/* FPU wait */
 		template<class BLOCK>
-		static void Wait(BLOCK& block) {
+		constexpr static void Wait(BLOCK& block) {
 			common::write_Opcode(block, 0x9B);
 		}
 
 		/* Halt processor */
 		template<class BLOCK>
-		static void Hlt(BLOCK& block) {
+		constexpr static void Hlt(BLOCK& block) {
 			common::write_Opcode(block, 0xF4);
 		}
 #pragma endregion
@@ -3343,7 +3384,7 @@ namespace CppAsm::X86
 		 - ARPL reg,reg 
 		*/
 		template<class BLOCK>
-		static void Arpl(BLOCK& block, Reg16 reg1, Reg16 reg2) {
+		constexpr static void Arpl(BLOCK& block, Reg16 reg1, Reg16 reg2) {
 			common::write_Opcode(block, 0x63);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, reg2, reg1);
 		}
@@ -3352,7 +3393,7 @@ namespace CppAsm::X86
 		 - ARPL [mem],reg 
 		*/
 		template<AddressMode MODE, class BLOCK>
-		static void Arpl(BLOCK& block, const Mem32<MODE>& mem, Reg16 reg) {
+		constexpr static void Arpl(BLOCK& block, const Mem32<MODE>& mem, Reg16 reg) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode(block, 0x63);
 			mem.write(block, reg);
@@ -3360,174 +3401,174 @@ namespace CppAsm::X86
 
 		/* Clears Task-Switched Flag in CR0. */
 		template<class BLOCK>
-		static void Clts(BLOCK& block) {
+		constexpr static void Clts(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x06);
 		}
 
 		template<class BLOCK>
-		static void Lar(BLOCK& block, Reg16 reg1, Reg16 reg2) {
+		constexpr static void Lar(BLOCK& block, Reg16 reg1, Reg16 reg2) {
 			template_2_operands_ext(block, 0x02, reg1, reg2);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Lar(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void Lar(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
 			template_2_operands_ext(block, 0x02, reg, mem);
 		}
 
 		template<class BLOCK>
-		static void Lar(BLOCK& block, Reg32 reg1, Reg32 reg2) {
+		constexpr static void Lar(BLOCK& block, Reg32 reg1, Reg32 reg2) {
 			template_2_operands_ext(block, 0x02, reg1, reg2);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Lar(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void Lar(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
 			template_2_operands_ext(block, 0x02, reg, mem);
 		}
 
 		/* Load mem into GDTR */
 		template<AddressMode MODE, class BLOCK>
-		static void Lgdt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Lgdt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_LGDT, mem);
 		}
 
 		/* Load mem into LIDT */
 		template<AddressMode MODE, class BLOCK>
-		static void Lidt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Lidt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_LIDT, mem);
 		}
 
 		/* Load mem into LLDT */
 		template<AddressMode MODE, class BLOCK>
-		static void Lldt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Lldt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_LLDT, mem);
 		}
 
 		/* Load register into LLDT */
 		template<class BLOCK>
-		static void Lldt(BLOCK& block, Reg16 reg) {
+		constexpr static void Lldt(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_LLDT, (Reg32)reg);
 		}
 
 		/* Load mem in machine status word of CR0 */
 		template<AddressMode MODE, class BLOCK>
-		static void Lmsw(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Lmsw(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_LMSW, mem);
 		}
 
 		/* Load register in machine status word of CR0 */
 		template<class BLOCK>
-		static void Lmsw(BLOCK& block, Reg16 reg) {
+		constexpr static void Lmsw(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_LMSW, (Reg32)reg);
 		}
 
 		template<class BLOCK>
-		static void Lsl(BLOCK& block, Reg16 reg1, Reg16 reg2) {
+		constexpr static void Lsl(BLOCK& block, Reg16 reg1, Reg16 reg2) {
 			template_2_operands_ext(block, 0x03, reg1, reg2);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Lsl(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
+		constexpr static void Lsl(BLOCK& block, Reg16 reg, const Mem32<MODE>& mem) {
 			template_2_operands_ext(block, 0x03, reg, mem);
 		}
 
 		template<class BLOCK>
-		static void Lsl(BLOCK& block, Reg32 reg1, Reg32 reg2) {
+		constexpr static void Lsl(BLOCK& block, Reg32 reg1, Reg32 reg2) {
 			template_2_operands_ext(block, 0x03, reg1, reg2);
 		}
 
 		template<AddressMode MODE, class BLOCK>
-		static void Lsl(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
+		constexpr static void Lsl(BLOCK& block, Reg32 reg, const Mem32<MODE>& mem) {
 			template_2_operands_ext(block, 0x03, reg, mem);
 		}
 
 		/* Load task register */
 		template<AddressMode MODE, class BLOCK>
-		static void Ltr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Ltr(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_LTR, mem);
 		}
 
 		/* Load task register */
 		template<class BLOCK>
-		static void Ltr(BLOCK& block, Reg16 reg) {
+		constexpr static void Ltr(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_LTR, (Reg32)reg);
 		}
 
 		/* Store global descriptor table */
 		template<AddressMode MODE, class BLOCK>
-		static void Sgdt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Sgdt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_SGDT, mem);
 		}
 
 		/* Store interrupt descriptor table */
 		template<AddressMode MODE, class BLOCK>
-		static void Sidt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Sidt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_SIDT, mem);
 		}
 
 		/* Store local descriptor table */
 		template<AddressMode MODE, class BLOCK>
-		static void Sldt(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Sldt(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_SLDT, mem);
 		}
 
 		/* Store local descriptor table */
 		template<class BLOCK>
-		static void Sldt(BLOCK& block, Reg16 reg) {
+		constexpr static void Sldt(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_SLDT, (Reg32)reg);
 		}
 
 		/* Store Machine Status Word */
 		template<AddressMode MODE, class BLOCK>
-		static void Smsw(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Smsw(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_SMSW, mem);
 		}
 
 		/* Store Machine Status Word */
 		template<class BLOCK>
-		static void Smsw(BLOCK& block, Reg32 reg) {
+		constexpr static void Smsw(BLOCK& block, Reg32 reg) {
 			template_1reg_ext_operand(block, detail::opcode_SMSW, reg);
 		}
 
 		/* Store Machine Status Word */
 		template<class BLOCK>
-		static void Smsw(BLOCK& block, Reg16 reg) {
+		constexpr static void Smsw(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_SMSW, reg);
 		}
 
 		/* Store Task Register */
 		template<AddressMode MODE, class BLOCK>
-		static void Str(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Str(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_STR, mem);
 		}
 
 		/* Store Task Register */
 		template<class BLOCK>
-		static void Str(BLOCK& block, Reg16 reg) {
+		constexpr static void Str(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_STR, (Reg32)reg);
 		}
 
 		/* Verify a Segment for Reading */
 		template<AddressMode MODE, class BLOCK>
-		static void Verr(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Verr(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_VERR, mem);
 		}
 
 		/* Verify a Segment for Reading */
 		template<class BLOCK>
-		static void Verr(BLOCK& block, Reg16 reg) {
+		constexpr static void Verr(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_VERR, (Reg32)reg);
 		}
 
 		/* Verify a Segment for Writing */
 		template<AddressMode MODE, class BLOCK>
-		static void Verw(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Verw(BLOCK& block, const Mem32<MODE>& mem) {
 			template_1mem_ext_operand<DWORD_PTR>(block, detail::opcode_VERW, mem);
 		}
 
 		/* Verify a Segment for Writing */
 		template<class BLOCK>
-		static void Verw(BLOCK& block, Reg16 reg) {
+		constexpr static void Verw(BLOCK& block, Reg16 reg) {
 			template_1reg_ext_operand(block, detail::opcode_VERW, (Reg32)reg);
 		}
 #pragma endregion
@@ -8,7 +8,7 @@ namespace CppAsm::X86
 	public:
 		/* Swap bytes inside register */
 		template<class BLOCK>
-		static ReplaceableReg<Reg32> Bswap(BLOCK& block, Reg32 reg) {
+		constexpr static ReplaceableReg<Reg32> Bswap(BLOCK& block, Reg32 reg) {
 			common::write_Opcode_Extended_Prefix(block);
 			Offset offset = block.getOffset();
 			common::write_Opcode(block, 0xC8 | reg);
@@ -19,7 +19,7 @@ namespace CppAsm::X86
 		 - XADD reg,reg
 		*/
 		template<class REG, class BLOCK>
-		static void Xadd(BLOCK& block, const REG& dst, const REG& src) {
+		constexpr static void Xadd(BLOCK& block, const REG& dst, const REG& src) {
 			static_assert(IsRegType<REG>::value, "Xadd: First and second parameter is not register");
 			write_Opcode_Extended<TypeMemSize<REG>::value>(block, 0xC0);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, src, dst);
@@ -29,7 +29,7 @@ namespace CppAsm::X86
 		 - XADD [mem],reg
 		*/
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
-		static void Xadd(BLOCK& block, const Mem32<MODE>& mem, const REG& reg) {
+		constexpr static void Xadd(BLOCK& block, const Mem32<MODE>& mem, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "Xadd: Second parameter is not register");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Extended<TypeMemSize<REG>::value, L>(block, 0xC0);
@@ -40,7 +40,7 @@ namespace CppAsm::X86
 		 - CMPXCHG reg,reg
 		*/
 		template<class REG, class BLOCK>
-		static void CmpXchg(BLOCK& block, const REG& dst, const REG& src) {
+		constexpr static void CmpXchg(BLOCK& block, const REG& dst, const REG& src) {
 			static_assert(IsRegType<REG>::value, "CmpXchg: First and second parameter is not register");
 			write_Opcode_Extended<TypeMemSize<REG>::value>(block, 0xB0);
 			common::write_MOD_REG_RM(block, common::MOD_REG_RM::REG_ADDR, src, dst);
@@ -50,7 +50,7 @@ namespace CppAsm::X86
 		 - CMPXCHG [mem],reg
 		*/
 		template<LockPrefix L = NO_LOCK, AddressMode MODE, class REG, class BLOCK>
-		static void CmpXchg(BLOCK& block, const Mem32<MODE>& mem, const REG& reg) {
+		constexpr static void CmpXchg(BLOCK& block, const Mem32<MODE>& mem, const REG& reg) {
 			static_assert(IsRegType<REG>::value, "CmpXchg: Second parameter is not register");
 			mem.writeSegmPrefix(block);
 			write_Opcode_Extended<TypeMemSize<REG>::value, L>(block, 0xB0);
@@ -60,21 +60,21 @@ namespace CppAsm::X86
 		/* Returns processor identification and feature information to the EAX, EBX, ECX, and EDX registers, 
 		 * according to the input value entered initially in the EAX register. */
 		template<class BLOCK>
-		static void Cpuid(BLOCK& block) {
+		constexpr static void Cpuid(BLOCK& block) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0xA2);
 		}
 
 		/* Flush internal caches; initiate flushing of external caches. */
 		template<class BLOCK>
-		static void Invd(BLOCK& block) {
+		constexpr static void Invd(BLOCK& block) {
 			common::write_Opcode_16bit_Prefix(block);
 			common::write_Opcode(block, 0x08);
 		}
 
 		/* Invalidate TLB Entry for page that contains mem */
 		template<AddressMode MODE, class BLOCK>
-		static void Invlpg(BLOCK& block, const Mem32<MODE>& mem) {
+		constexpr static void Invlpg(BLOCK& block, const Mem32<MODE>& mem) {
 			mem.writeSegmPrefix(block);
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0x01);
@@ -83,7 +83,7 @@ namespace CppAsm::X86
 
 		/* Write Back and Invalidate Cache */
 		template<class BLOCK>
-		static void Wbinvd(BLOCK& block) {
+		constexpr static void Wbinvd(BLOCK& block) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0x09);
 		}
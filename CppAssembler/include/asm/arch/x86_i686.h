@@ -13,27 +13,27 @@ namespace CppAsm::X86
 	class i686 : public i586, public i387, public CMOV {
 	public:
 		template<class BLOCK>
-		static void Fcomi(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcomi(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_1operand_float(block, detail::OpcodeLarge(0xDB, 0b110), reg);
 		}
 
 		template<class BLOCK>
-		static void Fcomip(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fcomip(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_1operand_float(block, detail::OpcodeLarge(0xDF, 0b110), reg);
 		}
 
 		template<class BLOCK>
-		static void Fucomi(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fucomi(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_1operand_float(block, detail::OpcodeLarge(0xDB, 0b101), reg);
 		}
 
 		template<class BLOCK>
-		static void Fucomip(BLOCK& block, TopRegFPU, RegFPU reg) {
+		constexpr static void Fucomip(BLOCK& block, TopRegFPU, RegFPU reg) {
 			template_1operand_float(block, detail::OpcodeLarge(0xDF, 0b101), reg);
 		}
 
 		template<class BLOCK>
-		static void Ud2(BLOCK& block) {
+		constexpr static void Ud2(BLOCK& block) {
 			common::write_Opcode_Extended_Prefix(block);
 			common::write_Opcode(block, 0x0B);
 		}
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace CppAsm
 {
@@ -30,4 +32,19 @@ namespace CppAsm
 	typedef Imm<uint16_t> U16;
 	typedef Imm<uint32_t> U32;
 	typedef Imm<uint64_t> U64;
+
+	/* Block which records relocations of rel32 fields written by encoders (see Os::RelocatingBlock) */
+	template<class BLOCK, class = void>
+	struct IsRelocatingBlock : std::false_type {};
+
+	template<class BLOCK>
+	struct IsRelocatingBlock<BLOCK, std::void_t<decltype(std::declval<BLOCK&>().addRel32(Offset(), Addr()))>> : std::true_type {};
+
+	/* Notify block that rel32 field at current write position refers to target */
+	template<class BLOCK>
+	constexpr void recordRel32(BLOCK& block, Addr target) {
+		if constexpr (IsRelocatingBlock<BLOCK>::value) {
+			block.addRel32(block.getOffset(), target);
+		}
+	}
 }
\ No newline at end of file
@@ -0,0 +1,411 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "os.h"
+#include "arch/x64_i386.h"
+
+namespace CppAsm::Os
+{
+	enum DecodeMode {
+		DECODE_X86,
+		DECODE_X64
+	};
+
+	/* Layout of decoded instruction needed to copy it to other address */
+	struct InstructionInfo {
+		uint8_t size;			// total size in bytes
+		uint8_t opcodeOffset;	// offset of opcode after prefixes
+		uint8_t relOffset;		// offset of relative field
+		uint8_t relSize;		// size of relative field (rel8, rel32, disp32 of [rip]), 0 if none
+		bool ripRelative;		// relative field is disp32 of [rip+disp] operand
+	};
+
+	/* Decode length and relative operand of general purpose instruction (x87 included).
+	 * In case instruction uses VEX/EVEX, 16-bit addressing or far pointer return false
+	 */
+	template<DecodeMode MODE>
+	bool decodeInstruction(Addr code, InstructionInfo& info) {
+		constexpr Size MAX_SIZE = 15;
+		bool operandSize16 = false;
+		bool addressPrefix = false;
+		bool rexW = false;
+		Size pos = 0;
+		for (;; pos++) {
+			if (pos >= MAX_SIZE) {
+				return false;
+			}
+			uint8_t prefix = code[pos];
+			if (prefix == 0x66) {
+				operandSize16 = true;
+			} else if (prefix == 0x67) {
+				addressPrefix = true;
+			} else if (prefix != 0xF0 && prefix != 0xF2 && prefix != 0xF3 && prefix != 0x2E && prefix != 0x36 &&
+				prefix != 0x3E && prefix != 0x26 && prefix != 0x64 && prefix != 0x65) {
+				break;
+			}
+		}
+		bool addressSize16 = addressPrefix && (MODE == DECODE_X86);
+		if (MODE == DECODE_X64 && (code[pos] & 0xF0) == 0x40) {
+			rexW = (code[pos] & 0x08) != 0;
+			pos++;
+		}
+		info = InstructionInfo();
+		info.opcodeOffset = static_cast<uint8_t>(pos);
+		uint8_t opcode = code[pos++];
+		// REX.W overrides operand size prefix
+		Size immZ = rexW ? 4 : (operandSize16 ? 2 : 4);
+		Size immSize = 0;
+		Size relSize = 0;
+		bool modRM = false;
+		if (opcode == 0x0F) {
+			opcode = code[pos++];
+			if (opcode == 0x38) {
+				pos++;
+				modRM = true;
+			} else if (opcode == 0x3A) {
+				pos++;
+				modRM = true;
+				immSize = 1;
+			} else if (opcode >= 0x80 && opcode <= 0x8F) {
+				if (operandSize16) {
+					return false;
+				}
+				relSize = 4;
+			} else if (opcode == 0x0F) {
+				return false;
+			} else if (opcode == 0x05 || opcode == 0x06 || opcode == 0x07 || opcode == 0x08 || opcode == 0x09 ||
+				opcode == 0x0B || opcode == 0x0E || (opcode >= 0x30 && opcode <= 0x37) || opcode == 0x77 ||
+				opcode == 0xA0 || opcode == 0xA1 || opcode == 0xA2 || opcode == 0xA8 || opcode == 0xA9 ||
+				opcode == 0xAA || (opcode >= 0xC8 && opcode <= 0xCF)) {
+				// no operands
+			} else {
+				modRM = true;
+				if ((opcode >= 0x70 && opcode <= 0x73) || opcode == 0xA4 || opcode == 0xAC || opcode == 0xBA ||
+					opcode == 0xC2 || opcode == 0xC4 || opcode == 0xC5 || opcode == 0xC6) {
+					immSize = 1;
+				}
+			}
+		} else if (opcode < 0x40) {
+			switch (opcode & 0x07) {
+			case 0: case 1: case 2: case 3:
+				modRM = true;
+				break;
+			case 4:
+				immSize = 1;
+				break;
+			case 5:
+				immSize = immZ;
+				break;
+			default:
+				// push/pop segment, BCD adjust
+				if (MODE == DECODE_X64) {
+					return false;
+				}
+				break;
+			}
+		} else if (opcode < 0x60) {
+			// inc/dec/push/pop reg (0x40-0x4F is REX prefix in x64)
+			if (MODE == DECODE_X64 && opcode < 0x50) {
+				return false;
+			}
+		} else if (opcode >= 0x70 && opcode <= 0x7F) {
+			relSize = 1;
+		} else if (opcode >= 0x84 && opcode <= 0x8F) {
+			modRM = true;
+		} else if (opcode >= 0xB0 && opcode <= 0xB7) {
+			immSize = 1;
+		} else if (opcode >= 0xB8 && opcode <= 0xBF) {
+			immSize = rexW ? 8 : immZ;
+		} else if (opcode >= 0xD8 && opcode <= 0xDF) {
+			modRM = true;
+		} else {
+			switch (opcode) {
+			case 0x60: case 0x61: case 0xCE:
+				if (MODE == DECODE_X64) {
+					return false;
+				}
+				break;
+			case 0x63: case 0xD0: case 0xD1: case 0xD2: case 0xD3: case 0xF6: case 0xF7: case 0xFE: case 0xFF:
+				modRM = true;
+				break;
+			case 0x68:
+				immSize = immZ;
+				break;
+			case 0x69: case 0x81: case 0xC7:
+				modRM = true;
+				immSize = immZ;
+				break;
+			case 0x6A: case 0xA8: case 0xCD: case 0xE4: case 0xE5: case 0xE6: case 0xE7:
+				immSize = 1;
+				break;
+			case 0x6B: case 0x80: case 0x83: case 0xC0: case 0xC1: case 0xC6:
+				modRM = true;
+				immSize = 1;
+				break;
+			case 0x82:
+				if (MODE == DECODE_X64) {
+					return false;
+				}
+				modRM = true;
+				immSize = 1;
+				break;
+			case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+				if (addressSize16) {
+					return false;
+				}
+				immSize = (MODE == DECODE_X64 && !addressPrefix) ? 8 : 4;
+				break;
+			case 0xA9:
+				immSize = immZ;
+				break;
+			case 0xC2: case 0xCA:
+				immSize = 2;
+				break;
+			case 0xC8:
+				immSize = 3;
+				break;
+			case 0xE0: case 0xE1: case 0xE2: case 0xE3: case 0xEB:
+				relSize = 1;
+				break;
+			case 0xE8: case 0xE9:
+				if (operandSize16) {
+					return false;
+				}
+				relSize = 4;
+				break;
+			case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+			case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:
+			case 0x98: case 0x99: case 0x9B: case 0x9C: case 0x9D: case 0x9E: case 0x9F:
+			case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xAA: case 0xAB: case 0xAC: case 0xAD: case 0xAE: case 0xAF:
+			case 0xC3: case 0xC9: case 0xCB: case 0xCC: case 0xCF: case 0xD7:
+			case 0xEC: case 0xED: case 0xEE: case 0xEF: case 0xF1: case 0xF4: case 0xF5:
+			case 0xF8: case 0xF9: case 0xFA: case 0xFB: case 0xFC: case 0xFD:
+				break;
+			default:
+				// BOUND/EVEX, VEX/LES/LDS, far pointers, AAM/AAD, SALC
+				return false;
+			}
+		}
+		if (modRM) {
+			uint8_t modRegRm = code[pos++];
+			uint8_t mod = modRegRm >> 6;
+			uint8_t rm = modRegRm & 0x07;
+			if (mod != 0b11) {
+				if (addressSize16) {
+					return false;
+				}
+				if (rm == 0b100) {
+					uint8_t sib = code[pos++];
+					if (mod == 0b00 && (sib & 0x07) == 0b101) {
+						pos += 4;
+					}
+				} else if (mod == 0b00 && rm == 0b101) {
+					if (MODE == DECODE_X64) {
+						info.relOffset = static_cast<uint8_t>(pos);
+						info.relSize = 4;
+						info.ripRelative = true;
+					}
+					pos += 4;
+				}
+				if (mod == 0b01) {
+					pos += 1;
+				} else if (mod == 0b10) {
+					pos += 4;
+				}
+			}
+			// TEST rm,imm has immediate, other F6/F7 group instructions not
+			if (code[info.opcodeOffset] == 0xF6 || code[info.opcodeOffset] == 0xF7) {
+				if (((modRegRm >> 3) & 0x07) < 2) {
+					immSize = (code[info.opcodeOffset] == 0xF6) ? 1 : immZ;
+				}
+			}
+		}
+		if (relSize) {
+			info.relOffset = static_cast<uint8_t>(pos);
+			info.relSize = static_cast<uint8_t>(relSize);
+			pos += relSize;
+		}
+		pos += immSize;
+		if (pos > MAX_SIZE) {
+			return false;
+		}
+		info.size = static_cast<uint8_t>(pos);
+		return true;
+	}
+
+	/* Hook of function: first instructions of target are replaced by JMP hook,
+	 * replaced instructions are relocated into trampoline which calls original function.
+	 * Trampoline block must be within 2GB of target in x64, hook out of rel32 range
+	 * is reached through veneer written into trampoline block (MOV R11,hook; JMP R11).
+	 * Target code must be writable while install() and uninstall() are called,
+	 * jump is written atomically for threads entering target, but no thread may
+	 * execute inside replaced instructions.
+	 */
+	template<DecodeMode MODE>
+	class Detour {
+	private:
+		constexpr static Size JUMP_SIZE = 5;
+
+		uint8_t* mTarget;
+		Addr mTrampoline;
+		std::array<uint8_t, JUMP_SIZE> mOriginal;
+		Size mReplacedSize;
+		bool mInstalled;
+
+		static bool isRel32(Addr from, Addr to) {
+			auto offset = to - from;
+			return offset == static_cast<int32_t>(offset);
+		}
+
+		template<class BLOCK>
+		static bool pushRel32(BLOCK& block, Addr target) {
+			Addr from = block.getCurrentPtr() + sizeof(int32_t);
+			if (!isRel32(from, target)) {
+				return false;
+			}
+			block.pushRaw(static_cast<int32_t>(target - from));
+			return true;
+		}
+
+		/* Copy instruction to block and adjust its relative field for new address */
+		template<class BLOCK>
+		bool relocate(BLOCK& block, Addr code, const InstructionInfo& info) const {
+			if (!info.relSize) {
+				block.pushBytes(code, info.size);
+				return true;
+			}
+			int32_t relative;
+			if (info.relSize == 1) {
+				relative = static_cast<int8_t>(code[info.relOffset]);
+			} else {
+				std::memcpy(&relative, code + info.relOffset, sizeof(relative));
+			}
+			Addr target = code + info.size + relative;
+			if (info.ripRelative) {
+				Size tailSize = info.size - info.relOffset - sizeof(int32_t);
+				block.pushBytes(code, info.relOffset);
+				Addr from = block.getCurrentPtr() + sizeof(int32_t) + tailSize;
+				if (!isRel32(from, target)) {
+					return false;
+				}
+				block.pushRaw(static_cast<int32_t>(target - from));
+				block.pushBytes(code + info.relOffset + sizeof(int32_t), tailSize);
+				return true;
+			}
+			if (target > mTarget && target < mTarget + mReplacedSize) {
+				return false; // branch into replaced instructions
+			}
+			uint8_t opcode = code[info.opcodeOffset];
+			if (info.relSize == 4) {
+				block.pushBytes(code, info.relOffset);
+			} else if (opcode == 0xEB) {
+				block.pushBytes(code, info.opcodeOffset);
+				block.template pushRaw<uint8_t>(0xE9);
+			} else if (opcode >= 0x70 && opcode <= 0x7F) {
+				block.pushBytes(code, info.opcodeOffset);
+				block.template pushRaw<uint8_t>(0x0F);
+				block.template pushRaw<uint8_t>(opcode + 0x10);
+			} else {
+				return false; // LOOP/JCXZ have only rel8 form
+			}
+			return pushRel32(block, target);
+		}
+	public:
+		Detour() : mTarget(nullptr), mTrampoline(nullptr), mOriginal(), mReplacedSize(0), mInstalled(false) {}
+		Detour(const Detour&) = delete;
+		Detour& operator=(const Detour&) = delete;
+
+		/* Write trampoline into block and replace start of target by jump to hook,
+		 * in case target instructions can't be relocated return false and block is not changed
+		 */
+		template<class BLOCK>
+		bool install(BLOCK& trampolineBlock, void* target, Addr hook) {
+			if (mInstalled) {
+				return false;
+			}
+			mTarget = static_cast<uint8_t*>(target);
+			std::array<InstructionInfo, JUMP_SIZE> instructions;
+			Size count = 0;
+			for (mReplacedSize = 0; mReplacedSize < JUMP_SIZE; mReplacedSize += instructions[count++].size) {
+				if (!decodeInstruction<MODE>(mTarget + mReplacedSize, instructions[count])) {
+					return false;
+				}
+			}
+
+			Addr blockStart = trampolineBlock.getCurrentPtr();
+			Addr hookJump = hook;
+			if (!isRel32(mTarget + JUMP_SIZE, hook)) {
+				if (MODE != DECODE_X64) {
+					return false;
+				}
+				hookJump = trampolineBlock.getCurrentPtr();
+				X64::i386::Mov(trampolineBlock, X64::R11, U64(reinterpret_cast<uintptr_t>(hook)));
+				X64::i386::Jmp(trampolineBlock, X64::R11);
+			}
+			mTrampoline = trampolineBlock.getCurrentPtr();
+			bool result = isRel32(mTarget + JUMP_SIZE, hookJump);
+			Size offset = 0;
+			for (Size i = 0; i < count && result; offset += instructions[i++].size) {
+				result = relocate(trampolineBlock, mTarget + offset, instructions[i]);
+			}
+			result = result && X64::i386::Jmp<X64::LONG>(trampolineBlock).bind(trampolineBlock, mTarget + mReplacedSize);
+			if (!result) {
+				trampolineBlock.reset(blockStart);
+				return false;
+			}
+
+			uint8_t jump[JUMP_SIZE] = { 0xE9 };
+			int32_t jumpOffset = static_cast<int32_t>(hookJump - (mTarget + JUMP_SIZE));
+			std::memcpy(jump + 1, &jumpOffset, sizeof(jumpOffset));
+			std::memcpy(mOriginal.data(), mTarget, JUMP_SIZE);
+			Os::CodeBlock targetBlock(mTarget, JUMP_SIZE);
+			if (!targetBlock.patchInstruction(0, JUMP_SIZE, 0, jump, JUMP_SIZE)) {
+				trampolineBlock.reset(blockStart);
+				return false;
+			}
+			mInstalled = true;
+			return true;
+		}
+
+		/* Restore original instructions of target,
+		 * trampoline must not be used after it
+		 */
+		bool uninstall() {
+			if (!mInstalled) {
+				return false;
+			}
+			Os::CodeBlock targetBlock(mTarget, JUMP_SIZE);
+			if (!targetBlock.patchInstruction(0, JUMP_SIZE, 0, mOriginal.data(), JUMP_SIZE)) {
+				return false;
+			}
+			mInstalled = false;
+			return true;
+		}
+
+		/* Get address of trampoline which executes original function */
+		Addr getTrampoline() const {
+			return mTrampoline;
+		}
+
+		/* Get size of target instructions replaced by hook jump */
+		Size getReplacedSize() const {
+			return mReplacedSize;
+		}
+
+		bool isInstalled() const {
+			return mInstalled;
+		}
+	};
+}
+
+namespace CppAsm::X86
+{
+	typedef Os::Detour<Os::DECODE_X86> Detour;
+}
+
+namespace CppAsm::X64
+{
+	typedef Os::Detour<Os::DECODE_X64> Detour;
+}
\ No newline at end of file
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "defs.h"
+
+namespace CppAsm::Dwarf
+{
+	enum CfaOpcode : uint8_t {
+		DW_CFA_nop = 0x00,
+		DW_CFA_advance_loc1 = 0x02,
+		DW_CFA_advance_loc2 = 0x03,
+		DW_CFA_advance_loc4 = 0x04,
+		DW_CFA_remember_state = 0x0A,
+		DW_CFA_restore_state = 0x0B,
+		DW_CFA_def_cfa = 0x0C,
+		DW_CFA_def_cfa_register = 0x0D,
+		DW_CFA_def_cfa_offset = 0x0E,
+		DW_CFA_advance_loc = 0x40,
+		DW_CFA_offset = 0x80,
+		DW_CFA_restore = 0xC0
+	};
+
+	enum PointerEncoding : uint8_t {
+		DW_EH_PE_absptr = 0x00
+	};
+
+	/* Architecture properties of call frame information */
+	struct Target {
+		uint8_t spReg;
+		uint8_t raReg;
+		uint8_t stackSlotSize;
+		uint8_t addressSize;
+	};
+
+	/* DWARF register numbers of x86 equal to Reg32 encoding */
+	constexpr Target TARGET_X86 = { 4, 8, 4, 4 };
+	/* DWARF register numbers of x64 differ from Reg64 encoding, see getRegX64() */
+	constexpr Target TARGET_X64 = { 7, 16, 8, 8 };
+
+	/* Convert Reg64 encoding to DWARF register number */
+	constexpr uint8_t getRegX64(uint8_t reg) {
+		constexpr uint8_t regMap[] = { 0, 2, 1, 3, 7, 6, 4, 5 };
+		return (reg < 8) ? regMap[reg] : reg;
+	}
+
+	/* Writer of bytes into caller buffer,
+	 * in case buffer overflow or value not fit into its field
+	 * all next writes ignored and isValid() return false
+	 */
+	class ByteWriter {
+	private:
+		uint8_t* mData;
+		Size mSize;
+		Size mPos;
+		bool mOverflow;
+	public:
+		ByteWriter(void* data, Size size) : mData(static_cast<uint8_t*>(data)), mSize(size), mPos(0), mOverflow(false) {}
+
+		void write(const void* data, Size size) {
+			if (mOverflow || mPos + size > mSize) {
+				mOverflow = true;
+				return;
+			}
+			std::memcpy(mData + mPos, data, size);
+			mPos += size;
+		}
+
+		template<class T>
+		void writeRaw(const T& val) {
+			write(&val, sizeof(val));
+		}
+
+		template<class T>
+		void writeRaw(const T& val, Offset offset) {
+			if (!mOverflow && offset + sizeof(val) <= mPos) {
+				std::memcpy(mData + offset, &val, sizeof(val));
+			}
+		}
+
+		/* Write little endian value of 4 or 8 bytes */
+		void writeUnsigned(uint64_t value, Size size) {
+			if (size == sizeof(uint32_t)) {
+				if (value > UINT32_MAX) {
+					mOverflow = true;
+					return;
+				}
+				writeRaw(static_cast<uint32_t>(value));
+			} else {
+				writeRaw(value);
+			}
+		}
+
+		void writeULEB128(uint64_t value) {
+			do {
+				uint8_t byte = value & 0x7F;
+				value >>= 7;
+				if (value) {
+					byte |= 0x80;
+				}
+				writeRaw(byte);
+			} while (value);
+		}
+
+		void writeSLEB128(int64_t value) {
+			bool more;
+			do {
+				uint8_t byte = value & 0x7F;
+				value >>= 7;
+				more = !((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40)));
+				if (more) {
+					byte |= 0x80;
+				}
+				writeRaw(byte);
+			} while (more);
+		}
+
+		/* Write nop bytes until position aligned */
+		void align(Size alignment, uint8_t fill = 0) {
+			while (mPos % alignment) {
+				writeRaw(fill);
+			}
+		}
+
+		uint8_t* getData() const {
+			return mData;
+		}
+
+		Size getPos() const {
+			return mPos;
+		}
+
+		bool isValid() const {
+			return !mOverflow;
+		}
+	};
+
+	/* Call frame instructions of single function.
+	 * Code locations are offsets from function start,
+	 * register offsets are positive distances below CFA in bytes.
+	 */
+	template<Size CAPACITY = 64>
+	class CfiProgram {
+	private:
+		std::array<uint8_t, CAPACITY> mData;
+		ByteWriter mWriter;
+		Target mTarget;
+		Offset mLocation;
+	public:
+		explicit CfiProgram(const Target& target) : mWriter(mData.data(), CAPACITY), mTarget(target), mLocation(0) {}
+		CfiProgram(const CfiProgram&) = delete;
+		CfiProgram& operator=(const CfiProgram&) = delete;
+
+		/* Set location of next rules */
+		void advanceTo(Offset location) {
+			Size delta = location - mLocation;
+			if (delta == 0) {
+				return;
+			}
+			if (delta < 0x40) {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_advance_loc | static_cast<uint8_t>(delta));
+			} else if (delta <= UINT8_MAX) {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_advance_loc1);
+				mWriter.template writeRaw<uint8_t>(static_cast<uint8_t>(delta));
+			} else if (delta <= UINT16_MAX) {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_advance_loc2);
+				mWriter.template writeRaw<uint16_t>(static_cast<uint16_t>(delta));
+			} else {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_advance_loc4);
+				mWriter.template writeRaw<uint32_t>(static_cast<uint32_t>(delta));
+			}
+			mLocation = location;
+		}
+
+		void defCfa(uint8_t reg, Size offset) {
+			mWriter.template writeRaw<uint8_t>(DW_CFA_def_cfa);
+			mWriter.writeULEB128(reg);
+			mWriter.writeULEB128(offset);
+		}
+
+		void defCfaRegister(uint8_t reg) {
+			mWriter.template writeRaw<uint8_t>(DW_CFA_def_cfa_register);
+			mWriter.writeULEB128(reg);
+		}
+
+		void defCfaOffset(Size offset) {
+			mWriter.template writeRaw<uint8_t>(DW_CFA_def_cfa_offset);
+			mWriter.writeULEB128(offset);
+		}
+
+		/* Register saved at address CFA - offset */
+		void offset(uint8_t reg, Size offset) {
+			Size factored = offset / mTarget.stackSlotSize;
+			if (reg < 0x40) {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_offset | reg);
+			} else {
+				mWriter.template writeRaw<uint8_t>(0x05); // DW_CFA_offset_extended
+				mWriter.writeULEB128(reg);
+			}
+			mWriter.writeULEB128(factored);
+		}
+
+		/* Register restored to value from CIE initial rules */
+		void restore(uint8_t reg) {
+			if (reg < 0x40) {
+				mWriter.template writeRaw<uint8_t>(DW_CFA_restore | reg);
+			} else {
+				mWriter.template writeRaw<uint8_t>(0x06); // DW_CFA_restore_extended
+				mWriter.writeULEB128(reg);
+			}
+		}
+
+		void rememberState() {
+			mWriter.template writeRaw<uint8_t>(DW_CFA_remember_state);
+		}
+
+		void restoreState() {
+			mWriter.template writeRaw<uint8_t>(DW_CFA_restore_state);
+		}
+
+		const Target& getTarget() const {
+			return mTarget;
+		}
+
+		const uint8_t* getData() const {
+			return mData.data();
+		}
+
+		Size getSize() const {
+			return mWriter.getPos();
+		}
+
+		bool isValid() const {
+			return mWriter.isValid();
+		}
+	};
+
+	/* Writer of .eh_frame section content in caller buffer.
+	 * Addresses encoded as absolute pointers of target address size.
+	 */
+	class EhFrameWriter {
+	private:
+		ByteWriter mWriter;
+		Target mTarget;
+		Offset mCieOffset;
+
+		void writeCie() {
+			mCieOffset = mWriter.getPos();
+			mWriter.template writeRaw<uint32_t>(0); // length
+			mWriter.template writeRaw<uint32_t>(0); // CIE id
+			mWriter.template writeRaw<uint8_t>(1); // version
+			mWriter.write("zR", 3); // augmentation
+			mWriter.writeULEB128(1); // code alignment factor
+			mWriter.writeSLEB128(-static_cast<int64_t>(mTarget.stackSlotSize)); // data alignment factor
+			mWriter.template writeRaw<uint8_t>(mTarget.raReg);
+			mWriter.writeULEB128(1); // augmentation data length
+			mWriter.template writeRaw<uint8_t>(DW_EH_PE_absptr);
+			// at function entry CFA is stack pointer before call and return address is at CFA - slot
+			mWriter.template writeRaw<uint8_t>(DW_CFA_def_cfa);
+			mWriter.writeULEB128(mTarget.spReg);
+			mWriter.writeULEB128(mTarget.stackSlotSize);
+			mWriter.template writeRaw<uint8_t>(DW_CFA_offset | mTarget.raReg);
+			mWriter.writeULEB128(1);
+			finishEntry(mCieOffset);
+		}
+
+		void finishEntry(Offset entryOffset) {
+			mWriter.align(mTarget.addressSize, DW_CFA_nop);
+			mWriter.template writeRaw<uint32_t>(static_cast<uint32_t>(mWriter.getPos() - entryOffset - sizeof(uint32_t)), entryOffset);
+		}
+	public:
+		EhFrameWriter(void* data, Size size, const Target& target) : mWriter(data, size), mTarget(target), mCieOffset(0) {
+			writeCie();
+		}
+
+		/* Add FDE of function code range [addr, addr + size) */
+		void addFunction(Addr addr, Size size, const uint8_t* cfi, Size cfiSize) {
+			Offset fdeOffset = mWriter.getPos();
+			mWriter.template writeRaw<uint32_t>(0); // length
+			mWriter.template writeRaw<uint32_t>(static_cast<uint32_t>(mWriter.getPos() - mCieOffset));
+			mWriter.writeUnsigned(reinterpret_cast<uintptr_t>(addr), mTarget.addressSize);
+			mWriter.writeUnsigned(size, mTarget.addressSize);
+			mWriter.writeULEB128(0); // augmentation data length
+			mWriter.write(cfi, cfiSize);
+			finishEntry(fdeOffset);
+		}
+
+		template<Size CAPACITY>
+		void addFunction(Addr addr, Size size, const CfiProgram<CAPACITY>& program) {
+			addFunction(addr, size, program.getData(), program.getSize());
+		}
+
+		/* Write zero terminator required by runtime unwinders */
+		void finish() {
+			mWriter.template writeRaw<uint32_t>(0);
+		}
+
+		const uint8_t* getData() const {
+			return mWriter.getData();
+		}
+
+		Size getSize() const {
+			return mWriter.getPos();
+		}
+
+		bool isValid() const {
+			return mWriter.isValid();
+		}
+	};
+}
\ No newline at end of file
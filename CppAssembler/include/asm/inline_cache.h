@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+
+#include "os.h"
+#include "replaceable.h"
+#include "arch/x86_i386.h"
+#include "arch/x64_i386.h"
+
+namespace CppAsm::Os
+{
+	typedef uint32_t TypeId;
+
+	/* Cache entries shared by architecture specific inline caches.
+	 * Entry is pair of patchable fields: type id of CMP and rel32 of JE,
+	 * both aligned by Os::alignPatchable so they are replaced atomically
+	 * while other threads execute cache. Caller must serialize updates.
+	 */
+	template<Size ENTRIES>
+	class InlineCacheEntries {
+	private:
+		struct Entry {
+			Offset typeOffset;
+			Offset handlerOffset;
+		};
+
+		std::array<Entry, ENTRIES> mEntries;
+		Size mCount;
+		Addr mMiss;
+
+		template<class BLOCK>
+		static bool replaceJump(BLOCK& block, Offset jumpOffset, Addr target) {
+			auto offset = target - (block.getStartPtr() + jumpOffset + sizeof(int32_t));
+			if (offset != static_cast<int32_t>(offset)) {
+				return false;
+			}
+			return ReplaceableValue<int32_t>(jumpOffset).replaceAtomic(block, static_cast<int32_t>(offset));
+		}
+	protected:
+		InlineCacheEntries() : mEntries(), mCount(0), mMiss(nullptr) {}
+
+		void setEntry(Size index, Offset typeOffset, Offset handlerOffset) {
+			mEntries[index] = { typeOffset, handlerOffset };
+		}
+
+		void setMiss(Addr miss) {
+			mMiss = miss;
+		}
+	public:
+		/* Add handler of type into next free entry. Jump of free entry always points to miss stub,
+		 * so type id is patched first (new type still reaches miss stub) and handler jump after it,
+		 * other threads never reach new handler with stale type id left by clear().
+		 * In case cache is full (megamorphic) or handler too far return false
+		 */
+		template<class BLOCK>
+		bool add(BLOCK& block, TypeId type, Addr handler) {
+			if (mCount >= ENTRIES) {
+				return false;
+			}
+			const Entry& entry = mEntries[mCount];
+			if (!ReplaceableValue<TypeId>(entry.typeOffset).replaceAtomic(block, type) ||
+				!replaceJump(block, entry.handlerOffset, handler)) {
+				return false;
+			}
+			mCount++;
+			return true;
+		}
+
+		/* Point all entries to miss stub (e.g. after type handlers invalidated),
+		 * entries keep type ids until they reused by add()
+		 */
+		template<class BLOCK>
+		bool clear(BLOCK& block) {
+			bool result = true;
+			for (Size i = 0; i < ENTRIES; i++) {
+				result &= replaceJump(block, mEntries[i].handlerOffset, mMiss);
+			}
+			mCount = 0;
+			return result;
+		}
+
+		Size getCount() const {
+			return mCount;
+		}
+
+		bool isFull() const {
+			return mCount >= ENTRIES;
+		}
+	};
+}
+
+namespace CppAsm::X86
+{
+	/* Monomorphic (ENTRIES = 1) or polymorphic inline cache dispatching by type id in register,
+	 * all entries initially jump to miss stub which is expected to resolve handler
+	 * and add() it to cache.
+	 - CMP type,id[0]
+	 - JE handler[0]
+	 - ...
+	 - JMP miss
+	*/
+	template<Size ENTRIES>
+	class InlineCache : public Os::InlineCacheEntries<ENTRIES> {
+	public:
+		/* Emit cache at current position of block */
+		template<class BLOCK>
+		void emit(BLOCK& block, Reg32 type, Addr miss) {
+			this->setMiss(miss);
+			for (Size i = 0; i < ENTRIES; i++) {
+				Os::alignPatchable(block, 6);
+				auto typeValue = i386::Cmp(block, type, U32(0)).second;
+				Os::alignPatchable(block, 6);
+				FwdLabel<LONG> handler = i386::Je<LONG>(block);
+				handler.bind(block, miss);
+				this->setEntry(i, typeValue.getCbOffset(), handler.getCbOffset());
+			}
+			i386::Jmp<LONG>(block).bind(block, miss);
+		}
+	};
+}
+
+namespace CppAsm::X64
+{
+	/* Monomorphic (ENTRIES = 1) or polymorphic inline cache dispatching by type id in register,
+	 * all entries initially jump to miss stub which is expected to resolve handler
+	 * and add() it to cache. Handlers and miss stub must be within 2GB from cache.
+	 - CMP type,id[0]
+	 - JE handler[0]
+	 - ...
+	 - JMP miss
+	*/
+	template<Size ENTRIES>
+	class InlineCache : public Os::InlineCacheEntries<ENTRIES> {
+	public:
+		/* Emit cache at current position of block,
+		 * in case miss stub is too far return false
+		 */
+		template<class BLOCK>
+		bool emit(BLOCK& block, Reg32 type, Addr miss) {
+			bool result = true;
+			this->setMiss(miss);
+			for (Size i = 0; i < ENTRIES; i++) {
+				Os::alignPatchable(block, 7);
+				i386::Cmp(block, type, S32(0));
+				Offset typeOffset = block.getOffset() - sizeof(Os::TypeId);
+				Os::alignPatchable(block, 6);
+				FwdLabel<LONG> handler = i386::Je<LONG>(block);
+				result &= handler.bind(block, miss);
+				this->setEntry(i, typeOffset, handler.getCbOffset());
+			}
+			result &= i386::Jmp<LONG>(block).bind(block, miss);
+			return result;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include "os.h"
+
+namespace CppAsm::Os
+{
+	/* Block which collects bytes of instruction in local buffer and commits them
+	 * into parent block with single copy and single cursor move, instead of
+	 * separate write for every prefix, opcode, operand and immediate.
+	 * Buffer is committed by commit() after each instruction (see writeInstruction()),
+	 * on destruction and when next field not fit into buffer. With commit() after
+	 * each instruction and CAPACITY not less than 15 (longest instruction)
+	 * every instruction is written by single copy.
+	 */
+	template<class BLOCK, Size CAPACITY = 16>
+	class InstructionBuffer {
+	private:
+		BLOCK& mBlock;
+		Offset mBaseOffset;
+		Size mSize;
+		alignas(CAPACITY) std::array<uint8_t, CAPACITY> mData;
+
+		void reserve(Size size) {
+			if (mSize + size > CAPACITY) {
+				commit();
+			}
+		}
+
+		bool isBuffered(Offset offset, Size size) const {
+			return (offset >= mBaseOffset) && (offset + size <= mBaseOffset + mSize);
+		}
+	public:
+		typedef BLOCK ParentBlock;
+
+		explicit InstructionBuffer(BLOCK& block) : mBlock(block), mBaseOffset(block.getOffset()), mSize(0), mData() {}
+		InstructionBuffer(const InstructionBuffer&) = delete;
+		InstructionBuffer& operator=(const InstructionBuffer&) = delete;
+		~InstructionBuffer() {
+			commit();
+		}
+
+		/* Write buffered bytes into parent block */
+		void commit() {
+			if (mSize) {
+				mBlock.pushBuffer(mData, mSize);
+				mBaseOffset += mSize;
+				mSize = 0;
+			}
+		}
+
+		Addr getStartPtr() const {
+			return mBlock.getStartPtr();
+		}
+
+		Addr getCurrentPtr() const {
+			return mBlock.getStartPtr() + getOffset();
+		}
+
+		Offset getOffset() const {
+			return mBaseOffset + mSize;
+		}
+
+		Size getTotalSize() const {
+			return mBlock.getTotalSize();
+		}
+
+		Size getSize() const {
+			return mBaseOffset + mSize;
+		}
+
+		Size getRemainingSize() const {
+			return getTotalSize() - getSize();
+		}
+
+		/* Get size in bytes needed to align current write position */
+		template<uint8_t ALIGN>
+		Size getAlignSize() const {
+			static_assert((ALIGN & (ALIGN - 1)) == 0, "InstructionBuffer::getAlignSize(): align not power of two");
+			Size alignRemainder = reinterpret_cast<uintptr_t>(getCurrentPtr()) % ALIGN;
+			return (ALIGN - alignRemainder) % ALIGN;
+		}
+
+		void skipBytes(Size size) {
+			if (size > CAPACITY) {
+				commit();
+				mBlock.skipBytes(size);
+				mBaseOffset += size;
+				return;
+			}
+			reserve(size);
+			mSize += size;
+		}
+
+		template<class T>
+		void readRaw(T& val, Offset offset) {
+			if (isBuffered(offset, sizeof(val))) {
+				std::memcpy(&val, mData.data() + offset - mBaseOffset, sizeof(val));
+			} else {
+				mBlock.readRaw(val, offset);
+			}
+		}
+
+		template<class T>
+		void writeRaw(const T& val) {
+			reserve(sizeof(val));
+			std::memcpy(mData.data() + mSize, &val, sizeof(val));
+		}
+
+		template<class T>
+		void writeRaw(const T& val, Offset offset) {
+			if (isBuffered(offset, sizeof(val))) {
+				std::memcpy(mData.data() + offset - mBaseOffset, &val, sizeof(val));
+			} else {
+				mBlock.writeRaw(val, offset);
+			}
+		}
+
+		template<class T>
+		void pushRaw(const T& val) {
+			reserve(sizeof(val));
+			std::memcpy(mData.data() + mSize, &val, sizeof(val));
+			mSize += sizeof(val);
+		}
+
+		void pushBytes(const void* data, Size size) {
+			commit();
+			mBlock.pushBytes(data, size);
+			mBaseOffset += size;
+		}
+
+		/* Forward rel32 field of instruction to relocating block */
+		template<class B = BLOCK, class = std::enable_if_t<IsRelocatingBlock<B>::value>>
+		void addRel32(Offset offset, Addr target) {
+			mBlock.addRel32(offset, target);
+		}
+	};
+
+	/* Write instructions of generator (e.g. [&](auto& block) {...}) into block with single commit,
+	 * generator should write single instruction or sequence which fit into buffer
+	 */
+	template<class BLOCK, class GENERATOR>
+	void writeInstruction(BLOCK& block, GENERATOR&& generator) {
+		InstructionBuffer<BLOCK> buffer(block);
+		generator(buffer);
+	}
+}
\ No newline at end of file
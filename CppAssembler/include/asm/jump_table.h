@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cassert>
+
+#include "arch/x86_i386.h"
+#include "arch/x64_i386.h"
+#include "relocation.h"
+
+namespace CppAsm::X86
+{
+	/* Table of absolute case addresses for dense switch dispatch.
+	 * Table is reserved in block (code block or separate data block) before dispatch
+	 * is emitted, case entries are bound later when case code is written.
+	 */
+	template<Size CASES>
+	class JumpTable {
+	private:
+		typedef uint32_t entry_type;
+
+		Addr mTable;
+		Offset mTableOffset;
+	public:
+		JumpTable() : mTable(nullptr), mTableOffset(0) {}
+
+		/* Reserve table at current position of block aligned to entry size,
+		 * all entries initially point to default address
+		 */
+		template<class BLOCK>
+		void reserve(BLOCK& block, Addr defaultAddr = nullptr) {
+			Size padding = block.template getAlignSize<sizeof(entry_type)>();
+			for (Size i = 0; i < padding; i++) {
+				block.template pushRaw<uint8_t>(0xCC);
+			}
+			mTable = block.getCurrentPtr();
+			mTableOffset = block.getOffset();
+			for (Size i = 0; i < CASES; i++) {
+				block.pushRaw(static_cast<entry_type>(reinterpret_cast<uintptr_t>(defaultAddr)));
+			}
+		}
+
+		/* Emit jump to case by index register without range check
+		 - JMP [index*4+table]
+		*/
+		template<class BLOCK>
+		void dispatchUnchecked(BLOCK& block, Reg32 index) const {
+			assert(mTable);
+			i386::Jmp(block, Mem32<INDEX_OFFSET>(index, SCALE_4,
+				static_cast<int32_t>(reinterpret_cast<uintptr_t>(mTable))));
+		}
+
+		/* Emit range check and jump to case by index register,
+		 * return label of jump taken when index is out of range
+		 - CMP index,CASES
+		 - JAE default
+		 - JMP [index*4+table]
+		*/
+		template<class BLOCK>
+		FwdLabel<LONG> dispatch(BLOCK& block, Reg32 index) const {
+			i386::Cmp(block, index, U32(CASES));
+			FwdLabel<LONG> defaultLabel = i386::Jae<LONG>(block);
+			dispatchUnchecked(block, index);
+			return defaultLabel;
+		}
+
+		/* Bind case entry of table stored in block to address */
+		template<class BLOCK>
+		void bind(BLOCK& tableBlock, Size index, Addr addr) const {
+			assert(index < CASES);
+			tableBlock.writeRaw(static_cast<entry_type>(reinterpret_cast<uintptr_t>(addr)),
+				mTableOffset + index * sizeof(entry_type));
+		}
+
+		/* Bind case entry of table stored in same block to current write position */
+		template<class BLOCK>
+		void bind(BLOCK& block, Size index) const {
+			bind(block, index, block.getCurrentPtr());
+		}
+
+		/* Bind all case entries to address (e.g. default case) */
+		template<class BLOCK>
+		void bindAll(BLOCK& tableBlock, Addr addr) const {
+			for (Size i = 0; i < CASES; i++) {
+				bind(tableBlock, i, addr);
+			}
+		}
+
+		/* Record absolute case entries in relocation table of block which stores table */
+		template<class RELOCATIONS>
+		bool addRelocations(RELOCATIONS& relocations) const {
+			bool result = true;
+			for (Size i = 0; i < CASES; i++) {
+				result &= relocations.add(mTableOffset + i * sizeof(entry_type), Os::RELOC_ABS32);
+			}
+			return result;
+		}
+
+		Addr getAddress() const {
+			return mTable;
+		}
+	};
+}
+
+namespace CppAsm::X64
+{
+	/* Table of 32-bit case offsets relative to table start for dense switch dispatch,
+	 * table and cases must be within 2GB from each other.
+	 * Table is reserved in block (code block or separate data block) before dispatch
+	 * is emitted, case entries are bound later when case code is written.
+	 */
+	template<Size CASES>
+	class JumpTable {
+	private:
+		typedef int32_t entry_type;
+
+		Addr mTable;
+		Offset mTableOffset;
+	public:
+		JumpTable() : mTable(nullptr), mTableOffset(0) {}
+
+		/* Reserve table at current position of block aligned to entry size,
+		 * all entries initially point to table start
+		 */
+		template<class BLOCK>
+		void reserve(BLOCK& block) {
+			Size padding = block.template getAlignSize<sizeof(entry_type)>();
+			for (Size i = 0; i < padding; i++) {
+				block.template pushRaw<uint8_t>(0xCC);
+			}
+			mTable = block.getCurrentPtr();
+			mTableOffset = block.getOffset();
+			for (Size i = 0; i < CASES; i++) {
+				block.template pushRaw<entry_type>(0);
+			}
+		}
+
+		/* Emit jump to case by index register without range check,
+		 * index and temp registers are modified (temp must not be RBP or R13)
+		 - LEA temp,[rip+table]
+		 - MOVSXD index,[temp+index*4]
+		 - ADD index,temp
+		 - JMP index
+		*/
+		template<class BLOCK>
+		void dispatchUnchecked(BLOCK& block, Reg64 index, Reg64 temp) const {
+			assert(mTable);
+			assert(detail::removeExtRegBit(temp) != RBP);
+			i386::Lea(block, temp, Mem64<RIP_OFFSET>(mTable));
+			i386::Movsxd(block, index, Mem64<BASE_INDEX>(temp, index, SCALE_4));
+			i386::Add(block, index, temp);
+			i386::Jmp(block, index);
+		}
+
+		/* Emit range check and jump to case by index register,
+		 * return label of jump taken when index is out of range
+		 - CMP index,CASES
+		 - JAE default
+		 - dispatchUnchecked()
+		*/
+		template<class BLOCK>
+		FwdLabel<LONG> dispatch(BLOCK& block, Reg64 index, Reg64 temp) const {
+			i386::Cmp(block, index, S32(CASES));
+			FwdLabel<LONG> defaultLabel = i386::Jae<LONG>(block);
+			dispatchUnchecked(block, index, temp);
+			return defaultLabel;
+		}
+
+		/* Bind case entry of table stored in block to address,
+		 * in case address is too far from table return false
+		 */
+		template<class BLOCK>
+		bool bind(BLOCK& tableBlock, Size index, Addr addr) const {
+			assert(index < CASES);
+			auto offset = addr - mTable;
+			if (offset != static_cast<entry_type>(offset)) {
+				return false;
+			}
+			tableBlock.writeRaw(static_cast<entry_type>(offset), mTableOffset + index * sizeof(entry_type));
+			return true;
+		}
+
+		/* Bind case entry of table stored in same block to current write position */
+		template<class BLOCK>
+		bool bind(BLOCK& block, Size index) const {
+			return bind(block, index, block.getCurrentPtr());
+		}
+
+		/* Bind all case entries to address (e.g. default case) */
+		template<class BLOCK>
+		bool bindAll(BLOCK& tableBlock, Addr addr) const {
+			bool result = true;
+			for (Size i = 0; i < CASES; i++) {
+				result &= bind(tableBlock, i, addr);
+			}
+			return result;
+		}
+
+		Addr getAddress() const {
+			return mTable;
+		}
+	};
+}
\ No newline at end of file
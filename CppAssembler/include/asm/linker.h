@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+
+#include "os.h"
+#include "replaceable.h"
+#include "arch/x64_i386.h"
+
+namespace CppAsm::Os
+{
+	typedef Size SymbolId;
+
+	/* Resolver of rel32 call and jump targets between functions written to different blocks.
+	 * Functions are referenced by symbol id, fields of emitted CALL label / JMP label (tail call)
+	 * are recorded as fixups and written by link() when all symbols are defined.
+	 * Fixups stay recorded, so link() can be repeated after symbol is redefined.
+	 * Tables are stored in fixed size arrays to avoid heap allocations.
+	 */
+	template<class BLOCK, Size SYMBOLS, Size FIXUPS>
+	class Linker {
+	private:
+		struct Fixup {
+			BLOCK* block;
+			Offset offset;
+			SymbolId symbol;
+		};
+
+		std::array<Addr, SYMBOLS> mSymbols;
+		std::array<Fixup, FIXUPS> mFixups;
+		Size mFixupsCount;
+
+		static bool isReachable(Addr from, Addr target) {
+			auto offset = target - from;
+			return offset == static_cast<int32_t>(offset);
+		}
+
+		struct NoVeneers {
+			Addr get(Addr, Addr) {
+				return nullptr;
+			}
+		};
+
+		template<class VENEERS>
+		bool linkFixup(const Fixup& fixup, VENEERS& veneers) {
+			Addr target = mSymbols[fixup.symbol];
+			if (!target) {
+				return false;
+			}
+			Addr from = fixup.block->getStartPtr() + fixup.offset + sizeof(int32_t);
+			if (!isReachable(from, target)) {
+				target = veneers.get(target, from);
+				if (!target) {
+					return false;
+				}
+			}
+			fixup.block->writeRaw(static_cast<int32_t>(target - from), fixup.offset);
+			return true;
+		}
+	public:
+		Linker() : mFixupsCount(0) {
+			mSymbols.fill(nullptr);
+		}
+
+		/* Set address of symbol (e.g. start of generated function) */
+		void define(SymbolId symbol, Addr addr) {
+			assert(symbol < SYMBOLS);
+			mSymbols[symbol] = addr;
+		}
+
+		/* Set address of symbol to current write position of block */
+		void define(SymbolId symbol, const BLOCK& block) {
+			define(symbol, block.getCurrentPtr());
+		}
+
+		Addr getAddress(SymbolId symbol) const {
+			assert(symbol < SYMBOLS);
+			return mSymbols[symbol];
+		}
+
+		/* Record rel32 field of label which must point to symbol,
+		 * in case table is full return false
+		 */
+		bool addFixup(BLOCK& block, const Replaceable& label, SymbolId symbol) {
+			assert(symbol < SYMBOLS);
+			if (mFixupsCount >= FIXUPS) {
+				return false;
+			}
+			mFixups[mFixupsCount++] = { &block, label.getCbOffset(), symbol };
+			return true;
+		}
+
+		/* Write all recorded fixups, in case symbol is not defined
+		 * or out of rel32 range return false
+		 */
+		bool link() {
+			NoVeneers veneers;
+			return link(veneers);
+		}
+
+		/* Write all recorded fixups, symbols out of rel32 range are reached through veneers */
+		template<class VENEERS>
+		bool link(VENEERS& veneers) {
+			bool result = true;
+			for (Size i = 0; i < mFixupsCount; i++) {
+				result &= linkFixup(mFixups[i], veneers);
+			}
+			return result;
+		}
+
+		Size getFixupsCount() const {
+			return mFixupsCount;
+		}
+
+		void reset() {
+			mSymbols.fill(nullptr);
+			mFixupsCount = 0;
+		}
+	};
+}
+
+namespace CppAsm::X64
+{
+	/* Pool of veneers for Os::Linker which jump to targets out of rel32 range of callers.
+	 * Veneer block must be allocated within 2GB of calling code, veneers are reused
+	 * for same target when reachable.
+	 - MOV R11,target
+	 - JMP R11
+	*/
+	template<class BLOCK, Size CAPACITY>
+	class VeneerPool {
+	private:
+		struct Veneer {
+			Addr target;
+			Addr addr;
+		};
+
+		BLOCK& mBlock;
+		std::array<Veneer, CAPACITY> mVeneers;
+		Size mCount;
+
+		static bool isReachable(Addr from, Addr target) {
+			auto offset = target - from;
+			return offset == static_cast<int32_t>(offset);
+		}
+	public:
+		constexpr static Size VENEER_SIZE = 13;
+
+		VeneerPool(BLOCK& block) : mBlock(block), mCount(0) {}
+		VeneerPool(const VeneerPool&) = delete;
+		VeneerPool& operator=(const VeneerPool&) = delete;
+
+		/* Get veneer to target reachable from address,
+		 * in case pool or block is full or veneer block is too far return nullptr
+		 */
+		Addr get(Addr target, Addr from) {
+			for (Size i = 0; i < mCount; i++) {
+				if (mVeneers[i].target == target && isReachable(from, mVeneers[i].addr)) {
+					return mVeneers[i].addr;
+				}
+			}
+			Addr addr = mBlock.getCurrentPtr();
+			if (mCount >= CAPACITY || mBlock.getTotalSize() - mBlock.getSize() < VENEER_SIZE ||
+				!isReachable(from, addr)) {
+				return nullptr;
+			}
+			i386::Mov(mBlock, R11, U64(reinterpret_cast<uintptr_t>(target)));
+			i386::Jmp(mBlock, R11);
+			mVeneers[mCount++] = { target, addr };
+			return addr;
+		}
+
+		Size getCount() const {
+			return mCount;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <ostream>
+#include <iomanip>
+#include <utility>
+
+#include "os.h"
+
+namespace CppAsm::Os
+{
+	struct ListingEntry {
+		Offset offset;
+		Size size;
+		const char* text;
+	};
+
+	/* Code block which additionally records listing of emitted instructions.
+	 * Every entry started by mark() holds write offset and text of instruction,
+	 * entry size is the distance to the next entry (or to current write position).
+	 * Listing is stored in fixed size array to avoid heap allocations. */
+	template<Size CAPACITY, class BLOCK = CodeBlock>
+	class ListingBlock : public BLOCK {
+	private:
+		struct Mark {
+			Offset offset;
+			const char* text;
+		};
+
+		std::array<Mark, CAPACITY> mMarks;
+		Size mCount;
+	public:
+		template<class... ARGS>
+		explicit ListingBlock(ARGS&&... args) : BLOCK(std::forward<ARGS>(args)...), mCount(0) {}
+		ListingBlock(const ListingBlock&) = delete;
+		ListingBlock& operator=(const ListingBlock&) = delete;
+
+		/* Start new listing entry at current write position
+		 * in case listing is full return false
+		 */
+		bool mark(const char* text) {
+			if (mCount >= CAPACITY) {
+				return false;
+			}
+			mMarks[mCount++] = { BLOCK::getOffset(), text };
+			return true;
+		}
+
+		/* Get count of recorded listing entries */
+		Size getEntriesCount() const {
+			return mCount;
+		}
+
+		/* Get listing entry by index */
+		ListingEntry getEntry(Size index) const {
+			Offset endOffset = (index + 1 < mCount) ? mMarks[index + 1].offset : BLOCK::getOffset();
+			return { mMarks[index].offset, endOffset - mMarks[index].offset, mMarks[index].text };
+		}
+
+		/* Reset current write position to start and clear listing */
+		void reset() {
+			BLOCK::reset();
+			mCount = 0;
+		}
+
+		/* Reset current write position to specified position and drop listing entries from it
+		 * in case address not in block range return false
+		 */
+		bool reset(Addr ptr) {
+			if (!BLOCK::reset(ptr)) {
+				return false;
+			}
+			while (mCount > 0 && mMarks[mCount - 1].offset >= BLOCK::getOffset()) {
+				mCount--;
+			}
+			return true;
+		}
+
+		/* Print listing in format: offset, instruction bytes, instruction text */
+		void print(std::ostream& out, Size maxBytes = 12) const {
+			std::ios_base::fmtflags flags = out.flags();
+			char fill = out.fill();
+			out << std::hex << std::uppercase << std::setfill('0');
+			for (Size i = 0; i < mCount; i++) {
+				ListingEntry entry = getEntry(i);
+				out << std::setw(8) << entry.offset << "  ";
+				Size bytesCount = (entry.size < maxBytes) ? entry.size : maxBytes;
+				for (Size j = 0; j < bytesCount; j++) {
+					out << std::setw(2) << static_cast<unsigned>(BLOCK::getStartPtr()[entry.offset + j]) << ' ';
+				}
+				for (Size j = bytesCount; j < maxBytes; j++) {
+					out << "   ";
+				}
+				out << (entry.size > maxBytes ? "+ " : "  ") << entry.text << '\n';
+			}
+			out.flags(flags);
+			out.fill(fill);
+		}
+	};
+
+	/* Record instruction text into listing, do nothing for blocks without listing */
+	template<class BLOCK>
+	inline void listInstruction(BLOCK& block, const char* text) {
+		// do nothing
+	}
+
+	template<Size CAPACITY, class BLOCK>
+	inline void listInstruction(ListingBlock<CAPACITY, BLOCK>& block, const char* text) {
+		block.mark(text);
+	}
+}
+
+/* Emit instruction and record it into listing of block:
+ *   ASM_LIST(block, GArch::Mov(block, X86::EAX, X86::ECX));
+ * Listing recorded only when CPPASM_LISTING is defined,
+ * otherwise macro expands to instruction call only.
+ */
+#ifdef CPPASM_LISTING
+#define ASM_LIST(block, ...) (CppAsm::Os::listInstruction(block, #__VA_ARGS__), __VA_ARGS__)
+#else
+#define ASM_LIST(block, ...) (__VA_ARGS__)
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstring>
+
+#include "os.h"
+
+namespace CppAsm::Os
+{
+	/* Pool of constants referenced by generated code (64-bit numbers, SIMD masks, etc.).
+	 * Equal literals are stored once, every literal is aligned to requested alignment.
+	 * Pool is stored in fixed size array to avoid heap allocations and can be used:
+	 *  - as shared data region: literals are referenced inside pool memory,
+	 *    pool must stay alive while generated code is used; x64 RIP-relative
+	 *    references reach only +-2 GB, so pool on stack or heap usually can't be
+	 *    referenced from mmap'd code (check with isReachableFrom())
+	 *  - placed into code block after function: setBase() must be called with
+	 *    future pool address before references emitted, then place() after function
+	 */
+	template<Size CAPACITY, Size ALIGN = 16>
+	class LiteralPool {
+	private:
+		static_assert((ALIGN & (ALIGN - 1)) == 0, "LiteralPool: align not power of two");
+
+		alignas(ALIGN) std::array<uint8_t, CAPACITY> mData;
+		Size mSize;
+		Addr mBase;
+
+		static Size alignSize(Size size, Size align) {
+			return (size + align - 1) & ~(align - 1);
+		}
+	public:
+		constexpr static Offset INVALID_OFFSET = ~Offset(0);
+
+		LiteralPool() : mSize(0), mBase(mData.data()) {}
+		LiteralPool(const LiteralPool&) = delete;
+		LiteralPool& operator=(const LiteralPool&) = delete;
+
+		/* Add literal data and return its offset in pool,
+		 * in case pool is full return INVALID_OFFSET
+		 */
+		Offset add(const void* data, Size size, Size align) {
+			assert(align <= ALIGN && (align & (align - 1)) == 0);
+			for (Offset offset = 0; offset + size <= mSize; offset += align) {
+				if (std::memcmp(mData.data() + offset, data, size) == 0) {
+					return offset;
+				}
+			}
+			Offset offset = alignSize(mSize, align);
+			if (offset + size > CAPACITY) {
+				return INVALID_OFFSET;
+			}
+			std::memset(mData.data() + mSize, 0, offset - mSize);
+			std::memcpy(mData.data() + offset, data, size);
+			mSize = offset + size;
+			return offset;
+		}
+
+		template<Size VALUE_ALIGN = 0, class T>
+		Offset add(const T& value) {
+			return add(&value, sizeof(value), VALUE_ALIGN ? VALUE_ALIGN : alignof(T));
+		}
+
+		/* Get address of literal by offset */
+		Addr getAddress(Offset offset) const {
+			assert(offset < mSize);
+			return mBase + offset;
+		}
+
+		/* Add literal and get its address, in case pool is full return nullptr */
+		template<Size VALUE_ALIGN = 0, class T>
+		Addr getLiteral(const T& value) {
+			Offset offset = add<VALUE_ALIGN>(value);
+			return (offset != INVALID_OFFSET) ? getAddress(offset) : nullptr;
+		}
+
+		/* Check whole pool can be referenced with 32-bit displacement from address */
+		bool isReachableFrom(Addr addr) const {
+			int64_t first = static_cast<int64_t>(reinterpret_cast<uintptr_t>(mBase) - reinterpret_cast<uintptr_t>(addr));
+			int64_t last = first + static_cast<int64_t>(CAPACITY);
+			return first >= INT32_MIN && last <= INT32_MAX;
+		}
+
+		/* Set address where pool will be placed, literal addresses are calculated from it */
+		void setBase(Addr base) {
+			assert(reinterpret_cast<uintptr_t>(base) % ALIGN == 0);
+			mBase = base;
+		}
+
+		/* Set pool address right after code of specified size (measured by first pass)
+		 * which will be written from current position of block
+		 */
+		template<class BLOCK>
+		void setBaseAfter(const BLOCK& block, Size codeSize) {
+			uintptr_t address = reinterpret_cast<uintptr_t>(block.getCurrentPtr()) + codeSize;
+			setBase(reinterpret_cast<Addr>(alignSize(address, ALIGN)));
+		}
+
+		/* Write pool into block from current position aligned to pool alignment,
+		 * in case pool written not at address set by setBase() return false
+		 */
+		template<class BLOCK>
+		bool place(BLOCK& block) {
+			Size padding = block.template getAlignSize<ALIGN>();
+			for (Size i = 0; i < padding; i++) {
+				block.template pushRaw<uint8_t>(0xCC);
+			}
+			bool placed = (block.getCurrentPtr() == mBase);
+			block.pushBytes(mData.data(), mSize);
+			return placed;
+		}
+
+		/* Get pool size in bytes */
+		Size getSize() const {
+			return mSize;
+		}
+
+		/* Remove all literals and use pool memory as base */
+		void reset() {
+			mSize = 0;
+			mBase = mData.data();
+		}
+	};
+}
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <array>
+#include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 #include "defs.h"
 
@@ -19,6 +23,8 @@ namespace CppAsm::Os
 		void writeOffset(Size offset, const void* data, Size size);
 		void read(void* data, Size size);
 		void readOffset(Size offset, void* data, Size size);
+		bool writeOffsetAtomic(Size offset, const void* data, Size size);
+		void flushCode(Size offset, Size size);
 	public:
 		BaseBlock(void* data, Size size);
 
@@ -104,6 +110,24 @@ namespace CppAsm::Os
 		void pushRaw(const T& val) {
 			skipBytes(sizeof(val));
 		}
+
+		void pushBytes(const void* data, Size size) {
+			skipBytes(size);
+		}
+
+		template<Size BUFFER_SIZE>
+		void pushBuffer(const std::array<uint8_t, BUFFER_SIZE>& buffer, Size size) {
+			skipBytes(size);
+		}
+
+		template<class T>
+		bool writeRawAtomic(const T& val, Offset offset) {
+			return true; // do nothing
+		}
+
+		bool patchInstruction(Offset instrOffset, Size instrSize, Offset offset, const void* data, Size size) {
+			return true; // do nothing
+		}
 	};
 
 	class CodeBlock : public BaseBlock {
@@ -139,5 +163,157 @@ namespace CppAsm::Os
 			write(&val, sizeof(val));
 			skipBytes(sizeof(val));
 		}
+
+		void pushBytes(const void* data, Size size) {
+			write(data, size);
+			skipBytes(size);
+		}
+
+		/* Push first size bytes of buffer, bytes after them are kept
+		 * (block may be reset into middle of existing code)
+		 */
+		template<Size BUFFER_SIZE>
+		void pushBuffer(const std::array<uint8_t, BUFFER_SIZE>& buffer, Size size) {
+			pushBytes(buffer.data(), size);
+		}
+
+		/* Write value which may be executed by other threads with single atomic store,
+		 * in case value crosses aligned 8 bytes return false
+		 */
+		template<class T>
+		bool writeRawAtomic(const T& val, Offset offset) {
+			if (!writeOffsetAtomic(offset, &val, sizeof(val))) {
+				return false;
+			}
+			flushCode(offset, sizeof(val));
+			return true;
+		}
+
+		/* Replace part of instruction which may be executed by other threads.
+		 * Instruction within aligned 8 bytes is written by single atomic store,
+		 * otherwise cross-modifying code protocol is used: first byte is replaced by INT3,
+		 * all cores are serialized, rest of instruction is written, cores are serialized
+		 * again and first byte is restored. Threads which hit INT3 meanwhile are sent back
+		 * to instruction by trap handler (SIGTRAP handler or vectored exception handler
+		 * installed on first use), so they execute only complete old or new instruction.
+		 * Return false when no way to serialize cores is available
+		 */
+		bool patchInstruction(Offset instrOffset, Size instrSize, Offset offset, const void* data, Size size);
 	};
+
+	/* Block which only counts size of written instructions and can be used in constant expressions,
+	 * instructions which depend on absolute address of block (jump to address) are not supported
+	 */
+	class SizeBlock {
+	private:
+		Size mSize;
+	public:
+		constexpr SizeBlock() : mSize(0) {}
+
+		constexpr Offset getOffset() const {
+			return mSize;
+		}
+
+		constexpr Size getSize() const {
+			return mSize;
+		}
+
+		constexpr void skipBytes(Size size) {
+			mSize += size;
+		}
+
+		template<class T>
+		constexpr void writeRaw(const T& val) {
+			// do nothing
+		}
+
+		template<class T>
+		constexpr void writeRaw(const T& val, Offset offset) {
+			// do nothing
+		}
+
+		template<class T>
+		constexpr void pushRaw(const T& val) {
+			skipBytes(sizeof(val));
+		}
+
+		constexpr void pushBytes(const void* data, Size size) {
+			skipBytes(size);
+		}
+	};
+
+	/* Get size of instructions written by generator in constant expression:
+	 *  constexpr Size size = Os::instructionSize([](auto& block) { X86::i386::Nop(block); });
+	 */
+	template<class GENERATOR>
+	constexpr Size instructionSize(GENERATOR generator) {
+		SizeBlock block;
+		generator(block);
+		return block.getSize();
+	}
+
+	/* Check whether block only measures code (MeasureBlock, SizeBlock), blocks which
+	 * wrap other block (e.g. InstructionBuffer) declare it as ParentBlock type
+	 */
+	template<class BLOCK, class = void>
+	struct IsMeasuringBlock : std::integral_constant<bool,
+		std::is_base_of<MeasureBlock, BLOCK>::value || std::is_base_of<SizeBlock, BLOCK>::value> {};
+
+	template<class BLOCK>
+	struct IsMeasuringBlock<BLOCK, std::void_t<typename BLOCK::ParentBlock>> : IsMeasuringBlock<typename BLOCK::ParentBlock> {};
+
+	namespace detail
+	{
+		/* Measuring blocks are not at final address of code, so reserve worst case padding */
+		template<class BLOCK>
+		void alignPatchable(BLOCK& block, Size instrSize, std::true_type) {
+			if (instrSize > 1 && instrSize <= sizeof(uint64_t)) {
+				block.skipBytes(instrSize - 1);
+			}
+		}
+
+		template<class BLOCK>
+		void alignPatchable(BLOCK& block, Size instrSize, std::false_type) {
+			Size misalign = reinterpret_cast<uintptr_t>(block.getCurrentPtr()) % sizeof(uint64_t);
+			if (instrSize <= sizeof(uint64_t) && misalign + instrSize > sizeof(uint64_t)) {
+				for (Size i = misalign; i < sizeof(uint64_t); i++) {
+					block.template pushRaw<uint8_t>(0x90);
+				}
+			}
+		}
+	}
+
+	/* Pad block with NOP so instruction of specified size written next
+	 * is within aligned 8 bytes and can be replaced by single atomic store.
+	 * Padding depends on absolute address, so measuring blocks (see IsMeasuringBlock)
+	 * reserve worst case padding (instrSize - 1 bytes)
+	 */
+	template<class BLOCK>
+	void alignPatchable(BLOCK& block, Size instrSize) {
+		detail::alignPatchable(block, instrSize, IsMeasuringBlock<BLOCK>());
+	}
+
+	/* Write code in two passes: generator is run over MeasureBlock to get size,
+	 * then over CodeBlock of that size allocated from current position of parent block.
+	 * Measured size is exact unless code contains alignPatchable() padding, which is
+	 * measured as worst case, parent block is advanced only by size of written code.
+	 * Generator is called with both block types, so it must be generic (e.g. [&](auto& block) {...})
+	 * and must write same instructions in both passes.
+	 * Return address of written code, in case parent block has not enough space return nullptr
+	 */
+	template<class BLOCK, class GENERATOR>
+	Addr emit(BLOCK& parentBlock, GENERATOR&& generator) {
+		Addr start = parentBlock.getCurrentPtr();
+		MeasureBlock measureBlock = parentBlock.template subBlock<MeasureBlock>();
+		generator(measureBlock);
+		Size size = measureBlock.getSize();
+		if (size > parentBlock.getRemainingSize()) {
+			return nullptr;
+		}
+		CodeBlock codeBlock = parentBlock.template subBlock<CodeBlock>(size);
+		generator(codeBlock);
+		assert(codeBlock.getSize() <= size);
+		parentBlock.skipBytes(codeBlock.getSize());
+		return start;
+	}
 }
\ No newline at end of file
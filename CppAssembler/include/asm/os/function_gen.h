@@ -0,0 +1,26 @@
+#pragma once
+
+#include "../arch/x86_i386.h"
+#include "../arch/x86_i387.h"
+#include "../arch/x86_SSE.h"
+#include "../arch/x86_SSE2.h"
+
+namespace CppAsm::Os
+{
+	/* Move float (DWORD_PTR) or double (QWORD_PTR) result from XMM register into ST(0),
+	 * where x86 calling conventions return floating point values
+	 */
+	template<X86::MemSize SIZE, class BLOCK>
+	void setFloatResult(BLOCK& block, X86::RegXMM reg) {
+		static_assert(SIZE == X86::DWORD_PTR || SIZE == X86::QWORD_PTR, "setFloatResult: Invalid size modifier");
+		X86::Mem32<X86::BASE> temp(X86::ESP);
+		X86::i386::Sub(block, X86::ESP, S8(8));
+		if constexpr (SIZE == X86::QWORD_PTR) {
+			X86::SSE2::Movsd(block, temp, reg);
+		} else {
+			X86::SSE::Movss(block, temp, reg);
+		}
+		X86::i387::Fld<SIZE>(block, temp);
+		X86::i386::Add(block, X86::ESP, S8(8));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <elf.h>
+
+#include "../os.h"
+#include "../dwarf.h"
+
+namespace CppAsm::Linux
+{
+	/* Entry of GDB JIT interface list (layout defined by GDB) */
+	struct JitCodeEntry {
+		JitCodeEntry* next;
+		JitCodeEntry* prev;
+		const char* symfileAddr;
+		uint64_t symfileSize;
+	};
+
+	namespace GdbJit
+	{
+		/* Add in-memory object file to list and notify debugger */
+		void registerEntry(JitCodeEntry& entry);
+
+		/* Remove in-memory object file from list and notify debugger */
+		void unregisterEntry(JitCodeEntry& entry);
+	}
+
+	/* In-memory ELF object describing one generated function for debuggers:
+	 * symbol of function and .eh_frame unwind info so debugger can unwind through it.
+	 * ELF class and machine follow DWARF target of function generator.
+	 * Object stored in fixed size buffer to avoid heap allocations,
+	 * it must stay alive while code registered.
+	 */
+	template<Size CAPACITY = 1024>
+	class GdbJitObject {
+	private:
+		struct Elf32 {
+			typedef Elf32_Ehdr Ehdr;
+			typedef Elf32_Shdr Shdr;
+			typedef Elf32_Sym Sym;
+			constexpr static uint8_t ELF_CLASS = ELFCLASS32;
+			constexpr static uint16_t ELF_MACHINE = EM_386;
+		};
+
+		struct Elf64 {
+			typedef Elf64_Ehdr Ehdr;
+			typedef Elf64_Shdr Shdr;
+			typedef Elf64_Sym Sym;
+			constexpr static uint8_t ELF_CLASS = ELFCLASS64;
+			constexpr static uint16_t ELF_MACHINE = EM_X86_64;
+		};
+
+		enum SectionIndex : uint16_t {
+			SECTION_NULL,
+			SECTION_TEXT,
+			SECTION_EH_FRAME,
+			SECTION_SYMTAB,
+			SECTION_STRTAB,
+			SECTION_SHSTRTAB,
+			SECTIONS_COUNT
+		};
+
+		constexpr static char SECTION_NAMES[] = "\0.text\0.eh_frame\0.symtab\0.strtab\0.shstrtab";
+		constexpr static uint32_t SECTION_NAME_OFFSETS[SECTIONS_COUNT] = { 0, 1, 7, 17, 25, 33 };
+
+		alignas(sizeof(uint64_t)) std::array<uint8_t, CAPACITY> mData;
+		Size mSize;
+		JitCodeEntry mEntry;
+		bool mRegistered;
+
+		static Size alignSize(Size size, Size alignment) {
+			return (size + alignment - 1) & ~(alignment - 1);
+		}
+
+		template<class Shdr>
+		static void setSection(Shdr* sections, SectionIndex index, uint32_t type, Size flags, Size addr, Size offset, Size size) {
+			Shdr& section = sections[index];
+			section.sh_name = SECTION_NAME_OFFSETS[index];
+			section.sh_type = type;
+			section.sh_flags = flags;
+			section.sh_addr = addr;
+			section.sh_offset = offset;
+			section.sh_size = size;
+			section.sh_addralign = 1;
+		}
+
+		template<class ELF>
+		bool buildElf(const char* name, Addr addr, Size size, const Dwarf::Target& target, const uint8_t* cfi, Size cfiSize) {
+			typedef typename ELF::Ehdr Ehdr;
+			typedef typename ELF::Shdr Shdr;
+			typedef typename ELF::Sym Sym;
+			mData.fill(0);
+			Size nameSize = std::strlen(name) + 1;
+			Offset sectionsOffset = sizeof(Ehdr);
+			Offset ehFrameOffset = alignSize(sectionsOffset + sizeof(Shdr) * SECTIONS_COUNT, target.addressSize);
+			if (ehFrameOffset >= CAPACITY) {
+				return false;
+			}
+			Dwarf::EhFrameWriter ehFrame(mData.data() + ehFrameOffset, CAPACITY - ehFrameOffset, target);
+			ehFrame.addFunction(addr, size, cfi, cfiSize);
+			ehFrame.finish();
+			if (!ehFrame.isValid()) {
+				return false;
+			}
+			Offset symtabOffset = alignSize(ehFrameOffset + ehFrame.getSize(), target.addressSize);
+			Offset strtabOffset = symtabOffset + sizeof(Sym) * 2;
+			Offset shstrtabOffset = strtabOffset + nameSize + 1;
+			mSize = shstrtabOffset + sizeof(SECTION_NAMES);
+			if (mSize > CAPACITY) {
+				mSize = 0;
+				return false;
+			}
+
+			Ehdr* header = reinterpret_cast<Ehdr*>(mData.data());
+			std::memcpy(header->e_ident, ELFMAG, SELFMAG);
+			header->e_ident[EI_CLASS] = ELF::ELF_CLASS;
+			header->e_ident[EI_DATA] = ELFDATA2LSB;
+			header->e_ident[EI_VERSION] = EV_CURRENT;
+			header->e_ident[EI_OSABI] = ELFOSABI_SYSV;
+			header->e_type = ET_REL;
+			header->e_machine = ELF::ELF_MACHINE;
+			header->e_version = EV_CURRENT;
+			header->e_shoff = sectionsOffset;
+			header->e_ehsize = sizeof(Ehdr);
+			header->e_shentsize = sizeof(Shdr);
+			header->e_shnum = SECTIONS_COUNT;
+			header->e_shstrndx = SECTION_SHSTRTAB;
+
+			// code stays in code block, so .text has no data in object
+			Shdr* sections = reinterpret_cast<Shdr*>(mData.data() + sectionsOffset);
+			setSection(sections, SECTION_TEXT, SHT_NOBITS, SHF_ALLOC | SHF_EXECINSTR, reinterpret_cast<Size>(addr), 0, size);
+			setSection(sections, SECTION_EH_FRAME, SHT_PROGBITS, SHF_ALLOC,
+				reinterpret_cast<Size>(mData.data() + ehFrameOffset), ehFrameOffset, ehFrame.getSize());
+			setSection(sections, SECTION_SYMTAB, SHT_SYMTAB, 0, 0, symtabOffset, sizeof(Sym) * 2);
+			sections[SECTION_SYMTAB].sh_link = SECTION_STRTAB;
+			sections[SECTION_SYMTAB].sh_info = 1; // index of first global symbol
+			sections[SECTION_SYMTAB].sh_entsize = sizeof(Sym);
+			setSection(sections, SECTION_STRTAB, SHT_STRTAB, 0, 0, strtabOffset, nameSize + 1);
+			setSection(sections, SECTION_SHSTRTAB, SHT_STRTAB, 0, 0, shstrtabOffset, sizeof(SECTION_NAMES));
+
+			Sym* symbol = reinterpret_cast<Sym*>(mData.data() + symtabOffset) + 1;
+			symbol->st_name = 1;
+			symbol->st_value = reinterpret_cast<Size>(addr);
+			symbol->st_size = size;
+			symbol->st_info = ELF32_ST_INFO(STB_GLOBAL, STT_FUNC);
+			symbol->st_shndx = SECTION_TEXT;
+
+			std::memcpy(mData.data() + strtabOffset + 1, name, nameSize);
+			std::memcpy(mData.data() + shstrtabOffset, SECTION_NAMES, sizeof(SECTION_NAMES));
+			return true;
+		}
+	public:
+		GdbJitObject() : mSize(0), mEntry(), mRegistered(false) {}
+		GdbJitObject(const GdbJitObject&) = delete;
+		GdbJitObject& operator=(const GdbJitObject&) = delete;
+		~GdbJitObject() {
+			unregisterCode();
+		}
+
+		/* Build object for function code range [addr, addr + size) with call frame instructions
+		 * in case object not fit into buffer or addresses not fit into target ELF class return false
+		 */
+		bool build(const char* name, Addr addr, Size size, const Dwarf::Target& target, const uint8_t* cfi, Size cfiSize) {
+			if (mRegistered) {
+				return false;
+			}
+			mSize = 0;
+			if (target.addressSize == sizeof(uint32_t)) {
+				// section of unwind info placed at address of object buffer
+				if (reinterpret_cast<uintptr_t>(mData.data()) + CAPACITY > UINT32_MAX) {
+					return false;
+				}
+				return buildElf<Elf32>(name, addr, size, target, cfi, cfiSize);
+			}
+			return buildElf<Elf64>(name, addr, size, target, cfi, cfiSize);
+		}
+
+		template<Size CFI_CAPACITY>
+		bool build(const char* name, Addr addr, Size size, const Dwarf::CfiProgram<CFI_CAPACITY>& program) {
+			return program.isValid() && build(name, addr, size, program.getTarget(), program.getData(), program.getSize());
+		}
+
+		/* Notify debugger about built object */
+		bool registerCode() {
+			if (mRegistered || !mSize) {
+				return false;
+			}
+			mEntry.symfileAddr = reinterpret_cast<const char*>(mData.data());
+			mEntry.symfileSize = mSize;
+			GdbJit::registerEntry(mEntry);
+			mRegistered = true;
+			return true;
+		}
+
+		/* Build and register object for finalized function generator */
+		template<class GEN>
+		bool registerFunction(const char* name, const GEN& gen) {
+			return build(name, gen.getAddress(), gen.getSize(), gen.getUnwindInfo()) && registerCode();
+		}
+
+		void unregisterCode() {
+			if (mRegistered) {
+				GdbJit::unregisterEntry(mEntry);
+				mRegistered = false;
+			}
+		}
+
+		const uint8_t* getData() const {
+			return mData.data();
+		}
+
+		Size getSize() const {
+			return mSize;
+		}
+
+		bool isRegistered() const {
+			return mRegistered;
+		}
+	};
+}
\ No newline at end of file
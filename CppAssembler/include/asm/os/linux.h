@@ -0,0 +1,314 @@
+#pragma once
+
+#include "../os.h"
+#include "../dwarf.h"
+#include "../arch/x86_i386.h"
+#include "../arch/x64_i386.h"
+#include "function_gen.h"
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <sys/mman.h>
+
+namespace CppAsm::Linux
+{
+	class CodeBlock : public Os::CodeBlock {
+	private:
+		template<class T>
+		constexpr static T funcTypeCast(Addr addr) {
+			return reinterpret_cast<T>(addr);
+		}
+
+		static void* allocateCodeBlockMem(Size size) {
+			void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			return (address != MAP_FAILED) ? address : nullptr;
+		}
+		static void freeCodeBlockMem(void* address, Size size) {
+			munmap(address, size);
+		}
+	public:
+		CodeBlock(Size size) : Os::CodeBlock(allocateCodeBlockMem(size), size) {}
+		~CodeBlock() {
+			if (getStartPtr()) {
+				freeCodeBlockMem(const_cast<uint8_t*>(getStartPtr()), getTotalSize());
+			}
+		}
+
+		template<class R = void, class... P>
+		R invokeAddr(Addr addr, P... args) {
+			typedef R(*funcType)(P...);
+			return funcTypeCast<funcType>(addr)(args...);
+		}
+
+		template<class R = void, class... P>
+		R invoke(P... args) {
+			return invokeAddr<R>(getStartPtr(), args...);
+		}
+	};
+
+	/* Callback of finalized function generator with its code range */
+	typedef void (*FinalizeCallback)(void* context, const char* name, Addr addr, Size size);
+
+	struct FinalizeHook {
+		FinalizeCallback callback;
+		void* context;
+		const char* name;
+
+		void invoke(Addr addr, Size size) const {
+			if (callback) {
+				callback(context, name, addr, size);
+			}
+		}
+	};
+
+	typedef X86::Mem32<X86::BASE_OFFSET> FunctionParam;
+	typedef X86::Mem32<X86::BASE_OFFSET> FunctionVar;
+
+	/* Generator of cdecl function frame which records DWARF call frame
+	 * instructions of emitted prologue and epilogue, so debuggers and
+	 * unwinders registered with getUnwindInfo() can walk through it.
+	 */
+	template<X86::Reg32 BASE_REG = X86::EBP>
+	class FunctionGen : public X86::i386 {
+	private:
+		Os::CodeBlock& mBlock;
+		Addr mStartPtr;
+		uint32_t mLocalVarsSize;
+		uint16_t mParamsSize;
+		bool mFinalized;
+		Dwarf::CfiProgram<> mUnwindInfo;
+		FinalizeHook mFinalizeHook;
+
+		Offset getCodeOffset() const {
+			return mBlock.getCurrentPtr() - mStartPtr;
+		}
+	protected:
+		void beginFunction(Os::CodeBlock& block, uint32_t localVarsSize) {
+			Push(block, BASE_REG);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfaOffset(8);
+			mUnwindInfo.offset(BASE_REG, 8);
+			Mov(block, BASE_REG, X86::ESP);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfaRegister(BASE_REG);
+			if (localVarsSize) {
+				Sub(block, X86::ESP, U32(localVarsSize));
+			}
+		}
+
+		void endFunction(Os::CodeBlock& block) {
+			if (mLocalVarsSize) {
+				Mov(block, X86::ESP, BASE_REG);
+			}
+			Pop(block, BASE_REG);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfa(X86::ESP, 4);
+			mUnwindInfo.restore(BASE_REG);
+			Ret(block);
+		}
+	public:
+		FunctionGen(Os::CodeBlock& block, uint16_t paramsSize = 0, uint32_t localVarsSize = 0) :
+			mBlock(block), mStartPtr(block.getCurrentPtr()), mLocalVarsSize(localVarsSize),
+			mParamsSize(paramsSize), mFinalized(false), mUnwindInfo(Dwarf::TARGET_X86), mFinalizeHook()
+		{
+			beginFunction(block, localVarsSize);
+		}
+		FunctionGen(const FunctionGen&) = delete;
+		void operator=(const FunctionGen&) = delete;
+
+		~FunctionGen() {
+			finalize();
+		}
+
+		/* Emit function epilogue, after it function size and unwind info are complete */
+		void finalize() {
+			if (!mFinalized) {
+				endFunction(mBlock);
+				mFinalized = true;
+				mFinalizeHook.invoke(getAddress(), getSize());
+			}
+		}
+
+		/* Set callback invoked once by finalize() with function code range (e.g. PerfRegistry::attach) */
+		void setFinalizeHook(FinalizeCallback callback, void* context, const char* name) {
+			mFinalizeHook = { callback, context, name };
+		}
+
+		Addr getAddress() const {
+			return mStartPtr;
+		}
+
+		Size getSize() const {
+			return getCodeOffset();
+		}
+
+		/* Get call frame instructions of function */
+		const Dwarf::CfiProgram<>& getUnwindInfo() const {
+			return mUnwindInfo;
+		}
+
+		FunctionVar getVariable(uint32_t offset) const {
+			assert(offset < mLocalVarsSize);
+			return FunctionVar(BASE_REG, -4 - offset);
+		}
+
+		FunctionParam getParameter(uint32_t offset) const {
+			assert(offset < mParamsSize);
+			return FunctionParam(BASE_REG, 8 + offset);
+		}
+
+		/* Move float (DWORD_PTR) or double (QWORD_PTR) result from XMM register into ST(0),
+		 * where x86 calling conventions return floating point values
+		 */
+		template<X86::MemSize SIZE = X86::QWORD_PTR>
+		void setFloatResult(X86::RegXMM reg) {
+			Os::setFloatResult<SIZE>(mBlock, reg);
+		}
+	};
+
+	typedef X64::Mem64<X64::BASE_OFFSET> FunctionVar64;
+
+	/* Generator of System V x64 function frame which saves callee-saved registers,
+	 * keeps stack 16 byte aligned and records DWARF call frame instructions
+	 * of pushes and stack adjustments it emits.
+	 */
+	template<X64::Reg64 BASE_REG = X64::RBP>
+	class FunctionGen64 : public X64::i386 {
+	private:
+		constexpr static Size MAX_SAVED_REGS = 8;
+
+		Os::CodeBlock& mBlock;
+		Addr mStartPtr;
+		uint32_t mLocalVarsSize;
+		std::array<X64::Reg64, MAX_SAVED_REGS> mSavedRegs;
+		Size mSavedRegsCount;
+		bool mFinalized;
+		Dwarf::CfiProgram<> mUnwindInfo;
+		FinalizeHook mFinalizeHook;
+
+		Offset getCodeOffset() const {
+			return mBlock.getCurrentPtr() - mStartPtr;
+		}
+
+		static uint32_t alignLocalVarsSize(uint32_t localVarsSize, Size savedRegsCount) {
+			Size savedSize = savedRegsCount * 8;
+			return static_cast<uint32_t>(((savedSize + localVarsSize + 15) & ~Size(15)) - savedSize);
+		}
+
+		template<class BLOCK>
+		static void adjustStack(BLOCK& block, bool allocate, uint32_t size) {
+			if (size <= INT8_MAX) {
+				if (allocate) {
+					Sub(block, X64::RSP, S8(size));
+				} else {
+					Add(block, X64::RSP, S8(size));
+				}
+			} else {
+				if (allocate) {
+					Sub(block, X64::RSP, S32(size));
+				} else {
+					Add(block, X64::RSP, S32(size));
+				}
+			}
+		}
+	protected:
+		void beginFunction(Os::CodeBlock& block) {
+			Push(block, BASE_REG);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfaOffset(16);
+			mUnwindInfo.offset(Dwarf::getRegX64(BASE_REG), 16);
+			Mov(block, BASE_REG, X64::RSP);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfaRegister(Dwarf::getRegX64(BASE_REG));
+			for (Size i = 0; i < mSavedRegsCount; i++) {
+				Push(block, mSavedRegs[i]);
+				mUnwindInfo.advanceTo(getCodeOffset());
+				mUnwindInfo.offset(Dwarf::getRegX64(mSavedRegs[i]), 16 + 8 * (i + 1));
+			}
+			if (mLocalVarsSize) {
+				adjustStack(block, true, mLocalVarsSize);
+			}
+		}
+
+		void endFunction(Os::CodeBlock& block) {
+			if (mLocalVarsSize) {
+				adjustStack(block, false, mLocalVarsSize);
+			}
+			for (Size i = mSavedRegsCount; i > 0; i--) {
+				Pop(block, mSavedRegs[i - 1]);
+				mUnwindInfo.advanceTo(getCodeOffset());
+				mUnwindInfo.restore(Dwarf::getRegX64(mSavedRegs[i - 1]));
+			}
+			Pop(block, BASE_REG);
+			mUnwindInfo.advanceTo(getCodeOffset());
+			mUnwindInfo.defCfa(Dwarf::getRegX64(X64::RSP), 8);
+			mUnwindInfo.restore(Dwarf::getRegX64(BASE_REG));
+			Ret(block);
+		}
+	public:
+		FunctionGen64(Os::CodeBlock& block, uint32_t localVarsSize = 0, std::initializer_list<X64::Reg64> savedRegs = {}) :
+			mBlock(block), mStartPtr(block.getCurrentPtr()), mLocalVarsSize(0), mSavedRegs(),
+			mSavedRegsCount(0), mFinalized(false), mUnwindInfo(Dwarf::TARGET_X64), mFinalizeHook()
+		{
+			assert(savedRegs.size() <= MAX_SAVED_REGS);
+			for (X64::Reg64 reg : savedRegs) {
+				mSavedRegs[mSavedRegsCount++] = reg;
+			}
+			mLocalVarsSize = alignLocalVarsSize(localVarsSize, mSavedRegsCount);
+			beginFunction(block);
+		}
+		FunctionGen64(const FunctionGen64&) = delete;
+		void operator=(const FunctionGen64&) = delete;
+
+		~FunctionGen64() {
+			finalize();
+		}
+
+		/* Emit function epilogue, after it function size and unwind info are complete */
+		void finalize() {
+			if (!mFinalized) {
+				endFunction(mBlock);
+				mFinalized = true;
+				mFinalizeHook.invoke(getAddress(), getSize());
+			}
+		}
+
+		/* Set callback invoked once by finalize() with function code range (e.g. PerfRegistry::attach) */
+		void setFinalizeHook(FinalizeCallback callback, void* context, const char* name) {
+			mFinalizeHook = { callback, context, name };
+		}
+
+		Addr getAddress() const {
+			return mStartPtr;
+		}
+
+		Size getSize() const {
+			return getCodeOffset();
+		}
+
+		/* Get call frame instructions of function */
+		const Dwarf::CfiProgram<>& getUnwindInfo() const {
+			return mUnwindInfo;
+		}
+
+		FunctionVar64 getVariable(uint32_t offset) const {
+			assert(offset < mLocalVarsSize);
+			return FunctionVar64(BASE_REG, -static_cast<int32_t>(8 * mSavedRegsCount + 8 + offset));
+		}
+
+		/* Get register of integer or pointer parameter (first 6 are passed in registers) */
+		static X64::Reg64 getParameter(Size index) {
+			constexpr static X64::Reg64 PARAMS[] = { X64::RDI, X64::RSI, X64::RDX, X64::RCX, X64::R8, X64::R9 };
+			assert(index < sizeof(PARAMS) / sizeof(PARAMS[0]));
+			return PARAMS[index];
+		}
+
+		/* Get register of float or double parameter, counted separately from integer parameters
+		 * (first 8 are passed in XMM0-XMM7), result is returned in XMM0
+		 */
+		static X64::RegXMM getFloatParameter(Size index) {
+			assert(index < 8);
+			return static_cast<X64::RegXMM>(X64::XMM0 + index);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <new>
+#include <elf.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "../os.h"
+
+namespace CppAsm::Linux
+{
+	/* Writer of /tmp/perf-<pid>.map symbols file used by perf to name JIT code */
+	class PerfMap {
+	private:
+		FILE* mFile;
+		std::mutex mMutex;
+	public:
+		explicit PerfMap(const char* directory = "/tmp") : mFile(nullptr) {
+			char path[256];
+			std::snprintf(path, sizeof(path), "%s/perf-%d.map", directory, static_cast<int>(getpid()));
+			mFile = std::fopen(path, "a");
+		}
+		PerfMap(const PerfMap&) = delete;
+		void operator=(const PerfMap&) = delete;
+		~PerfMap() {
+			if (mFile) {
+				std::fclose(mFile);
+			}
+		}
+
+		bool isOpen() const {
+			return mFile != nullptr;
+		}
+
+		/* Add symbol for code range [addr, addr + size) */
+		bool registerCode(const char* name, Addr addr, Size size) {
+			if (!mFile) {
+				return false;
+			}
+			std::lock_guard<std::mutex> lock(mMutex);
+			std::fprintf(mFile, "%zx %zx %s\n", reinterpret_cast<Size>(addr), size, name);
+			return std::fflush(mFile) == 0;
+		}
+	};
+
+	/* Writer of jit-<pid>.dump file in perf jitdump format,
+	 * in addition to symbols it stores copy of generated code so
+	 * perf annotate can disassemble it after process exit.
+	 * Use "perf record -k mono" and "perf inject --jit" to process it.
+	 */
+	class JitDump {
+	private:
+		enum RecordType : uint32_t {
+			JIT_CODE_LOAD = 0,
+			JIT_CODE_CLOSE = 3
+		};
+
+		struct FileHeader {
+			uint32_t magic;
+			uint32_t version;
+			uint32_t totalSize;
+			uint32_t elfMach;
+			uint32_t pad1;
+			uint32_t pid;
+			uint64_t timestamp;
+			uint64_t flags;
+		};
+
+		struct RecordHeader {
+			uint32_t id;
+			uint32_t totalSize;
+			uint64_t timestamp;
+		};
+
+		struct CodeLoadRecord {
+			RecordHeader header;
+			uint32_t pid;
+			uint32_t tid;
+			uint64_t vma;
+			uint64_t codeAddr;
+			uint64_t codeSize;
+			uint64_t codeIndex;
+		};
+
+		constexpr static uint32_t JITDUMP_MAGIC = 0x4A695444;
+		constexpr static uint32_t JITDUMP_VERSION = 1;
+
+		FILE* mFile;
+		void* mMarker;
+		Size mMarkerSize;
+		uint64_t mCodeIndex;
+		std::mutex mMutex;
+
+		static uint64_t getTimestamp() {
+			timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+		}
+
+		constexpr static uint32_t getElfMachine() {
+#if defined(__x86_64__) || defined(_M_X64)
+			return EM_X86_64;
+#else
+			return EM_386;
+#endif
+		}
+	public:
+		explicit JitDump(const char* directory = "/tmp") : mFile(nullptr), mMarker(nullptr), mMarkerSize(0), mCodeIndex(0) {
+			char path[256];
+			std::snprintf(path, sizeof(path), "%s/jit-%d.dump", directory, static_cast<int>(getpid()));
+			mFile = std::fopen(path, "w+");
+			if (!mFile) {
+				return;
+			}
+			// perf finds dump file by executable mapping of it
+			mMarkerSize = static_cast<Size>(sysconf(_SC_PAGESIZE));
+			mMarker = mmap(nullptr, mMarkerSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(mFile), 0);
+			if (mMarker == MAP_FAILED) {
+				mMarker = nullptr;
+			}
+			FileHeader header = { JITDUMP_MAGIC, JITDUMP_VERSION, sizeof(FileHeader), getElfMachine(), 0,
+				static_cast<uint32_t>(getpid()), getTimestamp(), 0 };
+			std::fwrite(&header, sizeof(header), 1, mFile);
+			std::fflush(mFile);
+		}
+		JitDump(const JitDump&) = delete;
+		void operator=(const JitDump&) = delete;
+		~JitDump() {
+			if (!mFile) {
+				return;
+			}
+			RecordHeader record = { JIT_CODE_CLOSE, sizeof(RecordHeader), getTimestamp() };
+			std::fwrite(&record, sizeof(record), 1, mFile);
+			if (mMarker) {
+				munmap(mMarker, mMarkerSize);
+			}
+			std::fclose(mFile);
+		}
+
+		bool isOpen() const {
+			return mFile != nullptr;
+		}
+
+		/* Add code load record with symbol and copy of code range [addr, addr + size) */
+		bool registerCode(const char* name, Addr addr, Size size) {
+			if (!mFile) {
+				return false;
+			}
+			Size nameSize = std::strlen(name) + 1;
+			std::lock_guard<std::mutex> lock(mMutex);
+			CodeLoadRecord record;
+			record.header.id = JIT_CODE_LOAD;
+			record.header.totalSize = static_cast<uint32_t>(sizeof(record) + nameSize + size);
+			record.header.timestamp = getTimestamp();
+			record.pid = static_cast<uint32_t>(getpid());
+			record.tid = static_cast<uint32_t>(syscall(SYS_gettid));
+			record.vma = reinterpret_cast<uint64_t>(addr);
+			record.codeAddr = reinterpret_cast<uint64_t>(addr);
+			record.codeSize = size;
+			record.codeIndex = mCodeIndex++;
+			std::fwrite(&record, sizeof(record), 1, mFile);
+			std::fwrite(name, nameSize, 1, mFile);
+			std::fwrite(addr, size, 1, mFile);
+			return std::fflush(mFile) == 0;
+		}
+	};
+
+	/* Opt-in registry of generated functions for Linux profilers,
+	 * function generators attached with attach() are registered on finalize
+	 */
+	class PerfRegistry {
+	public:
+		enum Output : uint8_t {
+			PERF_MAP = 0b01,
+			JIT_DUMP = 0b10
+		};
+	private:
+		PerfMap* mPerfMap;
+		JitDump* mJitDump;
+		alignas(PerfMap) uint8_t mPerfMapStorage[sizeof(PerfMap)];
+		alignas(JitDump) uint8_t mJitDumpStorage[sizeof(JitDump)];
+
+		static void onFinalize(void* context, const char* name, Addr addr, Size size) {
+			static_cast<PerfRegistry*>(context)->registerFunction(name, addr, size);
+		}
+	public:
+		/* Directory other than /tmp only useful for perf map post-processing tools */
+		explicit PerfRegistry(uint8_t outputs = PERF_MAP, const char* directory = "/tmp") :
+			mPerfMap(nullptr), mJitDump(nullptr)
+		{
+			if (outputs & PERF_MAP) {
+				mPerfMap = new (mPerfMapStorage) PerfMap(directory);
+			}
+			if (outputs & JIT_DUMP) {
+				mJitDump = new (mJitDumpStorage) JitDump(directory);
+			}
+		}
+		PerfRegistry(const PerfRegistry&) = delete;
+		void operator=(const PerfRegistry&) = delete;
+		~PerfRegistry() {
+			if (mPerfMap) {
+				mPerfMap->~PerfMap();
+			}
+			if (mJitDump) {
+				mJitDump->~JitDump();
+			}
+		}
+
+		/* Register finalized function code range [addr, addr + size) */
+		bool registerFunction(const char* name, Addr addr, Size size) {
+			bool result = true;
+			if (mPerfMap) {
+				result &= mPerfMap->registerCode(name, addr, size);
+			}
+			if (mJitDump) {
+				result &= mJitDump->registerCode(name, addr, size);
+			}
+			return result;
+		}
+
+		/* Register function code range [startAddr, block current write position) */
+		template<class BLOCK>
+		bool registerFunction(const char* name, const BLOCK& block, Addr startAddr) {
+			return registerFunction(name, startAddr, static_cast<Size>(block.getCurrentPtr() - startAddr));
+		}
+
+		/* Register function of generator with specified name when generator finalized,
+		 * registry must stay alive until then
+		 */
+		template<class GEN>
+		void attach(GEN& gen, const char* name) {
+			gen.setFinalizeHook(&PerfRegistry::onFinalize, this, name);
+		}
+
+		/* Register all written code of block */
+		template<class BLOCK>
+		bool registerBlock(const char* name, const BLOCK& block) {
+			return registerFunction(name, block.getStartPtr(), block.getSize());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+
+#include "../os.h"
+#include "../dwarf.h"
+
+/* Runtime unwinder registration functions provided by libgcc */
+extern "C" void __register_frame(void* begin);
+extern "C" void __deregister_frame(void* begin);
+
+namespace CppAsm::Linux
+{
+	/* Registration of generated functions in runtime unwinder, so C++ exceptions
+	 * and backtrace() can unwind through them. Unwind info stored in fixed size
+	 * buffer to avoid heap allocations, object must stay alive while registered.
+	 */
+	template<Size CAPACITY = 256>
+	class FrameRegistration {
+	private:
+		alignas(sizeof(Addr)) std::array<uint8_t, CAPACITY> mData;
+		Size mSize;
+		bool mRegistered;
+	public:
+		FrameRegistration() : mSize(0), mRegistered(false) {}
+		FrameRegistration(const FrameRegistration&) = delete;
+		FrameRegistration& operator=(const FrameRegistration&) = delete;
+		~FrameRegistration() {
+			unregisterFrame();
+		}
+
+		/* Build .eh_frame for function code range [addr, addr + size)
+		 * in case unwind info not fit into buffer or not for host architecture return false
+		 */
+		template<Size CFI_CAPACITY>
+		bool build(Addr addr, Size size, const Dwarf::CfiProgram<CFI_CAPACITY>& program) {
+			if (mRegistered || !program.isValid() || program.getTarget().addressSize != sizeof(Addr)) {
+				return false;
+			}
+			Dwarf::EhFrameWriter ehFrame(mData.data(), CAPACITY, program.getTarget());
+			ehFrame.addFunction(addr, size, program);
+			ehFrame.finish();
+			mSize = ehFrame.isValid() ? ehFrame.getSize() : 0;
+			return mSize != 0;
+		}
+
+		/* Register built unwind info in runtime unwinder */
+		bool registerFrame() {
+			if (mRegistered || !mSize) {
+				return false;
+			}
+			__register_frame(mData.data());
+			mRegistered = true;
+			return true;
+		}
+
+		/* Build and register unwind info of finalized function generator */
+		template<class GEN>
+		bool registerFunction(const GEN& gen) {
+			return build(gen.getAddress(), gen.getSize(), gen.getUnwindInfo()) && registerFrame();
+		}
+
+		void unregisterFrame() {
+			if (mRegistered) {
+				__deregister_frame(mData.data());
+				mRegistered = false;
+			}
+		}
+
+		bool isRegistered() const {
+			return mRegistered;
+		}
+	};
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../os.h"
+#include "function_gen.h"
 #include <Windows.h>
 
 namespace CppAsm::Win32
@@ -177,5 +178,13 @@ namespace CppAsm::Win32
 			assert(offset < mParamsSize);
 			return FunctionParam(BASE_REG, 8 + offset);
 		}
+
+		/* Move float (DWORD_PTR) or double (QWORD_PTR) result from XMM register into ST(0),
+		 * where x86 calling conventions return floating point values
+		 */
+		template<X86::MemSize SIZE = X86::QWORD_PTR>
+		void setFloatResult(X86::RegXMM reg) {
+			Os::setFloatResult<SIZE>(mBlock, reg);
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <utility>
+
+#include "os.h"
+#include "replaceable.h"
+
+namespace CppAsm::Os
+{
+	enum RelocationType : uint8_t {
+		RELOC_ABS32,	// 32-bit absolute address of location inside block
+		RELOC_ABS64,	// 64-bit absolute address of location inside block
+		RELOC_REL32		// 32-bit displacement (call, jmp, rip) to location outside of block
+	};
+
+	struct Relocation {
+		Offset offset;
+		RelocationType type;
+	};
+
+	/* Table of code fields which must be adjusted when code is moved to other address.
+	 * Displacements between locations inside block (labels, jump tables on x64,
+	 * literal pool placed into block) stay valid and are not recorded.
+	 * Table is stored in fixed size array to avoid heap allocations.
+	 */
+	template<Size CAPACITY>
+	class RelocationTable {
+	private:
+		std::array<Relocation, CAPACITY> mRelocations;
+		Size mCount;
+
+		template<class T>
+		static void adjust(uint8_t* field, int64_t delta) {
+			T value;
+			std::memcpy(&value, field, sizeof(value));
+			value = static_cast<T>(value + delta);
+			std::memcpy(field, &value, sizeof(value));
+		}
+
+		static Size getFieldSize(RelocationType type) {
+			return (type == RELOC_ABS64) ? sizeof(uint64_t) : sizeof(uint32_t);
+		}
+	public:
+		RelocationTable() : mCount(0) {}
+
+		/* Record field at offset from block start,
+		 * in case table is full return false
+		 */
+		bool add(Offset offset, RelocationType type) {
+			if (mCount >= CAPACITY) {
+				return false;
+			}
+			mRelocations[mCount++] = { offset, type };
+			return true;
+		}
+
+		/* Record replaceable field returned by instruction */
+		bool add(const Replaceable& field, RelocationType type) {
+			return add(field.getCbOffset(), type);
+		}
+
+		/* Record field of last written instruction followed by immSize bytes of immediate operand,
+		 * e.g. rel32 of call (immSize 0) or disp32 of [offset],imm8 operand (immSize 1)
+		 */
+		template<class BLOCK>
+		bool addLast(const BLOCK& block, RelocationType type, Size immSize = 0) {
+			return add(block.getOffset() - immSize - getFieldSize(type), type);
+		}
+
+		Size getCount() const {
+			return mCount;
+		}
+
+		const Relocation& get(Size index) const {
+			return mRelocations[index];
+		}
+
+		/* Adjust recorded fields of code already copied from oldBase to code,
+		 * in case displacement to outside location overflow return false
+		 */
+		bool apply(void* code, Addr oldBase) const {
+			int64_t delta = static_cast<uint8_t*>(code) - oldBase;
+			bool result = true;
+			for (Size i = 0; i < mCount; i++) {
+				uint8_t* field = static_cast<uint8_t*>(code) + mRelocations[i].offset;
+				switch (mRelocations[i].type) {
+				case RELOC_ABS32:
+					adjust<uint32_t>(field, delta);
+					break;
+				case RELOC_ABS64:
+					adjust<uint64_t>(field, delta);
+					break;
+				case RELOC_REL32: {
+					int32_t displacement;
+					std::memcpy(&displacement, field, sizeof(displacement));
+					result &= (displacement - delta == static_cast<int32_t>(displacement - delta));
+					adjust<int32_t>(field, -delta);
+					break;
+				}
+				}
+			}
+			return result;
+		}
+
+		/* Copy written code of block to new address and adjust recorded fields,
+		 * destination must have at least block.getSize() bytes
+		 */
+		template<class BLOCK>
+		bool relocateTo(const BLOCK& block, void* newBase) const {
+			std::memcpy(newBase, block.getStartPtr(), block.getSize());
+			return apply(newBase, block.getStartPtr());
+		}
+
+		/* Copy written code of block to current position of destination block
+		 * and adjust recorded fields
+		 */
+		template<class BLOCK, class DEST_BLOCK>
+		bool relocateTo(const BLOCK& block, DEST_BLOCK& destBlock) const {
+			Addr newBase = destBlock.getCurrentPtr();
+			destBlock.pushBytes(block.getStartPtr(), block.getSize());
+			return apply(const_cast<uint8_t*>(newBase), block.getStartPtr());
+		}
+
+		/* Remove fields at offset and after it */
+		void removeFrom(Offset offset) {
+			Size count = 0;
+			for (Size i = 0; i < mCount; i++) {
+				if (mRelocations[i].offset < offset) {
+					mRelocations[count++] = mRelocations[i];
+				}
+			}
+			mCount = count;
+		}
+
+		void reset() {
+			mCount = 0;
+		}
+	};
+
+	/* Code block which records relocations while code is emitted:
+	 * rel32 fields written by encoders (CALL to address, x64 RIP-relative operands)
+	 * are recorded when their target is outside of block.
+	 * Absolute addresses of locations inside block are recorded by add().
+	 */
+	template<Size CAPACITY, class BLOCK = CodeBlock>
+	class RelocatingBlock : public BLOCK {
+	private:
+		RelocationTable<CAPACITY> mRelocations;
+		bool mOverflow;
+	public:
+		template<class... ARGS>
+		explicit RelocatingBlock(ARGS&&... args) : BLOCK(std::forward<ARGS>(args)...), mOverflow(false) {}
+		RelocatingBlock(const RelocatingBlock&) = delete;
+		RelocatingBlock& operator=(const RelocatingBlock&) = delete;
+
+		/* Called by encoders for rel32 field at offset */
+		void addRel32(Offset offset, Addr target) {
+			Addr start = BLOCK::getStartPtr();
+			if (target < start || target >= start + BLOCK::getTotalSize()) {
+				add(offset, RELOC_REL32);
+			}
+		}
+
+		/* Record field at offset from block start */
+		void add(Offset offset, RelocationType type) {
+			mOverflow |= !mRelocations.add(offset, type);
+		}
+
+		const RelocationTable<CAPACITY>& getRelocations() const {
+			return mRelocations;
+		}
+
+		/* Copy written code to new address and adjust recorded fields,
+		 * in case relocation table overflowed or displacement overflow return false
+		 */
+		bool relocateTo(void* newBase) const {
+			return mRelocations.relocateTo(*this, newBase) && !mOverflow;
+		}
+
+		template<class DEST_BLOCK>
+		bool relocateTo(DEST_BLOCK& destBlock) const {
+			return mRelocations.relocateTo(*this, destBlock) && !mOverflow;
+		}
+
+		/* Reset current write position to start and clear relocations */
+		void reset() {
+			BLOCK::reset();
+			mRelocations.reset();
+			mOverflow = false;
+		}
+
+		/* Reset current write position to specified position and drop relocations from it
+		 * in case address not in block range return false
+		 */
+		bool reset(Addr ptr) {
+			if (!BLOCK::reset(ptr)) {
+				return false;
+			}
+			mRelocations.removeFrom(BLOCK::getOffset());
+			return true;
+		}
+	};
+}
\ No newline at end of file
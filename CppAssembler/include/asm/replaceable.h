@@ -25,6 +25,14 @@ namespace CppAsm
 			block.writeRaw(value, getCbOffset());
 		}
 
+		/* Replace value in code executed by other threads with single atomic store,
+		 * in case value crosses aligned 8 bytes return false (see Os::alignPatchable)
+		 */
+		template<class BLOCK>
+		bool replaceAtomic(BLOCK& block, const T& value) const {
+			return block.writeRawAtomic(value, getCbOffset());
+		}
+
 		template<class BLOCK>
 		T read(BLOCK& block) const {
 			T readValue;
@@ -53,6 +61,16 @@ namespace CppAsm
 			block.writeRaw(replaceByte, getCbOffset());
 		}
 
+		/* Replace bits in code executed by other threads with single atomic store */
+		template<class BLOCK>
+		bool replaceAtomic(BLOCK& block, const T& value) const {
+			uint8_t replaceByte;
+			block.readRaw(replaceByte, getCbOffset());
+			replaceByte &= ~(MASK << mBitOffset);
+			replaceByte |= value << mBitOffset;
+			return block.writeRawAtomic(replaceByte, getCbOffset());
+		}
+
 		template<class BLOCK>
 		T read(BLOCK& block) const {
 			uint8_t readValue;
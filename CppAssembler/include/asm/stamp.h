@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstring>
+
+#include "os.h"
+#include "replaceable.h"
+
+namespace CppAsm::Os
+{
+	/* Instruction sequence encoded once and replicated many times (loop unrolling).
+	 * Fields of template (displacements, immediates) are recorded with per copy step,
+	 * copy i gets value of template field plus i * step.
+	 * Copies are replicated by doubling block copies of already written code instead
+	 * of running encoders again. Template is stored in fixed size array to avoid heap allocations.
+	 */
+	template<Size CAPACITY = 64, Size FIELDS = 8>
+	class Stamp {
+	private:
+		struct Field {
+			Offset offset;
+			uint8_t size;
+			int64_t step;
+		};
+
+		std::array<uint8_t, CAPACITY> mData;
+		Size mSize;
+		std::array<Field, FIELDS> mFields;
+		Size mFieldsCount;
+
+		int64_t readField(const Field& field) const {
+			switch (field.size) {
+			case sizeof(int8_t): {
+				int8_t value;
+				std::memcpy(&value, mData.data() + field.offset, sizeof(value));
+				return value;
+			}
+			case sizeof(int16_t): {
+				int16_t value;
+				std::memcpy(&value, mData.data() + field.offset, sizeof(value));
+				return value;
+			}
+			case sizeof(int32_t): {
+				int32_t value;
+				std::memcpy(&value, mData.data() + field.offset, sizeof(value));
+				return value;
+			}
+			default: {
+				int64_t value;
+				std::memcpy(&value, mData.data() + field.offset, sizeof(value));
+				return value;
+			}
+			}
+		}
+
+		static bool isFitField(const Field& field, int64_t value) {
+			switch (field.size) {
+			case sizeof(int8_t):
+				return value == static_cast<int8_t>(value);
+			case sizeof(int16_t):
+				return value == static_cast<int16_t>(value);
+			case sizeof(int32_t):
+				return value == static_cast<int32_t>(value);
+			default:
+				return true;
+			}
+		}
+
+		template<class BLOCK>
+		static void writeField(BLOCK& block, const Field& field, Offset offset, int64_t value) {
+			switch (field.size) {
+			case sizeof(int8_t):
+				block.writeRaw(static_cast<int8_t>(value), offset);
+				break;
+			case sizeof(int16_t):
+				block.writeRaw(static_cast<int16_t>(value), offset);
+				break;
+			case sizeof(int32_t):
+				block.writeRaw(static_cast<int32_t>(value), offset);
+				break;
+			default:
+				block.writeRaw(value, offset);
+				break;
+			}
+		}
+	public:
+		Stamp() : mSize(0), mFieldsCount(0) {}
+
+		/* Encode template by generator called with code block over template storage,
+		 * previously recorded template and fields are removed
+		 */
+		template<class GENERATOR>
+		void record(GENERATOR&& generator) {
+			mSize = 0;
+			mFieldsCount = 0;
+			CodeBlock block(mData.data(), CAPACITY);
+			generator(block);
+			mSize = block.getSize();
+		}
+
+		/* Record template field which value is increased by step in every next copy,
+		 * in case fields table is full return false
+		 */
+		template<class T>
+		bool addField(const ReplaceableValue<T>& field, int64_t step) {
+			static_assert(sizeof(T) <= sizeof(int64_t), "Stamp: field type too large");
+			if (mFieldsCount >= FIELDS) {
+				return false;
+			}
+			mFields[mFieldsCount++] = { field.getCbOffset(), static_cast<uint8_t>(sizeof(T)), step };
+			return true;
+		}
+
+		/* Write count copies of template into block,
+		 * in case value of field in last copy not fit field size return false and block is not changed
+		 */
+		template<class BLOCK>
+		bool stamp(BLOCK& block, Size count) const {
+			if (!count) {
+				return true;
+			}
+			for (Size i = 0; i < mFieldsCount; i++) {
+				const Field& field = mFields[i];
+				if (!isFitField(field, readField(field) + field.step * static_cast<int64_t>(count - 1))) {
+					return false;
+				}
+			}
+			Addr start = block.getCurrentPtr();
+			Offset startOffset = block.getOffset();
+			block.pushBytes(mData.data(), mSize);
+			for (Size copies = 1; copies < count;) {
+				Size copyCount = (count - copies < copies) ? count - copies : copies;
+				block.pushBytes(start, copyCount * mSize);
+				copies += copyCount;
+			}
+			for (Size i = 0; i < mFieldsCount; i++) {
+				const Field& field = mFields[i];
+				if (!field.step) {
+					continue;
+				}
+				int64_t value = readField(field);
+				Offset offset = startOffset + field.offset;
+				for (Size copy = 1; copy < count; copy++) {
+					value += field.step;
+					offset += mSize;
+					writeField(block, field, offset, value);
+				}
+			}
+			return true;
+		}
+
+		/* Get offset of template copy relative to stamp start (e.g. to bind labels of copy) */
+		Offset getCopyOffset(Size copy) const {
+			return copy * mSize;
+		}
+
+		/* Get template size in bytes */
+		Size getSize() const {
+			return mSize;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "asm/os/gdb_jit.h"
+#include <mutex>
+
+using CppAsm::Linux::JitCodeEntry;
+
+/* GDB JIT interface symbols, debugger set breakpoint on __jit_debug_register_code()
+ * and read __jit_debug_descriptor on every call. Define CPPASM_NO_GDB_JIT_SYMBOLS
+ * when application already provides them (e.g. links another JIT).
+ */
+extern "C" {
+	enum JitAction : uint32_t {
+		JIT_NOACTION = 0,
+		JIT_REGISTER_FN,
+		JIT_UNREGISTER_FN
+	};
+
+	struct JitDescriptor {
+		uint32_t version;
+		uint32_t actionFlag;
+		JitCodeEntry* relevantEntry;
+		JitCodeEntry* firstEntry;
+	};
+
+#ifndef CPPASM_NO_GDB_JIT_SYMBOLS
+	__attribute__((noinline)) void __jit_debug_register_code() {
+		__asm__ __volatile__("");
+	}
+
+	JitDescriptor __jit_debug_descriptor = { 1, JIT_NOACTION, nullptr, nullptr };
+#else
+	void __jit_debug_register_code();
+	extern JitDescriptor __jit_debug_descriptor;
+#endif
+}
+
+namespace CppAsm::Linux::GdbJit
+{
+	static std::mutex gJitMutex;
+
+	void registerEntry(JitCodeEntry& entry) {
+		std::lock_guard<std::mutex> lock(gJitMutex);
+		entry.prev = nullptr;
+		entry.next = __jit_debug_descriptor.firstEntry;
+		if (entry.next) {
+			entry.next->prev = &entry;
+		}
+		__jit_debug_descriptor.firstEntry = &entry;
+		__jit_debug_descriptor.relevantEntry = &entry;
+		__jit_debug_descriptor.actionFlag = JIT_REGISTER_FN;
+		__jit_debug_register_code();
+	}
+
+	void unregisterEntry(JitCodeEntry& entry) {
+		std::lock_guard<std::mutex> lock(gJitMutex);
+		if (entry.prev) {
+			entry.prev->next = entry.next;
+		} else {
+			__jit_debug_descriptor.firstEntry = entry.next;
+		}
+		if (entry.next) {
+			entry.next->prev = entry.prev;
+		}
+		__jit_debug_descriptor.relevantEntry = &entry;
+		__jit_debug_descriptor.actionFlag = JIT_UNREGISTER_FN;
+		__jit_debug_register_code();
+	}
+}
\ No newline at end of file
@@ -1,6 +1,19 @@
-#include "asm\os.h"
+#include "asm/os.h"
+#include <atomic>
 #include <cstring>
 #include <cassert>
+#include <mutex>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <csignal>
+#include <sched.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/membarrier.h>
+#endif
 
 namespace CppAsm::Os
 {
@@ -32,6 +45,227 @@ namespace CppAsm::Os
 		std::memcpy(data, mDataStart + offset, size);
 	}
 
+	static bool compareExchange64(uint64_t* addr, uint64_t& expected, uint64_t desired) {
+#ifdef _MSC_VER
+		uint64_t previous = static_cast<uint64_t>(_InterlockedCompareExchange64(
+			reinterpret_cast<volatile long long*>(addr), desired, expected));
+		bool exchanged = (previous == expected);
+		expected = previous;
+		return exchanged;
+#else
+		return __atomic_compare_exchange_n(addr, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+	}
+
+	bool BaseBlock::writeOffsetAtomic(Size offset, const void* data, Size size) {
+		verifyOffset(offset, size);
+		uintptr_t address = reinterpret_cast<uintptr_t>(mDataStart + offset);
+		Size wordOffset = address % sizeof(uint64_t);
+		if (wordOffset + size > sizeof(uint64_t)) {
+			return false;
+		}
+		// aligned word never crosses page, so bytes around block are accessible
+		uint64_t* word = reinterpret_cast<uint64_t*>(address - wordOffset);
+		uint64_t expected = *reinterpret_cast<volatile uint64_t*>(word);
+		uint64_t desired;
+		do {
+			desired = expected;
+			std::memcpy(reinterpret_cast<uint8_t*>(&desired) + wordOffset, data, size);
+		} while (!compareExchange64(word, expected, desired));
+		return true;
+	}
+
+	void BaseBlock::flushCode(Size offset, Size size) {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+#ifdef _WIN32
+		FlushInstructionCache(GetCurrentProcess(), mDataStart + offset, size);
+#else
+		__builtin___clear_cache(reinterpret_cast<char*>(mDataStart + offset),
+			reinterpret_cast<char*>(mDataStart + offset + size));
+#endif
+	}
+
+	/* Cross-modifying code protocol state: only one instruction patched at time,
+	 * threads which hit its temporary INT3 are sent back to it until it restored.
+	 * Recently patched addresses are remembered, so trap delivered after patch
+	 * finished is still recognized
+	 */
+	static constexpr uint8_t INT3 = 0xCC;
+	static constexpr Size PATCH_HISTORY_SIZE = 16;
+	static std::mutex gPatchMutex;
+	static std::atomic<const uint8_t*> gPatchAddress(nullptr);
+	static std::atomic<const uint8_t*> gPatchHistory[PATCH_HISTORY_SIZE];
+	static Size gPatchHistoryNext = 0;
+
+	static void addPatchHistory(const uint8_t* address) {
+		for (const auto& entry : gPatchHistory) {
+			if (entry.load() == address) {
+				return;
+			}
+		}
+		gPatchHistory[gPatchHistoryNext].store(address);
+		gPatchHistoryNext = (gPatchHistoryNext + 1) % PATCH_HISTORY_SIZE;
+	}
+
+	/* Return true when trap at address caused by temporary INT3 of patch,
+	 * (byte which is not INT3 anymore means patch finished after trap)
+	 */
+	static bool isPatchTrap(const uint8_t* address) {
+		if (address == gPatchAddress.load()) {
+			return true;
+		}
+		for (const auto& entry : gPatchHistory) {
+			if (entry.load() == address) {
+				return *reinterpret_cast<const volatile uint8_t*>(address) != INT3;
+			}
+		}
+		return false;
+	}
+
+#ifdef _WIN32
+	static LONG CALLBACK patchExceptionHandler(PEXCEPTION_POINTERS info) {
+		// breakpoint exception address is at INT3, resume from it
+		if (info->ExceptionRecord->ExceptionCode == EXCEPTION_BREAKPOINT &&
+			isPatchTrap(static_cast<const uint8_t*>(info->ExceptionRecord->ExceptionAddress)))
+		{
+#ifdef _WIN64
+			info->ContextRecord->Rip = reinterpret_cast<DWORD64>(info->ExceptionRecord->ExceptionAddress);
+#else
+			info->ContextRecord->Eip = reinterpret_cast<DWORD>(info->ExceptionRecord->ExceptionAddress);
+#endif
+			SwitchToThread();
+			return EXCEPTION_CONTINUE_EXECUTION;
+		}
+		return EXCEPTION_CONTINUE_SEARCH;
+	}
+
+	static void installPatchTrapHandler() {
+		AddVectoredExceptionHandler(1, patchExceptionHandler);
+	}
+
+	static bool initSerializeCores() {
+		return true;
+	}
+
+	/* Send interrupt to every processor running thread of process, interrupt return serialize them */
+	static bool serializeCores() {
+		FlushProcessWriteBuffers();
+		return true;
+	}
+#else
+	static struct sigaction gPreviousTrapAction;
+
+	static uintptr_t& getInstructionPointer(ucontext_t* context) {
+#if defined(__x86_64__)
+		return reinterpret_cast<uintptr_t&>(context->uc_mcontext.gregs[REG_RIP]);
+#else
+		return reinterpret_cast<uintptr_t&>(context->uc_mcontext.gregs[REG_EIP]);
+#endif
+	}
+
+	static void patchTrapHandler(int signal, siginfo_t* info, void* context) {
+		// after INT3 instruction pointer is at next byte
+		uintptr_t& ip = getInstructionPointer(static_cast<ucontext_t*>(context));
+		if (info->si_code == SI_KERNEL && isPatchTrap(reinterpret_cast<const uint8_t*>(ip - 1))) {
+			ip -= 1;
+			sched_yield();
+			return;
+		}
+		if (gPreviousTrapAction.sa_flags & SA_SIGINFO) {
+			gPreviousTrapAction.sa_sigaction(signal, info, context);
+		} else if (gPreviousTrapAction.sa_handler == SIG_DFL) {
+			std::signal(signal, SIG_DFL);
+			raise(signal);
+		} else if (gPreviousTrapAction.sa_handler != SIG_IGN) {
+			gPreviousTrapAction.sa_handler(signal);
+		}
+	}
+
+	static void installPatchTrapHandler() {
+		struct sigaction action;
+		std::memset(&action, 0, sizeof(action));
+		action.sa_sigaction = patchTrapHandler;
+		action.sa_flags = SA_SIGINFO | SA_RESTART;
+		sigemptyset(&action.sa_mask);
+		sigaction(SIGTRAP, &action, &gPreviousTrapAction);
+	}
+
+	static int gMembarrierCommand = 0;
+	static std::mutex gSerializePageMutex;
+	static void* gSerializePage = MAP_FAILED;
+
+	/* Select serialization mechanism, return false when none available */
+	static bool initSerializeCores() {
+		// SYNC_CORE variant (Linux 4.16) guarantee core serialization on all architectures,
+		// on x86 interrupt return of plain expedited membarrier also serialize
+		if (syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED_SYNC_CORE, 0) == 0) {
+			gMembarrierCommand = MEMBARRIER_CMD_PRIVATE_EXPEDITED_SYNC_CORE;
+			return true;
+		}
+		if (syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0) {
+			gMembarrierCommand = MEMBARRIER_CMD_PRIVATE_EXPEDITED;
+			return true;
+		}
+		// without membarrier protection downgrade of dirty page forces TLB shootdown interrupt
+		gSerializePage = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		return gSerializePage != MAP_FAILED;
+	}
+
+	/* Send interrupt to every processor running thread of process, interrupt return serialize them */
+	static bool serializeCores() {
+		if (gMembarrierCommand) {
+			return syscall(__NR_membarrier, gMembarrierCommand, 0) == 0;
+		}
+		std::lock_guard<std::mutex> lock(gSerializePageMutex);
+		Size pageSize = sysconf(_SC_PAGESIZE);
+		if (mprotect(gSerializePage, pageSize, PROT_READ | PROT_WRITE) != 0) {
+			return false;
+		}
+		// page must be dirty and present, otherwise kernel may skip flush
+		__atomic_add_fetch(static_cast<int*>(gSerializePage), 1, __ATOMIC_SEQ_CST);
+		return mprotect(gSerializePage, pageSize, PROT_NONE) == 0;
+	}
+#endif
+
+	bool CodeBlock::patchInstruction(Offset instrOffset, Size instrSize, Offset offset, const void* data, Size size) {
+		uint8_t code[15];
+		assert(instrSize <= sizeof(code));
+		assert(offset >= instrOffset && offset + size <= instrOffset + instrSize);
+		readOffset(instrOffset, code, instrSize);
+		std::memcpy(code + offset - instrOffset, data, size);
+		if (writeOffsetAtomic(instrOffset, code, instrSize)) {
+			flushCode(instrOffset, instrSize);
+			return true;
+		}
+
+		static std::once_flag initFlag;
+		static bool serializeAvailable = false;
+		std::call_once(initFlag, [] {
+			installPatchTrapHandler();
+			serializeAvailable = initSerializeCores();
+		});
+		if (!serializeAvailable) {
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(gPatchMutex);
+		gPatchAddress.store(getStartPtr() + instrOffset);
+		addPatchHistory(getStartPtr() + instrOffset);
+		// arriving threads trap on INT3 and wait, threads already inside instruction
+		// finish old version before serialization completes
+		writeOffsetAtomic(instrOffset, &INT3, sizeof(INT3));
+		flushCode(instrOffset, instrSize);
+		bool serialized = serializeCores();
+		writeOffset(instrOffset + sizeof(INT3), code + sizeof(INT3), instrSize - sizeof(INT3));
+		flushCode(instrOffset, instrSize);
+		serialized = serializeCores() && serialized;
+		writeOffsetAtomic(instrOffset, code, sizeof(INT3));
+		flushCode(instrOffset, instrSize);
+		serialized = serializeCores() && serialized;
+		gPatchAddress.store(nullptr);
+		return serialized;
+	}
+
 	BaseBlock::BaseBlock(void* data, Size size) :
 		mDataStart(static_cast<uint8_t*>(data)),
 		mDataCurr(static_cast<uint8_t*>(data)), mSize(size)
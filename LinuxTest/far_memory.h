@@ -0,0 +1,44 @@
+#pragma once
+
+#include <sys/mman.h>
+
+#include "test.h"
+#include "asm/defs.h"
+
+namespace UnitTest
+{
+	/* Executable memory mapped out of rel32 range of address,
+	 * for code which must be reached through veneer
+	 */
+	struct FarMemory {
+		void* address;
+		CppAsm::Size size;
+
+		FarMemory(CppAsm::Addr near, CppAsm::Size size) : address(nullptr), size(size) {
+			const uintptr_t distance = uintptr_t(8) << 30;
+			uintptr_t base = reinterpret_cast<uintptr_t>(near) & ~uintptr_t(0xFFFF);
+			for (uintptr_t i = 1; i <= 16 && !address; i++) {
+				const uintptr_t hints[] = { base + i * distance, base - i * distance };
+				for (uintptr_t hint : hints) {
+					void* mapped = mmap(reinterpret_cast<void*>(hint), size, PROT_READ | PROT_WRITE | PROT_EXEC,
+						MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+					if (mapped == reinterpret_cast<void*>(hint)) {
+						address = mapped;
+						break;
+					}
+					if (mapped != MAP_FAILED) {
+						munmap(mapped, size);
+					}
+				}
+			}
+			Assert::IsNotNull(address);
+		}
+
+		FarMemory(const FarMemory&) = delete;
+		FarMemory& operator=(const FarMemory&) = delete;
+
+		~FarMemory() {
+			munmap(address, size);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#include "test.h"
+
+/* Run all registered test methods (or only methods which name contains argument) */
+int main(int argc, char** argv) {
+	const char* filter = (argc > 1) ? argv[1] : nullptr;
+	int passed = 0;
+	int failed = 0;
+	for (UnitTest::TestCase* testCase = UnitTest::getTestCases(); testCase; testCase = testCase->next) {
+		if (filter && !std::strstr(testCase->methodName, filter)) {
+			continue;
+		}
+		try {
+			testCase->function();
+			passed++;
+			std::printf("[ PASSED ] %s::%s\n", testCase->className, testCase->methodName);
+		} catch (const UnitTest::AssertFailed& error) {
+			failed++;
+			std::printf("[ FAILED ] %s::%s: %s\n", testCase->className, testCase->methodName, error.message);
+		}
+	}
+	std::printf("%d passed, %d failed\n", passed, failed);
+	return failed ? 1 : 0;
+}
\ No newline at end of file
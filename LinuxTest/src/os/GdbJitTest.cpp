@@ -0,0 +1,164 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+/* GDB JIT interface descriptor defined in gdb_jit.cpp */
+extern "C" {
+	struct JitDescriptor {
+		uint32_t version;
+		uint32_t actionFlag;
+		Linux::JitCodeEntry* relevantEntry;
+		Linux::JitCodeEntry* firstEntry;
+	};
+
+	extern JitDescriptor __jit_debug_descriptor;
+}
+
+namespace UnitTest
+{
+	/* Test layout of in-memory ELF objects and GDB JIT interface list handling */
+	TEST_CLASS(GdbJitTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		static const Elf64_Shdr& getSection(const uint8_t* data, uint16_t index) {
+			const Elf64_Ehdr* header = reinterpret_cast<const Elf64_Ehdr*>(data);
+			return reinterpret_cast<const Elf64_Shdr*>(data + header->e_shoff)[index];
+		}
+
+		static const char* getSectionName(const uint8_t* data, uint16_t index) {
+			const Elf64_Ehdr* header = reinterpret_cast<const Elf64_Ehdr*>(data);
+			return reinterpret_cast<const char*>(data + getSection(data, header->e_shstrndx).sh_offset + getSection(data, index).sh_name);
+		}
+
+		template<class OBJECT>
+		static void buildFunction(testCodeBlock& block, OBJECT& object, const char* name) {
+			Linux::FunctionGen64<> gen(block);
+			testArch::Mov(block, X64::RAX, gen.getParameter(0));
+			gen.finalize();
+			Assert::IsTrue(object.registerFunction(name, gen));
+		}
+	public:
+		TEST_METHOD(TestElfLayout) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Linux::GdbJitObject<> object;
+			buildFunction(block, object, "jit_function");
+			const uint8_t* data = object.getData();
+
+			const Elf64_Ehdr* header = reinterpret_cast<const Elf64_Ehdr*>(data);
+			Assert::AreEqual(0, std::memcmp(header->e_ident, ELFMAG, SELFMAG));
+			Assert::AreEqual(ELFCLASS64, int(header->e_ident[EI_CLASS]));
+			Assert::AreEqual(EM_X86_64, int(header->e_machine));
+			Assert::AreEqual(ET_REL, int(header->e_type));
+			Assert::AreEqual(6, int(header->e_shnum));
+			Assert::AreEqual(sizeof(Elf64_Shdr), Size(header->e_shentsize));
+			for (uint16_t i = 0; i < header->e_shnum; i++) {
+				const Elf64_Shdr& section = getSection(data, i);
+				Assert::IsTrue(section.sh_type == SHT_NOBITS || section.sh_offset + section.sh_size <= object.getSize());
+			}
+
+			const Elf64_Shdr& text = getSection(data, 1);
+			Assert::AreEqual(std::string(".text"), std::string(getSectionName(data, 1)));
+			Assert::AreEqual(Elf64_Addr(reinterpret_cast<uintptr_t>(block.getStartPtr())), text.sh_addr);
+			Assert::AreEqual(Elf64_Xword(block.getSize()), text.sh_size);
+
+			// CIE followed by FDE which covers function code
+			const Elf64_Shdr& ehFrame = getSection(data, 2);
+			Assert::AreEqual(std::string(".eh_frame"), std::string(getSectionName(data, 2)));
+			const uint8_t* cie = data + ehFrame.sh_offset;
+			uint32_t cieLength;
+			std::memcpy(&cieLength, cie, sizeof(cieLength));
+			Assert::AreEqual(0u, (cieLength + 4) % 8);
+			const uint8_t* fde = cie + cieLength + 4;
+			uint64_t pcBegin, pcRange;
+			std::memcpy(&pcBegin, fde + 8, sizeof(pcBegin));
+			std::memcpy(&pcRange, fde + 16, sizeof(pcRange));
+			Assert::AreEqual(uint64_t(reinterpret_cast<uintptr_t>(block.getStartPtr())), pcBegin);
+			Assert::AreEqual(uint64_t(block.getSize()), pcRange);
+
+			const Elf64_Shdr& symtab = getSection(data, 3);
+			const Elf64_Shdr& strtab = getSection(data, symtab.sh_link);
+			Assert::AreEqual(std::string(".symtab"), std::string(getSectionName(data, 3)));
+			Assert::AreEqual(std::string(".strtab"), std::string(getSectionName(data, symtab.sh_link)));
+			const Elf64_Sym* symbol = reinterpret_cast<const Elf64_Sym*>(data + symtab.sh_offset) + 1;
+			Assert::AreEqual(std::string("jit_function"), std::string(reinterpret_cast<const char*>(data + strtab.sh_offset + symbol->st_name)));
+			Assert::AreEqual(STT_FUNC, int(ELF64_ST_TYPE(symbol->st_info)));
+			Assert::AreEqual(text.sh_addr, symbol->st_value);
+			Assert::AreEqual(text.sh_size, symbol->st_size);
+		}
+
+		TEST_METHOD(TestElfClassFromTarget) {
+			static uint8_t cfi[] = { Dwarf::DW_CFA_nop };
+			Linux::GdbJitObject<> object;
+			bool lowBuffer = reinterpret_cast<uintptr_t>(object.getData()) + 1024 <= UINT32_MAX;
+			Assert::AreEqual(lowBuffer, object.build("f", reinterpret_cast<Addr>(0x1000), 16, Dwarf::TARGET_X86, cfi, sizeof(cfi)));
+			if (lowBuffer) {
+				const Elf32_Ehdr* header = reinterpret_cast<const Elf32_Ehdr*>(object.getData());
+				Assert::AreEqual(ELFCLASS32, int(header->e_ident[EI_CLASS]));
+				Assert::AreEqual(EM_386, int(header->e_machine));
+			}
+			// 32-bit target can not describe code above 4GB
+			Assert::IsFalse(object.build("f", reinterpret_cast<Addr>(uintptr_t(1) << 32), 16, Dwarf::TARGET_X86, cfi, sizeof(cfi)));
+		}
+
+		TEST_METHOD(TestEhFrameAddressSize) {
+			static uint8_t cfi[] = { Dwarf::DW_CFA_nop };
+			std::array<uint8_t, 64> data = {};
+			Dwarf::EhFrameWriter ehFrame(data.data(), data.size(), Dwarf::TARGET_X86);
+			Offset fdeOffset = ehFrame.getSize();
+			ehFrame.addFunction(reinterpret_cast<Addr>(0x12345678), 0x40, cfi, sizeof(cfi));
+			ehFrame.finish();
+			Assert::IsTrue(ehFrame.isValid());
+			Assert::AreEqual(Size(0), fdeOffset % 4);
+			uint32_t pcBegin, pcRange;
+			std::memcpy(&pcBegin, data.data() + fdeOffset + 8, sizeof(pcBegin));
+			std::memcpy(&pcRange, data.data() + fdeOffset + 12, sizeof(pcRange));
+			Assert::AreEqual(0x12345678u, pcBegin);
+			Assert::AreEqual(0x40u, pcRange);
+		}
+
+		TEST_METHOD(TestRegistrationList) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Linux::JitCodeEntry* firstEntry = __jit_debug_descriptor.firstEntry;
+			Linux::GdbJitObject<> object1;
+			Linux::GdbJitObject<> object2;
+			Linux::GdbJitObject<> object3;
+			buildFunction(block, object1, "f1");
+			buildFunction(block, object2, "f2");
+			buildFunction(block, object3, "f3");
+			Assert::AreEqual(uint32_t(1), __jit_debug_descriptor.actionFlag);
+
+			// newest entry first
+			Linux::JitCodeEntry* entry3 = __jit_debug_descriptor.firstEntry;
+			Assert::AreEqual(reinterpret_cast<const char*>(object3.getData()), entry3->symfileAddr);
+			Assert::AreEqual(uint64_t(object3.getSize()), entry3->symfileSize);
+			Assert::IsNull(entry3->prev);
+			Linux::JitCodeEntry* entry2 = entry3->next;
+			Assert::AreEqual(reinterpret_cast<const char*>(object2.getData()), entry2->symfileAddr);
+			Assert::AreEqual(entry3, entry2->prev);
+			Linux::JitCodeEntry* entry1 = entry2->next;
+			Assert::AreEqual(reinterpret_cast<const char*>(object1.getData()), entry1->symfileAddr);
+			Assert::AreEqual(firstEntry, entry1->next);
+
+			// unregister from middle of list
+			object2.unregisterCode();
+			Assert::IsFalse(object2.isRegistered());
+			Assert::AreEqual(uint32_t(2), __jit_debug_descriptor.actionFlag);
+			Assert::AreEqual(entry2, __jit_debug_descriptor.relevantEntry);
+			Assert::AreEqual(entry1, entry3->next);
+			Assert::AreEqual(entry3, entry1->prev);
+
+			// unregister list head
+			object3.unregisterCode();
+			Assert::AreEqual(entry1, __jit_debug_descriptor.firstEntry);
+			Assert::IsNull(entry1->prev);
+
+			object1.unregisterCode();
+			Assert::AreEqual(firstEntry, __jit_debug_descriptor.firstEntry);
+		}
+	};
+}
\ No newline at end of file
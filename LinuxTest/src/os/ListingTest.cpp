@@ -0,0 +1,46 @@
+#define CPPASM_LISTING
+#include "stdafx.h"
+#include "asm/listing.h"
+
+#include <sstream>
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test listing of instructions recorded by ASM_LIST */
+	TEST_CLASS(ListingTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Os::ListingBlock<4, Linux::CodeBlock> testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestListingPrint) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			ASM_LIST(block, testArch::Mov(block, X64::RAX, X64::RDI));
+			ASM_LIST(block, testArch::Add(block, X64::RAX, X64::RSI));
+			Addr retAddr = block.getCurrentPtr();
+			ASM_LIST(block, testArch::Ret(block));
+			Assert::AreEqual(Size(3), block.getEntriesCount());
+			Assert::AreEqual(int64_t(5), block.invoke<int64_t>(int64_t(2), int64_t(3)));
+
+			std::ostringstream out;
+			block.print(out, 4);
+			Assert::AreEqual(std::string(
+				"00000000  48 89 F8      testArch::Mov(block, X64::RAX, X64::RDI)\n"
+				"00000003  48 01 F0      testArch::Add(block, X64::RAX, X64::RSI)\n"
+				"00000006  C3            testArch::Ret(block)\n"), out.str());
+
+			// rewinding write position drops entries of overwritten instructions
+			Assert::IsTrue(block.reset(retAddr));
+			Assert::AreEqual(Size(2), block.getEntriesCount());
+			ASM_LIST(block, testArch::Ret(block));
+			Assert::AreEqual(Size(3), block.getEntriesCount());
+			Assert::AreEqual(Size(1), block.getEntry(2).size);
+			block.reset();
+			Assert::AreEqual(Size(0), block.getEntriesCount());
+		}
+	};
+}
\ No newline at end of file
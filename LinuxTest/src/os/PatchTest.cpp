@@ -0,0 +1,131 @@
+#include "stdafx.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test patching of code executed by other threads */
+	TEST_CLASS(PatchTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		constexpr static Size MOV_SIZE = 10;
+		constexpr static uint64_t VALUE1 = 0x1111111111111111;
+		constexpr static uint64_t VALUE2 = 0x2222222222222222;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		/* Generate MOV RAX, imm64; RET with immediate crossing aligned 8 bytes */
+		static Offset generateCrossingMov(testCodeBlock& block, uint64_t value) {
+			while ((reinterpret_cast<uintptr_t>(block.getCurrentPtr()) % sizeof(uint64_t)) != 4) {
+				block.pushRaw<uint8_t>(0x90);
+			}
+			Offset movOffset = block.getOffset();
+			testArch::Mov(block, X64::RAX, U64(value));
+			testArch::Ret(block);
+			return movOffset;
+		}
+	public:
+		TEST_METHOD(TestPatchCrossingInstruction) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Offset movOffset = generateCrossingMov(block, 1);
+			Addr functionAddr = block.getStartPtr() + movOffset;
+			Assert::AreEqual(uint64_t(1), block.invokeAddr<uint64_t>(functionAddr));
+			uint64_t newValue = 2;
+			Assert::IsTrue(block.patchInstruction(movOffset, MOV_SIZE, movOffset + 2, &newValue, sizeof(newValue)));
+			Assert::AreEqual(uint64_t(2), block.invokeAddr<uint64_t>(functionAddr));
+			const uint8_t expected[] = { 0x48, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3 };
+			Assert::AreBytesEqual(expected, functionAddr, sizeof(expected));
+		}
+
+		TEST_METHOD(TestPatchWhileExecuted) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Offset movOffset = generateCrossingMov(block, VALUE1);
+			Addr functionAddr = block.getStartPtr() + movOffset;
+			std::atomic<bool> running(true);
+			std::atomic<uint32_t> invalidCount(0);
+			std::atomic<uint32_t> callCount(0);
+			std::thread executor([&] {
+				while (running.load()) {
+					uint64_t value = block.invokeAddr<uint64_t>(functionAddr);
+					if (value != VALUE1 && value != VALUE2) {
+						invalidCount++;
+					}
+					callCount++;
+				}
+			});
+			for (uint32_t i = 0; i < 10000; i++) {
+				uint64_t newValue = (i % 2) ? VALUE1 : VALUE2;
+				Assert::IsTrue(block.patchInstruction(movOffset, MOV_SIZE, movOffset + 2, &newValue, sizeof(newValue)));
+				if (i % 64 == 0) {
+					std::this_thread::yield();
+				}
+			}
+			running.store(false);
+			executor.join();
+			Assert::AreEqual(uint32_t(0), invalidCount.load());
+			Assert::AreNotEqual(uint32_t(0), callCount.load());
+			Assert::AreEqual(VALUE1, block.invokeAddr<uint64_t>(functionAddr));
+		}
+
+		TEST_METHOD(TestAlignPatchableMeasure) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			for (Size misalign = 0; misalign < sizeof(uint64_t); misalign++) {
+				for (Size instrSize = 1; instrSize <= sizeof(uint64_t); instrSize++) {
+					block.reset();
+					block.skipBytes(misalign);
+					auto generator = [&](auto& subBlock) {
+						Os::alignPatchable(subBlock, instrSize);
+						subBlock.skipBytes(instrSize);
+					};
+					// measure at other address than code is written
+					Os::MeasureBlock measureBlock(nullptr, CODE_BLOCK_SIZE);
+					measureBlock.skipBytes(3);
+					Size measureStart = measureBlock.getSize();
+					generator(measureBlock);
+					Size measured = measureBlock.getSize() - measureStart;
+					Addr start = block.getCurrentPtr();
+					generator(block);
+					Size written = static_cast<Size>(block.getCurrentPtr() - start);
+					Assert::IsTrue(written <= measured);
+					Assert::IsTrue(((reinterpret_cast<uintptr_t>(block.getCurrentPtr()) - 1) / 8) ==
+						((reinterpret_cast<uintptr_t>(block.getCurrentPtr()) - instrSize) / 8));
+				}
+			}
+		}
+
+		TEST_METHOD(TestAlignPatchableMeasureBuffer) {
+			static_assert(Os::IsMeasuringBlock<Os::InstructionBuffer<Os::MeasureBlock>>::value);
+			static_assert(!Os::IsMeasuringBlock<Os::InstructionBuffer<testCodeBlock>>::value);
+			// buffered measure reserve worst case padding as measure block itself
+			// (aligned measure address need no padding)
+			Os::MeasureBlock measureBlock(nullptr, CODE_BLOCK_SIZE);
+			{
+				Os::InstructionBuffer<Os::MeasureBlock> buffer(measureBlock);
+				Os::alignPatchable(buffer, 6);
+			}
+			Assert::AreEqual(Size(5), measureBlock.getSize());
+		}
+
+		TEST_METHOD(TestEmitPatchable) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			block.skipBytes(5);
+			Addr movAddr = nullptr;
+			Addr addr = Os::emit(block, [&](auto& subBlock) {
+				Os::alignPatchable(subBlock, 7);
+				movAddr = subBlock.getCurrentPtr();
+				testArch::Mov(subBlock, X64::RAX, S32(1));
+				testArch::Ret(subBlock);
+			});
+			Assert::IsNotNull(addr);
+			// 3 bytes padding, 7 bytes MOV and RET while 6 bytes padding measured
+			Assert::AreEqual(Size(5 + 3 + 7 + 1), block.getSize());
+			Assert::AreEqual(Size(0), reinterpret_cast<uintptr_t>(movAddr) % sizeof(uint64_t));
+			Assert::AreEqual(uint64_t(1), block.invokeAddr<uint64_t>(movAddr));
+		}
+	};
+}
\ No newline at end of file
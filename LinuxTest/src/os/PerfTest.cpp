@@ -0,0 +1,170 @@
+#include "stdafx.h"
+
+#include <cstdlib>
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test perf map records of generated functions */
+	TEST_CLASS(PerfTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		struct TempDirectory {
+			char path[64];
+			char mapPath[128];
+			char dumpPath[128];
+
+			TempDirectory() {
+				std::strcpy(path, "/tmp/cppasm-perf-XXXXXX");
+				Assert::IsNotNull(mkdtemp(path));
+				std::snprintf(mapPath, sizeof(mapPath), "%s/perf-%d.map", path, static_cast<int>(getpid()));
+				std::snprintf(dumpPath, sizeof(dumpPath), "%s/jit-%d.dump", path, static_cast<int>(getpid()));
+			}
+
+			~TempDirectory() {
+				std::remove(mapPath);
+				std::remove(dumpPath);
+				rmdir(path);
+			}
+		};
+
+		struct MapLine {
+			Size addr;
+			Size size;
+			char name[64];
+		};
+
+		static Size readMap(const char* path, MapLine* lines, Size maxLines) {
+			FILE* file = std::fopen(path, "r");
+			Assert::IsNotNull(file);
+			Size count = 0;
+			while (count < maxLines && std::fscanf(file, "%zx %zx %63s", &lines[count].addr, &lines[count].size, lines[count].name) == 3) {
+				count++;
+			}
+			std::fclose(file);
+			return count;
+		}
+
+		static Size readFile(const char* path, uint8_t* data, Size maxSize) {
+			FILE* file = std::fopen(path, "rb");
+			Assert::IsNotNull(file);
+			Size size = std::fread(data, 1, maxSize, file);
+			std::fclose(file);
+			return size;
+		}
+
+		template<class T>
+		static T readField(const uint8_t* data, Size offset) {
+			T value;
+			std::memcpy(&value, data + offset, sizeof(value));
+			return value;
+		}
+	public:
+		TEST_METHOD(TestPerfMapLine) {
+			TempDirectory directory;
+			{
+				Linux::PerfMap perfMap(directory.path);
+				Assert::IsTrue(perfMap.isOpen());
+				Assert::IsTrue(perfMap.registerCode("jit_function", reinterpret_cast<Addr>(0x7f0012340000), 0x2a));
+			}
+			MapLine lines[2];
+			Assert::AreEqual(Size(1), readMap(directory.mapPath, lines, 2));
+			Assert::AreEqual(Size(0x7f0012340000), lines[0].addr);
+			Assert::AreEqual(Size(0x2a), lines[0].size);
+			Assert::AreEqual(std::string("jit_function"), std::string(lines[0].name));
+		}
+
+		TEST_METHOD(TestRegisterOnFinalize) {
+			TempDirectory directory;
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Addr addr1;
+			Size size1;
+			Addr addr2;
+			Size size2;
+			{
+				Linux::PerfRegistry registry(Linux::PerfRegistry::PERF_MAP, directory.path);
+				{
+					Linux::FunctionGen64<> gen(block);
+					registry.attach(gen, "first");
+					testArch::Mov(block, X64::RAX, gen.getParameter(0));
+					gen.finalize();
+					addr1 = gen.getAddress();
+					size1 = gen.getSize();
+				}
+				{
+					// destructor finalizes function
+					Linux::FunctionGen64<> gen(block);
+					registry.attach(gen, "second");
+					addr2 = gen.getAddress();
+					testArch::Xor(block, X64::RAX, X64::RAX);
+				}
+				size2 = static_cast<Size>(block.getCurrentPtr() - addr2);
+			}
+			MapLine lines[4];
+			Assert::AreEqual(Size(2), readMap(directory.mapPath, lines, 4));
+			Assert::AreEqual(reinterpret_cast<Size>(addr1), lines[0].addr);
+			Assert::AreEqual(size1, lines[0].size);
+			Assert::AreEqual(std::string("first"), std::string(lines[0].name));
+			Assert::AreEqual(reinterpret_cast<Size>(addr2), lines[1].addr);
+			Assert::AreEqual(size2, lines[1].size);
+			Assert::AreEqual(std::string("second"), std::string(lines[1].name));
+		}
+
+		TEST_METHOD(TestJitDumpRecords) {
+			constexpr Size HEADER_SIZE = 40;
+			constexpr Size LOAD_RECORD_SIZE = 56;
+			TempDirectory directory;
+			const uint8_t code1[] = { 0x48, 0x89, 0xF8, 0xC3 };
+			const uint8_t code2[] = { 0x31, 0xC0, 0xC3 };
+			{
+				Linux::JitDump jitDump(directory.path);
+				Assert::IsTrue(jitDump.isOpen());
+				Assert::IsTrue(jitDump.registerCode("first", code1, sizeof(code1)));
+				Assert::IsTrue(jitDump.registerCode("second", code2, sizeof(code2)));
+			}
+			uint8_t data[512];
+			Size size = readFile(directory.dumpPath, data, sizeof(data));
+			const Size record1Size = LOAD_RECORD_SIZE + sizeof("first") + sizeof(code1);
+			const Size record2Size = LOAD_RECORD_SIZE + sizeof("second") + sizeof(code2);
+			Assert::AreEqual(HEADER_SIZE + record1Size + record2Size + 16, size);
+
+			// file header: magic, version, header size, ELF machine, pid
+			Assert::AreEqual(uint32_t(0x4A695444), readField<uint32_t>(data, 0));
+			Assert::AreEqual(uint32_t(1), readField<uint32_t>(data, 4));
+			Assert::AreEqual(uint32_t(HEADER_SIZE), readField<uint32_t>(data, 8));
+			Assert::AreEqual(uint32_t(EM_X86_64), readField<uint32_t>(data, 12));
+			Assert::AreEqual(uint32_t(getpid()), readField<uint32_t>(data, 20));
+
+			// code load records: id, total size, pid, vma, code address, code size, code index, name, code
+			const char* names[] = { "first", "second" };
+			const uint8_t* codes[] = { code1, code2 };
+			const Size codeSizes[] = { sizeof(code1), sizeof(code2) };
+			Size offset = HEADER_SIZE;
+			for (Size i = 0; i < 2; i++) {
+				const uint8_t* record = data + offset;
+				Size nameSize = std::strlen(names[i]) + 1;
+				Size recordSize = LOAD_RECORD_SIZE + nameSize + codeSizes[i];
+				Assert::AreEqual(uint32_t(0), readField<uint32_t>(record, 0));
+				Assert::AreEqual(uint32_t(recordSize), readField<uint32_t>(record, 4));
+				Assert::AreEqual(uint32_t(getpid()), readField<uint32_t>(record, 16));
+				Assert::AreEqual(reinterpret_cast<uint64_t>(codes[i]), readField<uint64_t>(record, 24));
+				Assert::AreEqual(reinterpret_cast<uint64_t>(codes[i]), readField<uint64_t>(record, 32));
+				Assert::AreEqual(uint64_t(codeSizes[i]), readField<uint64_t>(record, 40));
+				Assert::AreEqual(uint64_t(i), readField<uint64_t>(record, 48));
+				Assert::AreEqual(std::string(names[i]), std::string(reinterpret_cast<const char*>(record + LOAD_RECORD_SIZE)));
+				Assert::AreBytesEqual(codes[i], record + LOAD_RECORD_SIZE + nameSize, codeSizes[i]);
+				offset += recordSize;
+			}
+
+			// code close record written on destruction
+			Assert::AreEqual(uint32_t(3), readField<uint32_t>(data, offset));
+			Assert::AreEqual(uint32_t(16), readField<uint32_t>(data, offset + 4));
+		}
+	};
+}
\ No newline at end of file
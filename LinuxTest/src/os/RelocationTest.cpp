@@ -0,0 +1,59 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test relocations recorded while code is emitted */
+	TEST_CLASS(RelocationTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Os::RelocatingBlock<8, Linux::CodeBlock> testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestRipRelativeRelocation) {
+			Linux::CodeBlock dataBlock(CODE_BLOCK_SIZE);
+			Linux::CodeBlock movedBlock(CODE_BLOCK_SIZE);
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Addr data = dataBlock.getCurrentPtr();
+			dataBlock.pushRaw<int64_t>(10);
+			Os::LiteralPool<16> pool;
+			pool.setBase(block.getStartPtr() + 256);
+			Addr literal = pool.getLiteral(int64_t(100));
+
+			// ADD [RIP+data],5: displacement followed by imm32
+			testArch::Add<X64::QWORD_PTR>(block, X64::Mem64<X64::RIP_OFFSET>(data), S32(5));
+			Offset addField = block.getOffset() - sizeof(int32_t) - sizeof(int32_t);
+			Os::RelocationTable<1> manual;
+			Assert::IsTrue(manual.addLast(block, Os::RELOC_REL32, sizeof(int32_t)));
+			Assert::AreEqual(addField, manual.get(0).offset);
+			Os::writeInstruction(block, [&](auto& buffer) {
+				testArch::Mov(buffer, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(data));
+			});
+			Offset movField = block.getOffset() - sizeof(int32_t);
+			// literal inside block is not relocated
+			testArch::Add(block, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(literal));
+			testArch::Ret(block);
+			block.skipBytes(256 - block.getSize());
+			Assert::IsTrue(pool.place(block));
+
+			const Os::RelocationTable<8>& relocations = block.getRelocations();
+			Assert::AreEqual(Size(2), relocations.getCount());
+			Assert::AreEqual(addField, relocations.get(0).offset);
+			Assert::AreEqual(movField, relocations.get(1).offset);
+			Assert::IsTrue(relocations.get(0).type == Os::RELOC_REL32);
+
+			Assert::IsTrue(block.relocateTo(movedBlock));
+			Assert::AreEqual(int64_t(115), movedBlock.invoke<int64_t>());
+			int64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			Assert::AreEqual(int64_t(15), value);
+
+			// rewinding drops relocations of overwritten code
+			Assert::IsTrue(block.reset(block.getStartPtr() + movField));
+			Assert::AreEqual(Size(1), block.getRelocations().getCount());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test C++ exceptions propagate through registered generated functions */
+	TEST_CLASS(UnwindTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		static void throwValue(int64_t value) {
+			throw value;
+		}
+
+		static int64_t returnValue(int64_t value) {
+			return value;
+		}
+
+		/* Generate function(callback, value) which calls callback(value)
+		 * with callee-saved registers clobbered by generated code
+		 */
+		template<class REGISTRATION>
+		static void generateCaller(testCodeBlock& block, REGISTRATION& registration) {
+			Linux::FunctionGen64<> gen(block, 8, { X64::RBX, X64::R12, X64::R13 });
+			testArch::Mov(block, X64::RBX, gen.getParameter(0));
+			testArch::Mov(block, X64::R12, gen.getParameter(1));
+			testArch::Xor(block, X64::R13, X64::R13);
+			testArch::Mov(block, gen.getParameter(0), X64::R12);
+			testArch::Call(block, X64::RBX);
+			gen.finalize();
+			Assert::IsTrue(registration.registerFunction(gen));
+		}
+	public:
+		TEST_METHOD(TestThrowThroughFunction) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Linux::FrameRegistration<> registration;
+			generateCaller(block, registration);
+			Assert::AreEqual(int64_t(5), block.invoke<int64_t>(&returnValue, int64_t(5)));
+
+			int64_t caught = 0;
+			try {
+				block.invoke<int64_t>(&throwValue, int64_t(42));
+			} catch (int64_t value) {
+				caught = value;
+			}
+			Assert::AreEqual(int64_t(42), caught);
+		}
+
+		TEST_METHOD(TestEpilogueRestoreRules) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Linux::FunctionGen64<> gen(block, 0, { X64::RBX, X64::R12 });
+			gen.finalize();
+			// PUSH RBP; MOV RBP,RSP; PUSH RBX; PUSH R12; POP R12; POP RBX; POP RBP; RET
+			const uint8_t code[] = { 0x55, 0x48, 0x89, 0xE5, 0x53, 0x41, 0x54, 0x41, 0x5C, 0x5B, 0x5D, 0xC3 };
+			Assert::AreEqual(Size(sizeof(code)), block.getSize());
+			Assert::AreBytesEqual(code, block.getStartPtr(), sizeof(code));
+			const uint8_t expected[] = {
+				0x41, 0x0E, 0x10,		// advance 1: def_cfa_offset 16
+				0x86, 0x02,				// offset RBP, CFA-16
+				0x43, 0x0D, 0x06,		// advance 3: def_cfa_register RBP
+				0x41, 0x83, 0x03,		// advance 1: offset RBX, CFA-24
+				0x42, 0x8C, 0x04,		// advance 2: offset R12, CFA-32
+				0x42, 0xCC,				// advance 2: restore R12
+				0x41, 0xC3,				// advance 1: restore RBX
+				0x41, 0x0C, 0x07, 0x08,	// advance 1: def_cfa RSP+8
+				0xC6					// restore RBP
+			};
+			Assert::AreEqual(Size(sizeof(expected)), gen.getUnwindInfo().getSize());
+			Assert::AreBytesEqual(expected, gen.getUnwindInfo().getData(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 atomic instructions with LOCK prefix */
+	TEST_CLASS(X64AtomicTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i486 testArch;
+	public:
+		TEST_METHOD(TestLockEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			testArch::Add<X64::QWORD_PTR, X64::LOCK>(block, mem, S8(1));
+			testArch::Inc<X64::DWORD_PTR, X64::LOCK>(block, mem);
+			testArch::Xchg(block, mem, X64::RAX);
+			testArch::Xadd<X64::LOCK>(block, mem, X64::RAX);
+			testArch::CmpXchg<X64::LOCK>(block, mem, X64::RSI);
+			X64::CX16::CmpXchg16b<X64::LOCK>(block, mem);
+			testArch::Bts<X64::LOCK>(block, mem, X64::RSI);
+			testArch::Bts(block, X64::RAX, X64::RCX);
+			testArch::Btr<X64::DWORD_PTR, X64::LOCK>(block, mem, U8(3));
+			testArch::Btc(block, X64::R9, X64::R10);
+			testArch::Bswap(block, X64::R8);
+			const uint8_t expected[] = {
+				0xF0, 0x48, 0x81, 0x07, 0x01, 0x00, 0x00, 0x00,	// lock add qword ptr [rdi],1 (imm8 extended to imm32)
+				0xF0, 0xFF, 0x07,				// lock inc dword ptr [rdi]
+				0x48, 0x87, 0x07,				// xchg qword ptr [rdi],rax
+				0xF0, 0x48, 0x0F, 0xC1, 0x07,	// lock xadd qword ptr [rdi],rax
+				0xF0, 0x48, 0x0F, 0xB1, 0x37,	// lock cmpxchg qword ptr [rdi],rsi
+				0xF0, 0x48, 0x0F, 0xC7, 0x0F,	// lock cmpxchg16b [rdi]
+				0xF0, 0x48, 0x0F, 0xAB, 0x37,	// lock bts qword ptr [rdi],rsi
+				0x48, 0x0F, 0xAB, 0xC8,			// bts rax,rcx
+				0xF0, 0x0F, 0xBA, 0x37, 0x03,	// lock btr dword ptr [rdi],3
+				0x4D, 0x0F, 0xBB, 0xD1,			// btc r9,r10
+				0x49, 0x0F, 0xC8				// bswap r8
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestLockXaddCmpXchg) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			// fetch and add: returns previous value
+			Addr xaddAddr = block.getCurrentPtr();
+			testArch::Mov(block, X64::RAX, X64::RSI);
+			testArch::Xadd<X64::LOCK>(block, mem, X64::RAX);
+			testArch::Ret(block);
+			// compare and swap 0 -> new value: returns previous value
+			Addr casAddr = block.getCurrentPtr();
+			testArch::Mov(block, X64::RAX, S32(0));
+			testArch::CmpXchg<X64::LOCK>(block, mem, X64::RSI);
+			testArch::Ret(block);
+
+			int64_t value = 10;
+			Assert::AreEqual(int64_t(10), block.invokeAddr<int64_t>(xaddAddr, &value, int64_t(5)));
+			Assert::AreEqual(int64_t(15), value);
+			Assert::AreEqual(int64_t(15), block.invokeAddr<int64_t>(casAddr, &value, int64_t(7)));
+			Assert::AreEqual(int64_t(15), value);
+			value = 0;
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(casAddr, &value, int64_t(7)));
+			Assert::AreEqual(int64_t(7), value);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 POPCNT, LZCNT, BMI1 and BMI2 instructions encoding */
+	TEST_CLASS(X64BitManipulationTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestBitManipulationEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::POPCNT::Popcnt(block, X64::RAX, X64::RCX);
+			X64::POPCNT::Popcnt(block, X64::R9d, X64::EDX);
+			X64::POPCNT::Popcnt(block, X64::AX, X64::CX);
+			X64::POPCNT::Popcnt(block, X64::RAX, memR8);
+			X64::LZCNT::Lzcnt(block, X64::R10, X64::R11);
+			X64::LZCNT::Lzcnt(block, X64::EAX, mem);
+			X64::BMI1::Tzcnt(block, X64::RAX, X64::R12);
+			X64::BMI1::Tzcnt(block, X64::ECX, memR8);
+			X64::BMI1::Andn(block, X64::RAX, X64::RBX, X64::RCX);
+			X64::BMI1::Andn(block, X64::R8d, X64::R9d, mem);
+			X64::BMI1::Bextr(block, X64::RAX, memR8, X64::R10);
+			X64::BMI1::Blsi(block, X64::R11, X64::RDX);
+			X64::BMI1::Blsmsk(block, X64::EAX, X64::R9d);
+			X64::BMI1::Blsr(block, X64::RAX, mem);
+			X64::BMI2::Bzhi(block, X64::RAX, X64::RBX, X64::RCX);
+			X64::BMI2::Mulx(block, X64::R8, X64::R9, memR8);
+			X64::BMI2::Pdep(block, X64::EAX, X64::EBX, X64::R12d);
+			X64::BMI2::Pext(block, X64::RAX, X64::RBX, mem);
+			X64::BMI2::Rorx(block, X64::R13, X64::RSI, U8(7));
+			X64::BMI2::Sarx(block, X64::RAX, X64::R14, X64::RCX);
+			X64::BMI2::Shlx(block, X64::EAX, memR8, X64::ECX);
+			X64::BMI2::Shrx(block, X64::R15, X64::RAX, X64::R9);
+			const uint8_t expected[] = {
+				0xF3, 0x48, 0x0F, 0xB8, 0xC1,		// popcnt rax,rcx
+				0xF3, 0x44, 0x0F, 0xB8, 0xCA,		// popcnt r9d,edx
+				0x66, 0xF3, 0x0F, 0xB8, 0xC1,		// popcnt ax,cx
+				0xF3, 0x49, 0x0F, 0xB8, 0x40, 0x10,	// popcnt rax,qword ptr [r8+0x10]
+				0xF3, 0x4D, 0x0F, 0xBD, 0xD3,		// lzcnt r10,r11
+				0xF3, 0x0F, 0xBD, 0x07,				// lzcnt eax,dword ptr [rdi]
+				0xF3, 0x49, 0x0F, 0xBC, 0xC4,		// tzcnt rax,r12
+				0xF3, 0x41, 0x0F, 0xBC, 0x48, 0x10,	// tzcnt ecx,dword ptr [r8+0x10]
+				0xC4, 0xE2, 0xE0, 0xF2, 0xC1,		// andn rax,rbx,rcx
+				0xC4, 0x62, 0x30, 0xF2, 0x07,		// andn r8d,r9d,dword ptr [rdi]
+				0xC4, 0xC2, 0xA8, 0xF7, 0x40, 0x10,	// bextr rax,qword ptr [r8+0x10],r10
+				0xC4, 0xE2, 0xA0, 0xF3, 0xDA,		// blsi r11,rdx
+				0xC4, 0xC2, 0x78, 0xF3, 0xD1,		// blsmsk eax,r9d
+				0xC4, 0xE2, 0xF8, 0xF3, 0x0F,		// blsr rax,qword ptr [rdi]
+				0xC4, 0xE2, 0xF0, 0xF5, 0xC3,		// bzhi rax,rbx,rcx
+				0xC4, 0x42, 0xB3, 0xF6, 0x40, 0x10,	// mulx r8,r9,qword ptr [r8+0x10]
+				0xC4, 0xC2, 0x63, 0xF5, 0xC4,		// pdep eax,ebx,r12d
+				0xC4, 0xE2, 0xE2, 0xF5, 0x07,		// pext rax,rbx,qword ptr [rdi]
+				0xC4, 0x63, 0xFB, 0xF0, 0xEE, 0x07,	// rorx r13,rsi,7
+				0xC4, 0xC2, 0xF2, 0xF7, 0xC6,		// sarx rax,r14,rcx
+				0xC4, 0xC2, 0x71, 0xF7, 0x40, 0x10,	// shlx eax,dword ptr [r8+0x10],ecx
+				0xC4, 0x62, 0xB3, 0xF7, 0xF8		// shrx r15,rax,r9
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 cache control, prefetch, fence and non-temporal store instructions */
+	TEST_CLASS(X64CacheControlTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestCacheControlEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memOffset(X64::R8, 0x10);
+			X64::CLFSH::Clflush(block, mem);
+			X64::CLFLUSHOPT::Clflushopt(block, memOffset);
+			X64::CLWB::Clwb(block, mem);
+			X64::CLDEMOTE::Cldemote(block, mem);
+			X64::PRFCHW::Prefetchw(block, mem);
+			X64::SSE::Prefetcht0(block, mem);
+			X64::SSE::Prefetcht1(block, mem);
+			X64::SSE::Prefetcht2(block, mem);
+			X64::SSE::Prefetchnta(block, memOffset);
+			X64::SSE::Sfence(block);
+			X64::SSE2::Lfence(block);
+			X64::SSE2::Mfence(block);
+			X64::SSE2::Movnti(block, mem, X64::RAX);
+			X64::SSE2::Movnti(block, mem, X64::R9d);
+			X64::SSE2::Movntdq(block, mem, X64::XMM9);
+			X64::CLFSH::Clflush(block, X64::Mem32<X64::BASE>(X64::EDI));
+			const uint8_t expected[] = {
+				0x0F, 0xAE, 0x3F,					// clflush [rdi]
+				0x66, 0x41, 0x0F, 0xAE, 0x78, 0x10,	// clflushopt [r8+0x10]
+				0x66, 0x0F, 0xAE, 0x37,				// clwb [rdi]
+				0x0F, 0x1C, 0x07,					// cldemote [rdi]
+				0x0F, 0x0D, 0x0F,					// prefetchw [rdi]
+				0x0F, 0x18, 0x0F,					// prefetcht0 [rdi]
+				0x0F, 0x18, 0x17,					// prefetcht1 [rdi]
+				0x0F, 0x18, 0x1F,					// prefetcht2 [rdi]
+				0x41, 0x0F, 0x18, 0x40, 0x10,		// prefetchnta [r8+0x10]
+				0x0F, 0xAE, 0xF8,					// sfence
+				0x0F, 0xAE, 0xE8,					// lfence
+				0x0F, 0xAE, 0xF0,					// mfence
+				0x48, 0x0F, 0xC3, 0x07,				// movnti qword ptr [rdi],rax
+				0x44, 0x0F, 0xC3, 0x0F,				// movnti dword ptr [rdi],r9d
+				0x66, 0x44, 0x0F, 0xE7, 0x0F,		// movntdq [rdi],xmm9
+				0x67, 0x0F, 0xAE, 0x3F				// clflush [edi]
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestNonTemporalStore) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::SSE::Prefetcht0(block, mem);
+			X64::SSE2::Movnti(block, mem, X64::RSI);
+			X64::SSE::Sfence(block);
+			X64::CLFSH::Clflush(block, mem);
+			X64::SSE2::Mfence(block);
+			testArch::Mov(block, X64::RAX, mem);
+			testArch::Ret(block);
+
+			alignas(64) int64_t value = 0;
+			Assert::AreEqual(int64_t(0x1234), block.invoke<int64_t>(&value, int64_t(0x1234)));
+			Assert::AreEqual(int64_t(0x1234), value);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 conditional move instructions encoding */
+	TEST_CLASS(X64CmovTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestCmovEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::Mem32<X64::BASE_OFFSET> mem32(X64::EDI, 0x10);
+			X64::CMOV::Fcmovb(block, X64::ST, X64::ST1);
+			X64::CMOV::Fcmove(block, X64::ST, X64::ST2);
+			X64::CMOV::Fcmovbe(block, X64::ST, X64::ST3);
+			X64::CMOV::Fcmovu(block, X64::ST, X64::ST4);
+			X64::CMOV::Fcmovnb(block, X64::ST, X64::ST5);
+			X64::CMOV::Fcmovne(block, X64::ST, X64::ST6);
+			X64::CMOV::Fcmovnbe(block, X64::ST, X64::ST7);
+			X64::CMOV::Fcmovnu(block, X64::ST, X64::ST0);
+			X64::CMOV::Cmovo(block, X64::RAX, X64::RCX);
+			X64::CMOV::Cmovno(block, X64::EAX, X64::ECX);
+			X64::CMOV::Cmovb(block, X64::AX, X64::CX);
+			X64::CMOV::Cmovae(block, X64::R8, X64::RDX);
+			X64::CMOV::Cmove(block, X64::RAX, X64::R9);
+			X64::CMOV::Cmovne(block, X64::R10d, X64::R11d);
+			X64::CMOV::Cmovbe(block, X64::RAX, memR8);
+			X64::CMOV::Cmova(block, X64::R12, memR8);
+			X64::CMOV::Cmovs(block, X64::R13d, mem);
+			X64::CMOV::Cmovns(block, X64::SI, mem);
+			X64::CMOV::Cmovp(block, X64::RBX, mem);
+			X64::CMOV::Cmovnp(block, X64::EDX, mem32);
+			X64::CMOV::Cmovl(block, X64::R14, mem32);
+			X64::CMOV::Cmovge(block, X64::RSI, X64::RDI);
+			X64::CMOV::Cmovle(block, X64::R15, X64::R8);
+			X64::CMOV::Cmovg(block, X64::EBX, X64::R9d);
+			X64::CMOV::Cmovc(block, X64::RAX, X64::RBX);
+			X64::CMOV::Cmovz(block, X64::RAX, X64::RBX);
+			X64::CMOV::Cmovnle(block, X64::RAX, X64::RBX);
+			const uint8_t expected[] = {
+				0xDA, 0xC1,							// fcmovb st,st(1)
+				0xDA, 0xCA,							// fcmove st,st(2)
+				0xDA, 0xD3,							// fcmovbe st,st(3)
+				0xDA, 0xDC,							// fcmovu st,st(4)
+				0xDB, 0xC5,							// fcmovnb st,st(5)
+				0xDB, 0xCE,							// fcmovne st,st(6)
+				0xDB, 0xD7,							// fcmovnbe st,st(7)
+				0xDB, 0xD8,							// fcmovnu st,st(0)
+				0x48, 0x0F, 0x40, 0xC1,				// cmovo rax,rcx
+				0x0F, 0x41, 0xC1,					// cmovno eax,ecx
+				0x66, 0x0F, 0x42, 0xC1,				// cmovb ax,cx
+				0x4C, 0x0F, 0x43, 0xC2,				// cmovae r8,rdx
+				0x49, 0x0F, 0x44, 0xC1,				// cmove rax,r9
+				0x45, 0x0F, 0x45, 0xD3,				// cmovne r10d,r11d
+				0x49, 0x0F, 0x46, 0x40, 0x10,		// cmovbe rax,qword ptr [r8+0x10]
+				0x4D, 0x0F, 0x47, 0x60, 0x10,		// cmova r12,qword ptr [r8+0x10]
+				0x44, 0x0F, 0x48, 0x2F,				// cmovs r13d,dword ptr [rdi]
+				0x66, 0x0F, 0x49, 0x37,				// cmovns si,word ptr [rdi]
+				0x48, 0x0F, 0x4A, 0x1F,				// cmovp rbx,qword ptr [rdi]
+				0x67, 0x0F, 0x4B, 0x57, 0x10,		// cmovnp edx,dword ptr [edi+0x10]
+				0x67, 0x4C, 0x0F, 0x4C, 0x77, 0x10,	// cmovl r14,qword ptr [edi+0x10]
+				0x48, 0x0F, 0x4D, 0xF7,				// cmovge rsi,rdi
+				0x4D, 0x0F, 0x4E, 0xF8,				// cmovle r15,r8
+				0x41, 0x0F, 0x4F, 0xD9,				// cmovg ebx,r9d
+				0x48, 0x0F, 0x42, 0xC3,				// cmovc rax,rbx
+				0x48, 0x0F, 0x44, 0xC3,				// cmovz rax,rbx
+				0x48, 0x0F, 0x4F, 0xC3				// cmovnle rax,rbx
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestCmovMax) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// max(value, values[1])
+			X64::Mem64<X64::BASE_OFFSET> other(X64::R8, 8);
+			testArch::Mov(block, X64::RAX, X64::RDI);
+			testArch::Mov(block, X64::R8, X64::RSI);
+			testArch::Cmp(block, X64::RAX, other);
+			X64::CMOV::Cmovl(block, X64::RAX, other);
+			testArch::Ret(block);
+
+			int64_t values[] = { 0, 5 };
+			Assert::AreEqual(int64_t(5), block.invoke<int64_t>(int64_t(-3), values));
+			Assert::AreEqual(int64_t(7), block.invoke<int64_t>(int64_t(7), values));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 CRC32, AES, PCLMULQDQ and SHA instructions encoding */
+	TEST_CLASS(X64CryptoTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestCryptoEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::CRC32::Crc32(block, X64::EAX, X64::CL);
+			X64::CRC32::Crc32(block, X64::EAX, X64::CX);
+			X64::CRC32::Crc32(block, X64::R9d, X64::EDX);
+			X64::CRC32::Crc32(block, X64::RAX, X64::R10);
+			X64::CRC32::Crc32<X64::BYTE_PTR>(block, X64::EAX, memR8);
+			X64::CRC32::Crc32<X64::QWORD_PTR>(block, X64::RAX, mem);
+			X64::AES::Aesenc(block, X64::XMM0, X64::XMM9);
+			X64::AES::Aesenclast(block, X64::XMM10, memR8);
+			X64::AES::Aesdec(block, X64::XMM1, mem);
+			X64::AES::Aesdeclast(block, X64::XMM2, X64::XMM3);
+			X64::AES::Aesimc(block, X64::XMM15, X64::XMM4);
+			X64::AES::Aeskeygenassist(block, X64::XMM5, X64::XMM6, U8(0x1B));
+			X64::PCLMULQDQ::Pclmulqdq(block, X64::XMM8, memR8, U8(0x11));
+			X64::SHA::Sha1rnds4(block, X64::XMM0, X64::XMM1, U8(3));
+			X64::SHA::Sha1nexte(block, X64::XMM9, mem);
+			X64::SHA::Sha1msg1(block, X64::XMM2, X64::XMM11);
+			X64::SHA::Sha1msg2(block, X64::XMM3, X64::XMM4);
+			X64::SHA::Sha256rnds2(block, X64::XMM1, memR8);
+			X64::SHA::Sha256msg1(block, X64::XMM12, X64::XMM13);
+			X64::SHA::Sha256msg2(block, X64::XMM5, X64::XMM6);
+			const uint8_t expected[] = {
+				0xF2, 0x0F, 0x38, 0xF0, 0xC1,					// crc32 eax,cl
+				0x66, 0xF2, 0x0F, 0x38, 0xF1, 0xC1,				// crc32 eax,cx
+				0xF2, 0x44, 0x0F, 0x38, 0xF1, 0xCA,				// crc32 r9d,edx
+				0xF2, 0x49, 0x0F, 0x38, 0xF1, 0xC2,				// crc32 rax,r10
+				0xF2, 0x41, 0x0F, 0x38, 0xF0, 0x40, 0x10,		// crc32 eax,byte ptr [r8+0x10]
+				0xF2, 0x48, 0x0F, 0x38, 0xF1, 0x07,				// crc32 rax,qword ptr [rdi]
+				0x66, 0x41, 0x0F, 0x38, 0xDC, 0xC1,				// aesenc xmm0,xmm9
+				0x66, 0x45, 0x0F, 0x38, 0xDD, 0x50, 0x10,		// aesenclast xmm10,xmmword ptr [r8+0x10]
+				0x66, 0x0F, 0x38, 0xDE, 0x0F,					// aesdec xmm1,xmmword ptr [rdi]
+				0x66, 0x0F, 0x38, 0xDF, 0xD3,					// aesdeclast xmm2,xmm3
+				0x66, 0x44, 0x0F, 0x38, 0xDB, 0xFC,				// aesimc xmm15,xmm4
+				0x66, 0x0F, 0x3A, 0xDF, 0xEE, 0x1B,				// aeskeygenassist xmm5,xmm6,0x1b
+				0x66, 0x45, 0x0F, 0x3A, 0x44, 0x40, 0x10, 0x11,	// pclmulqdq xmm8,xmmword ptr [r8+0x10],0x11
+				0x0F, 0x3A, 0xCC, 0xC1, 0x03,					// sha1rnds4 xmm0,xmm1,3
+				0x44, 0x0F, 0x38, 0xC8, 0x0F,					// sha1nexte xmm9,xmmword ptr [rdi]
+				0x41, 0x0F, 0x38, 0xC9, 0xD3,					// sha1msg1 xmm2,xmm11
+				0x0F, 0x38, 0xCA, 0xDC,							// sha1msg2 xmm3,xmm4
+				0x41, 0x0F, 0x38, 0xCB, 0x48, 0x10,				// sha256rnds2 xmm1,xmmword ptr [r8+0x10],xmm0
+				0x45, 0x0F, 0x38, 0xCC, 0xE5,					// sha256msg1 xmm12,xmm13
+				0x0F, 0x38, 0xCD, 0xEE							// sha256msg2 xmm5,xmm6
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
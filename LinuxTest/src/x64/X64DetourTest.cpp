@@ -0,0 +1,155 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test to verify decoding and relocation of x64 instructions by Detour */
+	TEST_CLASS(X64DetourTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		static void assertDecoded(std::initializer_list<uint8_t> code, uint8_t size,
+			uint8_t relOffset = 0, uint8_t relSize = 0, bool ripRelative = false)
+		{
+			uint8_t buffer[16] = {};
+			std::memcpy(buffer, code.begin(), code.size());
+			Os::InstructionInfo info;
+			Assert::IsTrue(Os::decodeInstruction<Os::DECODE_X64>(buffer, info));
+			Assert::AreEqual(size, info.size);
+			Assert::AreEqual(relOffset, info.relOffset);
+			Assert::AreEqual(relSize, info.relSize);
+			Assert::AreEqual(ripRelative, info.ripRelative);
+		}
+
+		static uint8_t* getData(testCodeBlock& block) {
+			return const_cast<uint8_t*>(block.getStartPtr());
+		}
+
+		/* Hook call original function through trampoline and add 100 to result */
+		static void generateHook(testCodeBlock& block, const X64::Detour& detour) {
+			Assert::IsTrue(testArch::Call(block).bind(block, detour.getTrampoline()));
+			testArch::Add(block, X64::RAX, S32(100));
+			testArch::Ret(block);
+		}
+	public:
+		TEST_METHOD(TestDecode) {
+			// mov rax,imm64
+			assertDecoded({ 0x48, 0xB8, 1, 2, 3, 4, 5, 6, 7, 8 }, 10);
+			// add ax,imm16
+			assertDecoded({ 0x66, 0x05, 1, 2 }, 4);
+			// REX.W override operand size prefix: add rax,imm32; mov rax,imm32
+			assertDecoded({ 0x66, 0x48, 0x05, 1, 2, 3, 4 }, 7);
+			assertDecoded({ 0x66, 0x48, 0xC7, 0xC0, 1, 2, 3, 4 }, 8);
+			// test r9,imm32
+			assertDecoded({ 0x49, 0xF7, 0xC1, 1, 2, 3, 4 }, 7);
+			// mov rax,[rip+disp32]; cmp qword ptr [rip+disp32],imm32
+			assertDecoded({ 0x48, 0x8B, 0x05, 1, 2, 3, 4 }, 7, 3, 4, true);
+			assertDecoded({ 0x48, 0x81, 0x3D, 1, 2, 3, 4, 5, 6, 7, 8 }, 11, 3, 4, true);
+			// mov rax,[rsp+8]
+			assertDecoded({ 0x48, 0x8B, 0x44, 0x24, 0x08 }, 5);
+			// je rel8; je rel32; call rel32
+			assertDecoded({ 0x74, 0x10 }, 2, 1, 1);
+			assertDecoded({ 0x0F, 0x84, 1, 2, 3, 4 }, 6, 2, 4);
+			assertDecoded({ 0xE8, 1, 2, 3, 4 }, 5, 1, 4);
+			// VEX and instructions invalid in x64
+			Os::InstructionInfo info;
+			const uint8_t vex[] = { 0xC5, 0xF8, 0x77 };
+			Assert::IsFalse(Os::decodeInstruction<Os::DECODE_X64>(vex, info));
+			const uint8_t pushEs[] = { 0x06 };
+			Assert::IsFalse(Os::decodeInstruction<Os::DECODE_X64>(pushEs, info));
+		}
+
+		TEST_METHOD(TestWidenShortJump) {
+			testCodeBlock targetBlock(CODE_BLOCK_SIZE);
+			testCodeBlock trampolineBlock(CODE_BLOCK_SIZE);
+			testCodeBlock hookBlock(CODE_BLOCK_SIZE);
+			// return param ? 1 : 2
+			testArch::Cmp(targetBlock, X64::RDI, S8(0));
+			X64::FwdLabel<X64::SHORT> zero = testArch::Je<X64::SHORT>(targetBlock);
+			testArch::Mov(targetBlock, X64::RAX, S32(1));
+			testArch::Ret(targetBlock);
+			Addr zeroAddr = targetBlock.getCurrentPtr();
+			Assert::IsTrue(zero.bind(targetBlock));
+			testArch::Mov(targetBlock, X64::RAX, S32(2));
+			testArch::Ret(targetBlock);
+
+			X64::Detour detour;
+			Assert::IsTrue(detour.install(trampolineBlock, getData(targetBlock), hookBlock.getStartPtr()));
+			generateHook(hookBlock, detour);
+			Assert::AreEqual(Size(6), detour.getReplacedSize());
+			Assert::IsTrue(detour.getTrampoline() == trampolineBlock.getStartPtr());
+			// cmp rdi,0; je rel32
+			const uint8_t widened[] = { 0x48, 0x83, 0xFF, 0x00, 0x0F, 0x84 };
+			Assert::AreBytesEqual(widened, detour.getTrampoline(), sizeof(widened));
+			int32_t rel;
+			std::memcpy(&rel, detour.getTrampoline() + 6, sizeof(rel));
+			Assert::IsTrue(detour.getTrampoline() + 10 + rel == zeroAddr);
+
+			Assert::AreEqual(int64_t(101), targetBlock.invoke<int64_t>(int64_t(1)));
+			Assert::AreEqual(int64_t(102), targetBlock.invoke<int64_t>(int64_t(0)));
+			Assert::IsTrue(detour.uninstall());
+			Assert::AreEqual(int64_t(2), targetBlock.invoke<int64_t>(int64_t(0)));
+		}
+
+		TEST_METHOD(TestRipRelative) {
+			testCodeBlock targetBlock(CODE_BLOCK_SIZE);
+			testCodeBlock trampolineBlock(CODE_BLOCK_SIZE);
+			testCodeBlock hookBlock(CODE_BLOCK_SIZE);
+			int64_t* data = reinterpret_cast<int64_t*>(getData(targetBlock) + 64);
+			*data = 42;
+			testArch::Mov(targetBlock, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(targetBlock.getStartPtr() + 64));
+			testArch::Ret(targetBlock);
+
+			X64::Detour detour;
+			Assert::IsTrue(detour.install(trampolineBlock, getData(targetBlock), hookBlock.getStartPtr()));
+			generateHook(hookBlock, detour);
+			Assert::AreEqual(Size(7), detour.getReplacedSize());
+			// displacement adjusted for trampoline address
+			int32_t disp;
+			std::memcpy(&disp, detour.getTrampoline() + 3, sizeof(disp));
+			Assert::IsTrue(detour.getTrampoline() + 7 + disp == targetBlock.getStartPtr() + 64);
+
+			Assert::AreEqual(int64_t(142), targetBlock.invoke<int64_t>());
+			*data = 43;
+			Assert::AreEqual(int64_t(143), targetBlock.invoke<int64_t>());
+		}
+
+		TEST_METHOD(TestFarHookVeneer) {
+			testCodeBlock targetBlock(CODE_BLOCK_SIZE);
+			testCodeBlock trampolineBlock(CODE_BLOCK_SIZE);
+			FarMemory farMemory(targetBlock.getStartPtr(), CODE_BLOCK_SIZE);
+			Os::CodeBlock hookBlock(farMemory.address, CODE_BLOCK_SIZE);
+			testArch::Mov(targetBlock, X64::RAX, S32(1));
+			testArch::Ret(targetBlock);
+
+			X64::Detour detour;
+			Assert::IsTrue(detour.install(trampolineBlock, getData(targetBlock), hookBlock.getStartPtr()));
+			// trampoline is out of rel32 range of hook too
+			testArch::Mov(hookBlock, X64::RAX, U64(reinterpret_cast<uintptr_t>(detour.getTrampoline())));
+			testArch::Call(hookBlock, X64::RAX);
+			testArch::Add(hookBlock, X64::RAX, S32(100));
+			testArch::Ret(hookBlock);
+			// target jump to veneer: MOV R11,hook; JMP R11 written before trampoline
+			int32_t rel;
+			std::memcpy(&rel, targetBlock.getStartPtr() + 1, sizeof(rel));
+			Assert::IsTrue(targetBlock.getStartPtr() + 5 + rel == trampolineBlock.getStartPtr());
+			const uint8_t movR11[] = { 0x49, 0xBB };
+			Assert::AreBytesEqual(movR11, trampolineBlock.getStartPtr(), sizeof(movR11));
+			uint64_t hook;
+			std::memcpy(&hook, trampolineBlock.getStartPtr() + 2, sizeof(hook));
+			Assert::AreEqual(reinterpret_cast<uint64_t>(hookBlock.getStartPtr()), hook);
+			const uint8_t jmpR11[] = { 0x41, 0xFF, 0xE3 };
+			Assert::AreBytesEqual(jmpR11, trampolineBlock.getStartPtr() + 10, sizeof(jmpR11));
+			Assert::IsTrue(detour.getTrampoline() == trampolineBlock.getStartPtr() + 13);
+
+			Assert::AreEqual(int64_t(101), targetBlock.invoke<int64_t>());
+			Assert::IsTrue(detour.uninstall());
+			Assert::AreEqual(int64_t(1), targetBlock.invoke<int64_t>());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test to verify x64 code generated on Linux can be executed */
+	TEST_CLASS(X64ExecutionTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+
+		static Addr generateReturn(testCodeBlock& block, int32_t value) {
+			Addr addr = block.getCurrentPtr();
+			testArch::Mov(block, X64::RAX, S32(value));
+			testArch::Ret(block);
+			return addr;
+		}
+	public:
+		TEST_METHOD(TestSumOfParams) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			{
+				Linux::FunctionGen64<> gen(block);
+				testArch::Mov(block, X64::RAX, gen.getParameter(0));
+				testArch::Add(block, X64::RAX, gen.getParameter(1));
+				testArch::Add(block, X64::RAX, gen.getParameter(2));
+			}
+			Assert::AreEqual(int64_t(6), block.invoke<int64_t>(int64_t(1), int64_t(2), int64_t(3)));
+		}
+
+		TEST_METHOD(TestFloatParams) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			{
+				// double f(double a, double b) { return sqrt(a + b); }
+				Linux::FunctionGen64<> gen(block);
+				X64::RegXMM result = gen.getFloatParameter(0);
+				X64::SSE2::Addsd(block, result, gen.getFloatParameter(1));
+				X64::SSE2::Sqrtsd(block, result, result);
+			}
+			Assert::AreEqual(4.0, block.invoke<double>(9.0, 7.0));
+			Assert::AreEqual(0.5, block.invoke<double>(0.125, 0.125));
+		}
+
+		TEST_METHOD(TestSavedRegisters) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			{
+				Linux::FunctionGen64<> gen(block, 24, { X64::RBX, X64::R12 });
+				testArch::Mov(block, X64::RBX, gen.getParameter(0));
+				testArch::Mov(block, X64::R12, gen.getParameter(1));
+				testArch::Mov(block, gen.getVariable(0), X64::RBX);
+				testArch::Mov(block, X64::RAX, gen.getVariable(0));
+				testArch::Sub(block, X64::RAX, X64::R12);
+			}
+			Assert::AreEqual(int64_t(7), block.invoke<int64_t>(int64_t(10), int64_t(3)));
+		}
+
+		TEST_METHOD(TestInlineCacheClear) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Addr missAddr = generateReturn(block, 0);
+			Addr handler1 = generateReturn(block, 100);
+			Addr handler2 = generateReturn(block, 200);
+			Addr handler3 = generateReturn(block, 300);
+			Addr functionAddr = block.getCurrentPtr();
+			X64::InlineCache<2> cache;
+			Assert::IsTrue(cache.emit(block, X64::EDI, missAddr));
+			Assert::IsTrue(cache.add(block, 5, handler1));
+			Assert::IsTrue(cache.add(block, 6, handler2));
+			Assert::IsTrue(cache.isFull());
+			Assert::AreEqual(int64_t(100), block.invokeAddr<int64_t>(functionAddr, 5));
+			Assert::AreEqual(int64_t(200), block.invokeAddr<int64_t>(functionAddr, 6));
+
+			// cleared entries keep type ids but jump to miss stub
+			Assert::IsTrue(cache.clear(block));
+			Assert::AreEqual(Size(0), cache.getCount());
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(functionAddr, 5));
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(functionAddr, 6));
+
+			// reused entry gets new type id and handler, stale type of other entry still misses
+			Assert::IsTrue(cache.add(block, 7, handler3));
+			Assert::AreEqual(Size(1), cache.getCount());
+			Assert::AreEqual(int64_t(300), block.invokeAddr<int64_t>(functionAddr, 7));
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(functionAddr, 5));
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(functionAddr, 6));
+		}
+
+		TEST_METHOD(TestWriteInstruction) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Os::writeInstruction(block, [](auto& buffer) {
+				testArch::Mov(buffer, X64::RAX, U64(0x1122334455667788));
+			});
+			// instruction committed when writeInstruction() returns
+			Assert::AreEqual(Size(10), block.getSize());
+			Os::writeInstruction(block, [](auto& buffer) {
+				testArch::Ret(buffer);
+			});
+			const uint8_t expected[] = { 0x48, 0xB8, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11, 0xC3 };
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+			Assert::AreEqual(uint64_t(0x1122334455667788), block.invoke<uint64_t>());
+		}
+
+		TEST_METHOD(TestInstructionBufferBlockPolicy) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			block.writeRaw<uint8_t>(0xAB, 5);
+			Os::LiteralPool<64> pool;
+			pool.setBase(block.getStartPtr() + 16);
+			Addr literal = pool.getLiteral(uint64_t(0x1234));
+			{
+				Os::InstructionBuffer<testCodeBlock> buffer(block);
+				testArch::Mov(buffer, X64::RAX, X64::Mem64<X64::BASE>(X64::RAX));
+				Assert::AreEqual(Size(3), buffer.getSize());
+				Assert::AreEqual(CODE_BLOCK_SIZE - 3, buffer.getRemainingSize());
+				Assert::AreEqual(CODE_BLOCK_SIZE, buffer.getTotalSize());
+				Assert::AreEqual(Size(13), buffer.getAlignSize<16>());
+				// only written bytes are read from buffer
+				uint8_t value = 0;
+				buffer.readRaw(value, 5);
+				Assert::AreEqual(uint8_t(0xAB), value);
+				Assert::IsTrue(pool.place(buffer));
+				Assert::AreEqual(Size(24), buffer.getSize());
+			}
+			Assert::AreEqual(Size(24), block.getSize());
+			uint64_t value;
+			std::memcpy(&value, literal, sizeof(value));
+			Assert::AreEqual(uint64_t(0x1234), value);
+		}
+
+		TEST_METHOD(TestInstructionBufferRewrite) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			generateReturn(block, 1);
+			Addr next = generateReturn(block, 2);
+			// rewrite MOV of first function, its RET and following code are kept
+			Assert::IsTrue(block.reset(block.getStartPtr()));
+			{
+				Os::InstructionBuffer<testCodeBlock> buffer(block);
+				testArch::Mov(buffer, X64::RAX, S32(3));
+			}
+			Assert::AreEqual(Size(7), block.getSize());
+			Assert::AreEqual(int64_t(3), block.invoke<int64_t>());
+			Assert::AreEqual(int64_t(2), block.invokeAddr<int64_t>(next));
+		}
+
+		TEST_METHOD(TestRipRelativeImmediate) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Addr data = block.getCurrentPtr();
+			block.pushRaw<uint64_t>(0);
+			Addr functionAddr = block.getCurrentPtr();
+
+			// displacement is relative to end of instruction including immediate operand
+			Addr addAddr = block.getCurrentPtr();
+			testArch::Add<X64::QWORD_PTR>(block, X64::Mem64<X64::RIP_OFFSET>(data), S32(40));
+			Assert::AreEqual(Size(11), Size(block.getCurrentPtr() - addAddr));
+			Addr btsAddr = block.getCurrentPtr();
+			testArch::Bts<X64::QWORD_PTR>(block, X64::Mem64<X64::RIP_OFFSET>(data), U8(8));
+			Assert::AreEqual(Size(9), Size(block.getCurrentPtr() - btsAddr));
+			testArch::Mov(block, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(data));
+			testArch::Ret(block);
+
+			Addr roundAddr = block.getCurrentPtr();
+			X64::SSE4_1::Roundsd(block, X64::XMM0, X64::Mem64<X64::RIP_OFFSET>(data), U8(0));
+			Addr rorxAddr = block.getCurrentPtr();
+			X64::BMI2::Rorx(block, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(data), U8(1));
+			Addr endAddr = block.getCurrentPtr();
+
+			const Addr dispAddrs[] = { addAddr + 3, btsAddr + 4, roundAddr + 5, rorxAddr + 5 };
+			const Addr nextAddrs[] = { btsAddr, btsAddr + 9, rorxAddr, endAddr };
+			for (Size i = 0; i < 4; i++) {
+				int32_t disp;
+				std::memcpy(&disp, dispAddrs[i], sizeof(disp));
+				Assert::AreEqual(static_cast<int32_t>(data - nextAddrs[i]), disp);
+			}
+			Assert::AreEqual(int64_t(40 + 256), block.invokeAddr<int64_t>(functionAddr));
+		}
+
+		TEST_METHOD(TestLiteralPoolReachable) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			Os::LiteralPool<64> pool;
+			pool.setBase(block.getStartPtr() + 1024);
+			Addr literal = pool.getLiteral(uint64_t(0x55AA));
+			Assert::IsTrue(pool.isReachableFrom(block.getStartPtr()));
+			Assert::IsTrue(pool.isReachableFrom(block.getStartPtr() + CODE_BLOCK_SIZE));
+			uintptr_t base = reinterpret_cast<uintptr_t>(block.getStartPtr()) + 1024;
+			Assert::IsFalse(pool.isReachableFrom(reinterpret_cast<Addr>(base + 64 - (uintptr_t(1) << 31) - 1)));
+			Assert::IsFalse(pool.isReachableFrom(reinterpret_cast<Addr>(base + (uintptr_t(1) << 31) + 1)));
+
+			testArch::Mov(block, X64::RAX, X64::Mem64<X64::RIP_OFFSET>(literal));
+			testArch::Ret(block);
+			block.skipBytes(1024 - block.getSize());
+			Assert::IsTrue(pool.place(block));
+			Assert::AreEqual(uint64_t(0x55AA), block.invoke<uint64_t>());
+		}
+
+		TEST_METHOD(TestJumpTable) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::JumpTable<3> table;
+			table.reserve(block);
+			Addr functionAddr = block.getCurrentPtr();
+			X64::FwdLabel<X64::LONG> defaultLabel = table.dispatch(block, X64::RDI, X64::RAX);
+			Addr leaAddr = functionAddr + 7 + 6;
+			Addr caseAddrs[3];
+			for (Size i = 0; i < 3; i++) {
+				caseAddrs[i] = block.getCurrentPtr();
+				Assert::IsTrue(table.bind(block, i));
+				testArch::Mov(block, X64::RAX, S32(static_cast<int32_t>(10 * i)));
+				testArch::Ret(block);
+			}
+			Assert::IsTrue(defaultLabel.bind(block));
+			testArch::Mov(block, X64::RAX, S32(-1));
+			testArch::Ret(block);
+
+			// table entries are offsets of cases from table start
+			for (Size i = 0; i < 3; i++) {
+				int32_t entry;
+				std::memcpy(&entry, table.getAddress() + i * sizeof(entry), sizeof(entry));
+				Assert::AreEqual(static_cast<int32_t>(caseAddrs[i] - table.getAddress()), entry);
+			}
+
+			// CMP RDI,3; JAE default; LEA RAX,[RIP+table]; MOVSXD RDI,[RAX+RDI*4]; ADD RDI,RAX; JMP RDI
+			const uint8_t cmpJae[] = { 0x48, 0x81, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x0F, 0x83 };
+			Assert::AreBytesEqual(cmpJae, functionAddr, sizeof(cmpJae));
+			const uint8_t lea[] = { 0x48, 0x8D, 0x05 };
+			Assert::AreBytesEqual(lea, leaAddr, sizeof(lea));
+			int32_t tableDisp;
+			std::memcpy(&tableDisp, leaAddr + 3, sizeof(tableDisp));
+			Assert::AreEqual(static_cast<int32_t>(table.getAddress() - (leaAddr + 7)), tableDisp);
+			const uint8_t jump[] = { 0x48, 0x63, 0x3C, 0xB8, 0x48, 0x01, 0xC7, 0xFF, 0xE7 };
+			Assert::AreBytesEqual(jump, leaAddr + 7, sizeof(jump));
+
+			Assert::AreEqual(int64_t(0), block.invokeAddr<int64_t>(functionAddr, int64_t(0)));
+			Assert::AreEqual(int64_t(10), block.invokeAddr<int64_t>(functionAddr, int64_t(1)));
+			Assert::AreEqual(int64_t(20), block.invokeAddr<int64_t>(functionAddr, int64_t(2)));
+			Assert::AreEqual(int64_t(-1), block.invokeAddr<int64_t>(functionAddr, int64_t(3)));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 x87 FPU instructions encoding */
+	TEST_CLASS(X64FpuTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestFpuTransferEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::Mem64<X64::BASE_INDEX> memR12(X64::R12, X64::R13);
+			X64::Mem32<X64::BASE> mem32(X64::EDI);
+			X64::i387::Fld<X64::DWORD_PTR>(block, mem);
+			X64::i387::Fld<X64::QWORD_PTR>(block, memR8);
+			X64::i387::Fld<X64::TBYTE_PTR>(block, memR8);
+			X64::i387::Fld<X64::TBYTE_PTR>(block, memR12);
+			X64::i387::Fld(block, X64::ST3);
+			X64::i387::Fst<X64::QWORD_PTR>(block, mem);
+			X64::i387::Fst(block, X64::ST2);
+			X64::i387::Fstp<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fstp<X64::TBYTE_PTR>(block, memR8);
+			X64::i387::Fstp<X64::TBYTE_PTR>(block, mem32);
+			X64::i387::Fstp(block, X64::ST1);
+			X64::i387::Fild<X64::WORD_PTR>(block, mem);
+			X64::i387::Fild<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fild<X64::QWORD_PTR>(block, memR8);
+			X64::i387::Fist<X64::WORD_PTR>(block, memR8);
+			X64::i387::Fistp<X64::QWORD_PTR>(block, mem);
+			X64::i387::Fisttp<X64::DWORD_PTR>(block, mem);
+			X64::i387::Fisttp<X64::QWORD_PTR>(block, memR8);
+			X64::i387::Fbld(block, memR8);
+			X64::i387::Fbstp(block, mem);
+			X64::i387::Fxch(block);
+			X64::i387::Fxch(block, X64::ST7);
+			const uint8_t expected[] = {
+				0xD9, 0x07,				// fld dword ptr [rdi]
+				0x41, 0xDD, 0x40, 0x10,	// fld qword ptr [r8+0x10]
+				0x41, 0xDB, 0x68, 0x10,	// fld tbyte ptr [r8+0x10]
+				0x43, 0xDB, 0x2C, 0x2C,	// fld tbyte ptr [r12+r13]
+				0xD9, 0xC3,				// fld st(3)
+				0xDD, 0x17,				// fst qword ptr [rdi]
+				0xDD, 0xD2,				// fst st(2)
+				0x41, 0xD9, 0x58, 0x10,	// fstp dword ptr [r8+0x10]
+				0x41, 0xDB, 0x78, 0x10,	// fstp tbyte ptr [r8+0x10]
+				0x67, 0xDB, 0x3F,		// fstp tbyte ptr [edi]
+				0xDD, 0xD9,				// fstp st(1)
+				0xDF, 0x07,				// fild word ptr [rdi]
+				0x41, 0xDB, 0x40, 0x10,	// fild dword ptr [r8+0x10]
+				0x41, 0xDF, 0x68, 0x10,	// fild qword ptr [r8+0x10]
+				0x41, 0xDF, 0x50, 0x10,	// fist word ptr [r8+0x10]
+				0xDF, 0x3F,				// fistp qword ptr [rdi]
+				0xDB, 0x0F,				// fisttp dword ptr [rdi]
+				0x41, 0xDD, 0x48, 0x10,	// fisttp qword ptr [r8+0x10]
+				0x41, 0xDF, 0x60, 0x10,	// fbld tbyte ptr [r8+0x10]
+				0xDF, 0x37,				// fbstp tbyte ptr [rdi]
+				0xD9, 0xC9,				// fxch st(1)
+				0xD9, 0xCF				// fxch st(7)
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestFpuArithmeticEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::i387::Fadd<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fadd(block, X64::ST, X64::ST2);
+			X64::i387::Fadd(block, X64::ST2, X64::ST);
+			X64::i387::Faddp(block, X64::ST3, X64::ST);
+			X64::i387::Faddp(block);
+			X64::i387::Fiadd<X64::WORD_PTR>(block, mem);
+			X64::i387::Fsub<X64::QWORD_PTR>(block, mem);
+			X64::i387::Fsub(block, X64::ST, X64::ST1);
+			X64::i387::Fsub(block, X64::ST1, X64::ST);
+			X64::i387::Fsubp(block);
+			X64::i387::Fsubr(block, X64::ST, X64::ST1);
+			X64::i387::Fsubr(block, X64::ST1, X64::ST);
+			X64::i387::Fsubrp(block);
+			X64::i387::Fisub<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fisubr<X64::WORD_PTR>(block, mem);
+			X64::i387::Fmul<X64::QWORD_PTR>(block, memR8);
+			X64::i387::Fmul(block, X64::ST, X64::ST4);
+			X64::i387::Fmul(block, X64::ST4, X64::ST);
+			X64::i387::Fmulp(block);
+			X64::i387::Fimul<X64::DWORD_PTR>(block, mem);
+			X64::i387::Fdiv<X64::DWORD_PTR>(block, mem);
+			X64::i387::Fdiv(block, X64::ST, X64::ST5);
+			X64::i387::Fdiv(block, X64::ST5, X64::ST);
+			X64::i387::Fdivp(block);
+			X64::i387::Fdivr<X64::QWORD_PTR>(block, memR8);
+			X64::i387::Fdivr(block, X64::ST, X64::ST6);
+			X64::i387::Fdivr(block, X64::ST6, X64::ST);
+			X64::i387::Fdivrp(block);
+			X64::i387::Fidiv<X64::WORD_PTR>(block, memR8);
+			X64::i387::Fidivr<X64::DWORD_PTR>(block, mem);
+			const uint8_t expected[] = {
+				0x41, 0xD8, 0x40, 0x10,	// fadd dword ptr [r8+0x10]
+				0xD8, 0xC2,				// fadd st,st(2)
+				0xDC, 0xC2,				// fadd st(2),st
+				0xDE, 0xC3,				// faddp st(3),st
+				0xDE, 0xC1,				// faddp st(1),st
+				0xDE, 0x07,				// fiadd word ptr [rdi]
+				0xDC, 0x27,				// fsub qword ptr [rdi]
+				0xD8, 0xE1,				// fsub st,st(1)
+				0xDC, 0xE9,				// fsub st(1),st
+				0xDE, 0xE9,				// fsubp st(1),st
+				0xD8, 0xE9,				// fsubr st,st(1)
+				0xDC, 0xE1,				// fsubr st(1),st
+				0xDE, 0xE1,				// fsubrp st(1),st
+				0x41, 0xDA, 0x60, 0x10,	// fisub dword ptr [r8+0x10]
+				0xDE, 0x2F,				// fisubr word ptr [rdi]
+				0x41, 0xDC, 0x48, 0x10,	// fmul qword ptr [r8+0x10]
+				0xD8, 0xCC,				// fmul st,st(4)
+				0xDC, 0xCC,				// fmul st(4),st
+				0xDE, 0xC9,				// fmulp st(1),st
+				0xDA, 0x0F,				// fimul dword ptr [rdi]
+				0xD8, 0x37,				// fdiv dword ptr [rdi]
+				0xD8, 0xF5,				// fdiv st,st(5)
+				0xDC, 0xFD,				// fdiv st(5),st
+				0xDE, 0xF9,				// fdivp st(1),st
+				0x41, 0xDC, 0x78, 0x10,	// fdivr qword ptr [r8+0x10]
+				0xD8, 0xFE,				// fdivr st,st(6)
+				0xDC, 0xF6,				// fdivr st(6),st
+				0xDE, 0xF1,				// fdivrp st(1),st
+				0x41, 0xDE, 0x70, 0x10,	// fidiv word ptr [r8+0x10]
+				0xDA, 0x3F				// fidivr dword ptr [rdi]
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestFpuCompareEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::i387::Fcom<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fcom(block, X64::ST2);
+			X64::i387::Fcomp<X64::QWORD_PTR>(block, mem);
+			X64::i387::Fcomp(block);
+			X64::i387::Fcompp(block);
+			X64::i387::Ficom<X64::WORD_PTR>(block, mem);
+			X64::i387::Ficomp<X64::DWORD_PTR>(block, memR8);
+			X64::i387::Fucom(block, X64::ST3);
+			X64::i387::Fucomp(block);
+			X64::i387::Fucompp(block);
+			X64::i387::Fcomi(block, X64::ST, X64::ST1);
+			X64::i387::Fcomip(block, X64::ST, X64::ST2);
+			X64::i387::Fucomi(block, X64::ST, X64::ST3);
+			X64::i387::Fucomip(block, X64::ST, X64::ST4);
+			X64::i387::Ftst(block);
+			X64::i387::Fxam(block);
+			const uint8_t expected[] = {
+				0x41, 0xD8, 0x50, 0x10,	// fcom dword ptr [r8+0x10]
+				0xD8, 0xD2,				// fcom st(2)
+				0xDC, 0x1F,				// fcomp qword ptr [rdi]
+				0xD8, 0xD9,				// fcomp st(1)
+				0xDE, 0xD9,				// fcompp
+				0xDE, 0x17,				// ficom word ptr [rdi]
+				0x41, 0xDA, 0x58, 0x10,	// ficomp dword ptr [r8+0x10]
+				0xDD, 0xE3,				// fucom st(3)
+				0xDD, 0xE9,				// fucomp st(1)
+				0xDA, 0xE9,				// fucompp
+				0xDB, 0xF1,				// fcomi st,st(1)
+				0xDF, 0xF2,				// fcomip st,st(2)
+				0xDB, 0xEB,				// fucomi st,st(3)
+				0xDF, 0xEC,				// fucomip st,st(4)
+				0xD9, 0xE4,				// ftst
+				0xD9, 0xE5				// fxam
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestFpuMathEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::i387::F2xm1(block);
+			X64::i387::Fabs(block);
+			X64::i387::Fchs(block);
+			X64::i387::Fcos(block);
+			X64::i387::Fsin(block);
+			X64::i387::Fsincos(block);
+			X64::i387::Fsqrt(block);
+			X64::i387::Fptan(block);
+			X64::i387::Fpatan(block);
+			X64::i387::Fprem(block);
+			X64::i387::Fprem1(block);
+			X64::i387::Frndint(block);
+			X64::i387::Fscale(block);
+			X64::i387::Fxtract(block);
+			X64::i387::FyL2X(block);
+			X64::i387::FyL2XP1(block);
+			X64::i387::Fld1(block);
+			X64::i387::FldL2T(block);
+			X64::i387::FldL2E(block);
+			X64::i387::FldPI(block);
+			X64::i387::FldLG2(block);
+			X64::i387::FldLN2(block);
+			X64::i387::FldZ(block);
+			const uint8_t expected[] = {
+				0xD9, 0xF0,	// f2xm1
+				0xD9, 0xE1,	// fabs
+				0xD9, 0xE0,	// fchs
+				0xD9, 0xFF,	// fcos
+				0xD9, 0xFE,	// fsin
+				0xD9, 0xFB,	// fsincos
+				0xD9, 0xFA,	// fsqrt
+				0xD9, 0xF2,	// fptan
+				0xD9, 0xF3,	// fpatan
+				0xD9, 0xF8,	// fprem
+				0xD9, 0xF5,	// fprem1
+				0xD9, 0xFC,	// frndint
+				0xD9, 0xFD,	// fscale
+				0xD9, 0xF4,	// fxtract
+				0xD9, 0xF1,	// fyl2x
+				0xD9, 0xF9,	// fyl2xp1
+				0xD9, 0xE8,	// fld1
+				0xD9, 0xE9,	// fldl2t
+				0xD9, 0xEA,	// fldl2e
+				0xD9, 0xEB,	// fldpi
+				0xD9, 0xEC,	// fldlg2
+				0xD9, 0xED,	// fldln2
+				0xD9, 0xEE	// fldz
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestFpuControlEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::i387::Ffree(block, X64::ST6);
+			X64::i387::Fnop(block);
+			X64::i387::Fincstp(block);
+			X64::i387::Fdecstp(block);
+			X64::i387::Fninit(block);
+			X64::i387::Finit(block);
+			X64::i387::Fnclex(block);
+			X64::i387::Fclex(block);
+			X64::i387::Fldcw(block, memR8);
+			X64::i387::Fnstcw(block, mem);
+			X64::i387::Fstcw(block, mem);
+			X64::i387::Fldenv(block, memR8);
+			X64::i387::Fnstenv(block, mem);
+			X64::i387::Fstenv(block, memR8);
+			X64::i387::Frstor(block, memR8);
+			X64::i387::Fnsave(block, mem);
+			X64::i387::Fsave(block, memR8);
+			X64::i387::Fnstsw(block, memR8);
+			X64::i387::Fstsw(block, mem);
+			X64::i387::Fnstsw(block);
+			X64::i387::Fstsw(block);
+			X64::i387::Fwait(block);
+			const uint8_t expected[] = {
+				0xDD, 0xC6,						// ffree st(6)
+				0xD9, 0xD0,						// fnop
+				0xD9, 0xF7,						// fincstp
+				0xD9, 0xF6,						// fdecstp
+				0xDB, 0xE3,						// fninit
+				0x9B, 0xDB, 0xE3,				// finit
+				0xDB, 0xE2,						// fnclex
+				0x9B, 0xDB, 0xE2,				// fclex
+				0x41, 0xD9, 0x68, 0x10,			// fldcw word ptr [r8+0x10]
+				0xD9, 0x3F,						// fnstcw word ptr [rdi]
+				0x9B, 0xD9, 0x3F,				// fstcw word ptr [rdi]
+				0x41, 0xD9, 0x60, 0x10,			// fldenv [r8+0x10]
+				0xD9, 0x37,						// fnstenv [rdi]
+				0x9B, 0x41, 0xD9, 0x70, 0x10,	// fstenv [r8+0x10]
+				0x41, 0xDD, 0x60, 0x10,			// frstor [r8+0x10]
+				0xDD, 0x37,						// fnsave [rdi]
+				0x9B, 0x41, 0xDD, 0x70, 0x10,	// fsave [r8+0x10]
+				0x41, 0xDD, 0x78, 0x10,			// fnstsw word ptr [r8+0x10]
+				0x9B, 0xDD, 0x3F,				// fstsw word ptr [rdi]
+				0xDF, 0xE0,						// fnstsw ax
+				0x9B, 0xDF, 0xE0,				// fstsw ax
+				0x9B							// fwait
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestFpuExtendedCopy) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// copy 80-bit value through REX-extended base registers
+			testArch::Mov(block, X64::R8, X64::RDI);
+			testArch::Mov(block, X64::R9, X64::RSI);
+			X64::i387::Fld<X64::TBYTE_PTR>(block, X64::Mem64<X64::BASE_OFFSET>(X64::R8, 0x10));
+			X64::i387::Fstp<X64::TBYTE_PTR>(block, X64::Mem64<X64::BASE_OFFSET>(X64::R9, 0x10));
+			testArch::Ret(block);
+
+			uint8_t src[32] = {};
+			uint8_t dst[32] = {};
+			long double value = 1.0L / 3.0L;
+			std::memcpy(src + 0x10, &value, 10);
+			block.invoke<void>(src, dst);
+			Assert::AreBytesEqual(src, dst, sizeof(dst));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test linking of calls between x64 functions in different blocks */
+	TEST_CLASS(X64LinkerTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestLinkCallAndTailCall) {
+			enum { FUNC_CALLER, FUNC_TAIL_CALLER, FUNC_CALLEE };
+			testCodeBlock callerBlock(CODE_BLOCK_SIZE);
+			testCodeBlock calleeBlock(CODE_BLOCK_SIZE);
+			Os::Linker<Os::CodeBlock, 3, 2> linker;
+			linker.define(FUNC_CALLER, callerBlock);
+			Assert::IsTrue(linker.addFixup(callerBlock, testArch::Call(callerBlock), FUNC_CALLEE));
+			testArch::Add(callerBlock, X64::RAX, S32(1));
+			testArch::Ret(callerBlock);
+			linker.define(FUNC_TAIL_CALLER, callerBlock);
+			Assert::IsTrue(linker.addFixup(callerBlock, testArch::Jmp<X64::LONG>(callerBlock), FUNC_CALLEE));
+			Assert::IsFalse(linker.link());
+
+			linker.define(FUNC_CALLEE, calleeBlock);
+			testArch::Mov(calleeBlock, X64::RAX, S32(41));
+			testArch::Ret(calleeBlock);
+			Assert::IsTrue(linker.link());
+			Assert::AreEqual(int64_t(42), callerBlock.invokeAddr<int64_t>(linker.getAddress(FUNC_CALLER)));
+			Assert::AreEqual(int64_t(41), callerBlock.invokeAddr<int64_t>(linker.getAddress(FUNC_TAIL_CALLER)));
+		}
+
+		TEST_METHOD(TestLinkFarCallThroughVeneer) {
+			enum { FUNC_CALLER, FUNC_FAR };
+			testCodeBlock callerBlock(CODE_BLOCK_SIZE);
+			testCodeBlock veneerBlock(CODE_BLOCK_SIZE);
+			FarMemory farMemory(callerBlock.getStartPtr(), CODE_BLOCK_SIZE);
+			Os::CodeBlock farBlock(farMemory.address, CODE_BLOCK_SIZE);
+			X64::VeneerPool<testCodeBlock, 2> veneers(veneerBlock);
+			Os::Linker<Os::CodeBlock, 2, 2> linker;
+
+			linker.define(FUNC_FAR, farBlock);
+			testArch::Mov(farBlock, X64::RAX, S32(41));
+			testArch::Ret(farBlock);
+			linker.define(FUNC_CALLER, callerBlock);
+			X64::FwdLabel<X64::LONG> call1 = testArch::Call(callerBlock);
+			Assert::IsTrue(linker.addFixup(callerBlock, call1, FUNC_FAR));
+			testArch::Mov(callerBlock, X64::RCX, X64::RAX);
+			Assert::IsTrue(linker.addFixup(callerBlock, testArch::Call(callerBlock), FUNC_FAR));
+			testArch::Add(callerBlock, X64::RAX, X64::RCX);
+			testArch::Ret(callerBlock);
+
+			// out of rel32 range without veneers
+			Assert::IsFalse(linker.link());
+			Assert::IsTrue(linker.link(veneers));
+			// both calls share single veneer: MOV R11,target; JMP R11
+			Assert::AreEqual(Size(1), veneers.getCount());
+			Assert::AreEqual(X64::VeneerPool<testCodeBlock, 2>::VENEER_SIZE, veneerBlock.getSize());
+			const uint8_t movR11[] = { 0x49, 0xBB };
+			Assert::AreBytesEqual(movR11, veneerBlock.getStartPtr(), sizeof(movR11));
+			uint64_t target;
+			std::memcpy(&target, veneerBlock.getStartPtr() + 2, sizeof(target));
+			Assert::AreEqual(reinterpret_cast<uint64_t>(farBlock.getStartPtr()), target);
+			const uint8_t jmpR11[] = { 0x41, 0xFF, 0xE3 };
+			Assert::AreBytesEqual(jmpR11, veneerBlock.getStartPtr() + 10, sizeof(jmpR11));
+			int32_t rel;
+			std::memcpy(&rel, callerBlock.getStartPtr() + call1.getCbOffset(), sizeof(rel));
+			Assert::IsTrue(callerBlock.getStartPtr() + call1.getCbOffset() + sizeof(rel) + rel == veneerBlock.getStartPtr());
+
+			Assert::AreEqual(int64_t(82), callerBlock.invoke<int64_t>());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 random number and processor state save instructions encoding */
+	TEST_CLASS(X64ProcessorStateTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestProcessorStateEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x40);
+			X64::RDRAND::Rdrand(block, X64::AX);
+			X64::RDRAND::Rdrand(block, X64::EAX);
+			X64::RDRAND::Rdrand(block, X64::R9);
+			X64::RDSEED::Rdseed(block, X64::RCX);
+			X64::RDSEED::Rdseed(block, X64::R10d);
+			X64::FXSR::Fxsave(block, mem);
+			X64::FXSR::Fxsave64(block, memR8);
+			X64::FXSR::Fxrstor(block, memR8);
+			X64::FXSR::Fxrstor64(block, mem);
+			X64::XSAVE::Xsave(block, mem);
+			X64::XSAVE::Xsave64(block, memR8);
+			X64::XSAVE::Xrstor(block, memR8);
+			X64::XSAVE::Xrstor64(block, mem);
+			X64::XSAVE::Xgetbv(block);
+			X64::XSAVEC::Xsavec(block, memR8);
+			X64::XSAVEC::Xsavec64(block, mem);
+			X64::XSAVEOPT::Xsaveopt(block, mem);
+			X64::XSAVEOPT::Xsaveopt64(block, memR8);
+			const uint8_t expected[] = {
+				0x66, 0x0F, 0xC7, 0xF0,			// rdrand ax
+				0x0F, 0xC7, 0xF0,				// rdrand eax
+				0x49, 0x0F, 0xC7, 0xF1,			// rdrand r9
+				0x48, 0x0F, 0xC7, 0xF9,			// rdseed rcx
+				0x41, 0x0F, 0xC7, 0xFA,			// rdseed r10d
+				0x0F, 0xAE, 0x07,				// fxsave [rdi]
+				0x49, 0x0F, 0xAE, 0x40, 0x40,	// fxsave64 [r8+0x40]
+				0x41, 0x0F, 0xAE, 0x48, 0x40,	// fxrstor [r8+0x40]
+				0x48, 0x0F, 0xAE, 0x0F,			// fxrstor64 [rdi]
+				0x0F, 0xAE, 0x27,				// xsave [rdi]
+				0x49, 0x0F, 0xAE, 0x60, 0x40,	// xsave64 [r8+0x40]
+				0x41, 0x0F, 0xAE, 0x68, 0x40,	// xrstor [r8+0x40]
+				0x48, 0x0F, 0xAE, 0x2F,			// xrstor64 [rdi]
+				0x0F, 0x01, 0xD0,				// xgetbv
+				0x41, 0x0F, 0xC7, 0x60, 0x40,	// xsavec [r8+0x40]
+				0x48, 0x0F, 0xC7, 0x27,			// xsavec64 [rdi]
+				0x0F, 0xAE, 0x37,				// xsaveopt [rdi]
+				0x49, 0x0F, 0xAE, 0x70, 0x40	// xsaveopt64 [r8+0x40]
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 SSE4.1 and SSE4.2 instructions encoding */
+	TEST_CLASS(X64SSE4Test)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestSSE4Encoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDI);
+			X64::Mem64<X64::BASE_OFFSET> memR8(X64::R8, 0x10);
+			X64::SSE4_1::Ptest(block, X64::XMM0, X64::XMM9);
+			X64::SSE4_1::Pblendvb(block, X64::XMM1, mem);
+			X64::SSE4_1::Blendvpd(block, X64::XMM10, X64::XMM2);
+			X64::SSE4_1::Blendps(block, X64::XMM3, memR8, U8(5));
+			X64::SSE4_1::Pmovzxbd(block, X64::XMM4, mem);
+			X64::SSE4_1::Pmovsxdq(block, X64::XMM11, X64::XMM12);
+			X64::SSE4_1::Pminud(block, X64::XMM5, X64::XMM6);
+			X64::SSE4_1::Pmaxsb(block, X64::XMM7, memR8);
+			X64::SSE4_1::Pmulld(block, X64::XMM8, X64::XMM1);
+			X64::SSE4_1::Pcmpeqq(block, X64::XMM2, X64::XMM15);
+			X64::SSE4_1::Movntdqa(block, X64::XMM13, mem);
+			X64::SSE4_1::Roundsd(block, X64::XMM0, X64::XMM1, U8(4));
+			X64::SSE4_1::Dpps(block, X64::XMM1, X64::XMM2, U8(0xF1));
+			X64::SSE4_1::Insertps(block, X64::XMM3, X64::XMM4, U8(0x10));
+			X64::SSE4_1::Pinsrb(block, X64::XMM9, X64::EAX, U8(1));
+			X64::SSE4_1::Pinsrd(block, X64::XMM0, X64::R9d, U8(2));
+			X64::SSE4_1::Pinsrq(block, X64::XMM1, X64::R10, U8(1));
+			X64::SSE4_1::Pinsrq(block, X64::XMM10, memR8, U8(0));
+			X64::SSE4_1::Pextrb(block, X64::R11d, X64::XMM2, U8(3));
+			X64::SSE4_1::Pextrw(block, mem, X64::XMM3, U8(1));
+			X64::SSE4_1::Pextrd(block, X64::EAX, X64::XMM12, U8(2));
+			X64::SSE4_1::Pextrq(block, X64::RCX, X64::XMM4, U8(1));
+			X64::SSE4_1::Extractps(block, memR8, X64::XMM5, U8(3));
+			X64::SSE4_2::Pcmpestri(block, X64::XMM0, X64::XMM1, U8(0x0C));
+			X64::SSE4_2::Pcmpestrm(block, X64::XMM9, mem, U8(0x40));
+			X64::SSE4_2::Pcmpistri(block, X64::XMM2, memR8, U8(0x08));
+			X64::SSE4_2::Pcmpistrm(block, X64::XMM3, X64::XMM14, U8(0x44));
+			X64::SSE4_2::Pcmpgtq(block, X64::XMM4, X64::XMM5);
+			const uint8_t expected[] = {
+				0x66, 0x41, 0x0F, 0x38, 0x17, 0xC1,				// ptest xmm0,xmm9
+				0x66, 0x0F, 0x38, 0x10, 0x0F,					// pblendvb xmm1,xmmword ptr [rdi],xmm0
+				0x66, 0x44, 0x0F, 0x38, 0x15, 0xD2,				// blendvpd xmm10,xmm2,xmm0
+				0x66, 0x41, 0x0F, 0x3A, 0x0C, 0x58, 0x10, 0x05,	// blendps xmm3,xmmword ptr [r8+0x10],5
+				0x66, 0x0F, 0x38, 0x31, 0x27,					// pmovzxbd xmm4,dword ptr [rdi]
+				0x66, 0x45, 0x0F, 0x38, 0x25, 0xDC,				// pmovsxdq xmm11,xmm12
+				0x66, 0x0F, 0x38, 0x3B, 0xEE,					// pminud xmm5,xmm6
+				0x66, 0x41, 0x0F, 0x38, 0x3C, 0x78, 0x10,		// pmaxsb xmm7,xmmword ptr [r8+0x10]
+				0x66, 0x44, 0x0F, 0x38, 0x40, 0xC1,				// pmulld xmm8,xmm1
+				0x66, 0x41, 0x0F, 0x38, 0x29, 0xD7,				// pcmpeqq xmm2,xmm15
+				0x66, 0x44, 0x0F, 0x38, 0x2A, 0x2F,				// movntdqa xmm13,xmmword ptr [rdi]
+				0x66, 0x0F, 0x3A, 0x0B, 0xC1, 0x04,				// roundsd xmm0,xmm1,4
+				0x66, 0x0F, 0x3A, 0x40, 0xCA, 0xF1,				// dpps xmm1,xmm2,0xf1
+				0x66, 0x0F, 0x3A, 0x21, 0xDC, 0x10,				// insertps xmm3,xmm4,0x10
+				0x66, 0x44, 0x0F, 0x3A, 0x20, 0xC8, 0x01,		// pinsrb xmm9,eax,1
+				0x66, 0x41, 0x0F, 0x3A, 0x22, 0xC1, 0x02,		// pinsrd xmm0,r9d,2
+				0x66, 0x49, 0x0F, 0x3A, 0x22, 0xCA, 0x01,		// pinsrq xmm1,r10,1
+				0x66, 0x4D, 0x0F, 0x3A, 0x22, 0x50, 0x10, 0x00,	// pinsrq xmm10,qword ptr [r8+0x10],0
+				0x66, 0x41, 0x0F, 0x3A, 0x14, 0xD3, 0x03,		// pextrb r11d,xmm2,3
+				0x66, 0x0F, 0x3A, 0x15, 0x1F, 0x01,				// pextrw word ptr [rdi],xmm3,1
+				0x66, 0x44, 0x0F, 0x3A, 0x16, 0xE0, 0x02,		// pextrd eax,xmm12,2
+				0x66, 0x48, 0x0F, 0x3A, 0x16, 0xE1, 0x01,		// pextrq rcx,xmm4,1
+				0x66, 0x41, 0x0F, 0x3A, 0x17, 0x68, 0x10, 0x03,	// extractps dword ptr [r8+0x10],xmm5,3
+				0x66, 0x0F, 0x3A, 0x61, 0xC1, 0x0C,				// pcmpestri xmm0,xmm1,0x0c
+				0x66, 0x44, 0x0F, 0x3A, 0x60, 0x0F, 0x40,		// pcmpestrm xmm9,xmmword ptr [rdi],0x40
+				0x66, 0x41, 0x0F, 0x3A, 0x63, 0x50, 0x10, 0x08,	// pcmpistri xmm2,xmmword ptr [r8+0x10],0x08
+				0x66, 0x41, 0x0F, 0x3A, 0x62, 0xDE, 0x44,		// pcmpistrm xmm3,xmm14,0x44
+				0x66, 0x0F, 0x38, 0x37, 0xE5					// pcmpgtq xmm4,xmm5
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 spin-wait, time-stamp counter and WAITPKG instructions encoding */
+	TEST_CLASS(X64TimingTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestTimingEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::i386::Pause(block);
+			X64::TSC::Rdtsc(block);
+			X64::TSC::LfenceRdtsc(block);
+			X64::RDTSCP::Rdtscp(block);
+			X64::RDPID::Rdpid(block, X64::RAX);
+			X64::RDPID::Rdpid(block, X64::R9);
+			X64::WAITPKG::Umonitor(block, X64::RDI);
+			X64::WAITPKG::Umonitor(block, X64::R10);
+			X64::WAITPKG::Umonitor(block, X64::EDI);
+			X64::WAITPKG::Umwait(block, X64::ECX);
+			X64::WAITPKG::Umwait(block, X64::R11d);
+			X64::WAITPKG::Tpause(block, X64::EBX);
+			const uint8_t expected[] = {
+				0xF3, 0x90,						// pause
+				0x0F, 0x31,						// rdtsc
+				0x0F, 0xAE, 0xE8, 0x0F, 0x31,	// lfence; rdtsc
+				0x0F, 0x01, 0xF9,				// rdtscp
+				0xF3, 0x0F, 0xC7, 0xF8,			// rdpid rax
+				0xF3, 0x41, 0x0F, 0xC7, 0xF9,	// rdpid r9
+				0xF3, 0x0F, 0xAE, 0xF7,			// umonitor rdi
+				0xF3, 0x41, 0x0F, 0xAE, 0xF2,	// umonitor r10
+				0x67, 0xF3, 0x0F, 0xAE, 0xF7,	// umonitor edi
+				0xF2, 0x0F, 0xAE, 0xF1,			// umwait ecx
+				0xF2, 0x41, 0x0F, 0xAE, 0xF3,	// umwait r11d
+				0x66, 0x0F, 0xAE, 0xF3			// tpause ebx
+			};
+			Assert::AreEqual(Size(sizeof(expected)), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x64 transactional memory instructions (RTM and HLE) */
+	TEST_CLASS(X64TransactionTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+		typedef X64::i386 testArch;
+	public:
+		TEST_METHOD(TestRtmEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::FwdLabel<X64::LONG> abort = X64::RTM::Xbegin(block);
+			X64::RTM::Xtest(block);
+			X64::RTM::Xend(block);
+			Assert::IsTrue(abort.bind(block));
+			X64::RTM::Xabort(block, U8(0xFF));
+			const uint8_t expected[] = {
+				0xC7, 0xF8, 0x06, 0x00, 0x00, 0x00,	// xbegin abort
+				0x0F, 0x01, 0xD6,					// xtest
+				0x0F, 0x01, 0xD5,					// xend
+				0xC6, 0xF8, 0xFF					// abort: xabort 0xff
+			};
+			Assert::AreEqual(sizeof(expected), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+
+		TEST_METHOD(TestHleEncoding) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X64::Mem64<X64::BASE> mem(X64::RDX);
+			X64::HLE::Xacquire(block);
+			X64::i486::Xadd<X64::LOCK>(block, mem, X64::EAX);
+			X64::HLE::Xrelease(block);
+			testArch::Mov(block, mem, X64::EAX);
+			const uint8_t expected[] = {
+				0xF2, 0xF0, 0x0F, 0xC1, 0x02,		// xacquire lock xadd dword ptr [rdx],eax
+				0xF3, 0x89, 0x02					// xrelease mov dword ptr [rdx],eax
+			};
+			Assert::AreEqual(sizeof(expected), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
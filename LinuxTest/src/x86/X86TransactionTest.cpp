@@ -0,0 +1,30 @@
+#include "stdafx.h"
+
+using namespace UnitTest;
+using namespace CppAsm;
+
+namespace UnitTest
+{
+	/* Test x86 transactional memory instructions encoding */
+	TEST_CLASS(X86TransactionTest)
+	{
+	private:
+		constexpr static Size CODE_BLOCK_SIZE = 64 * 1024;
+		typedef Linux::CodeBlock testCodeBlock;
+	public:
+		TEST_METHOD(TestRtmEncodingX86) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			X86::FwdLabel<X86::LONG> abort = X86::RTM::Xbegin(block);
+			X86::RTM::Xend(block);
+			Assert::IsTrue(abort.bind(block));
+			X86::RTM::Xabort(block, U8(0x01));
+			const uint8_t expected[] = {
+				0xC7, 0xF8, 0x03, 0x00, 0x00, 0x00,	// xbegin abort
+				0x0F, 0x01, 0xD5,					// xend
+				0xC6, 0xF8, 0x01					// abort: xabort 0x1
+			};
+			Assert::AreEqual(sizeof(expected), block.getSize());
+			Assert::AreBytesEqual(expected, block.getStartPtr(), sizeof(expected));
+		}
+	};
+}
\ No newline at end of file
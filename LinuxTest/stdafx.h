@@ -0,0 +1,55 @@
+#pragma once
+
+// Headers for test framework
+#include "test.h"
+#include "far_memory.h"
+
+#include <string>
+
+// Headers for CppAssembler
+#include "asm/arch/x64_i386.h"
+#include "asm/arch/x64_i486.h"
+#include "asm/arch/x64_CX16.h"
+#include "asm/arch/x64_SSE.h"
+#include "asm/arch/x64_SSE2.h"
+#include "asm/arch/x64_SSE4_1.h"
+#include "asm/arch/x64_BMI1.h"
+#include "asm/arch/x64_BMI2.h"
+#include "asm/arch/x64_LZCNT.h"
+#include "asm/arch/x64_POPCNT.h"
+#include "asm/arch/x64_SSE4_2.h"
+#include "asm/arch/x64_CRC32.h"
+#include "asm/arch/x64_AES.h"
+#include "asm/arch/x64_PCLMULQDQ.h"
+#include "asm/arch/x64_SHA.h"
+#include "asm/arch/x64_TSC.h"
+#include "asm/arch/x64_RDTSCP.h"
+#include "asm/arch/x64_RDPID.h"
+#include "asm/arch/x64_WAITPKG.h"
+#include "asm/arch/x64_RDRAND.h"
+#include "asm/arch/x64_RDSEED.h"
+#include "asm/arch/x64_FXSR.h"
+#include "asm/arch/x64_XSAVE.h"
+#include "asm/arch/x64_XSAVEC.h"
+#include "asm/arch/x64_XSAVEOPT.h"
+#include "asm/arch/x64_i387.h"
+#include "asm/arch/x64_CMOV.h"
+#include "asm/arch/x64_CLDEMOTE.h"
+#include "asm/arch/x64_CLFLUSHOPT.h"
+#include "asm/arch/x64_CLFSH.h"
+#include "asm/arch/x64_CLWB.h"
+#include "asm/arch/x64_PRFCHW.h"
+#include "asm/arch/x64_HLE.h"
+#include "asm/arch/x64_RTM.h"
+#include "asm/arch/x86_RTM.h"
+#include "asm/detour.h"
+#include "asm/inline_cache.h"
+#include "asm/instruction_buffer.h"
+#include "asm/jump_table.h"
+#include "asm/linker.h"
+#include "asm/literal_pool.h"
+#include "asm/relocation.h"
+#include "asm/os/linux.h"
+#include "asm/os/gdb_jit.h"
+#include "asm/os/perf.h"
+#include "asm/os/unwind.h"
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+
+/* Minimal test framework of Linux build with same test syntax as CppUnitTest of UnitTest project:
+ * TEST_CLASS(name) { TEST_METHOD(name) { Assert::AreEqual(expected, actual); } };
+ */
+namespace UnitTest
+{
+	typedef void (*TestFunction)();
+
+	struct TestCase {
+		const char* className;
+		const char* methodName;
+		TestFunction function;
+		TestCase* next;
+	};
+
+	/* Linked list of test methods registered by static initializers */
+	inline TestCase*& getTestCases() {
+		static TestCase* testCases = nullptr;
+		return testCases;
+	}
+
+	inline void registerTestCase(TestCase& testCase) {
+		TestCase** last = &getTestCases();
+		while (*last) {
+			last = &(*last)->next;
+		}
+		*last = &testCase;
+	}
+
+	/* Thrown by failed assertion, caught by test runner */
+	struct AssertFailed {
+		const char* message;
+	};
+
+	class Assert {
+	public:
+		template<class T1, class T2>
+		static void AreEqual(const T1& expected, const T2& actual, const char* message = "AreEqual") {
+			if (!(expected == actual)) {
+				throw AssertFailed{ message };
+			}
+		}
+
+		template<class T1, class T2>
+		static void AreNotEqual(const T1& expected, const T2& actual, const char* message = "AreNotEqual") {
+			if (expected == actual) {
+				throw AssertFailed{ message };
+			}
+		}
+
+		static void IsTrue(bool condition, const char* message = "IsTrue") {
+			if (!condition) {
+				throw AssertFailed{ message };
+			}
+		}
+
+		static void IsFalse(bool condition, const char* message = "IsFalse") {
+			if (condition) {
+				throw AssertFailed{ message };
+			}
+		}
+
+		template<class T>
+		static void IsNull(const T* ptr, const char* message = "IsNull") {
+			IsTrue(ptr == nullptr, message);
+		}
+
+		template<class T>
+		static void IsNotNull(const T* ptr, const char* message = "IsNotNull") {
+			IsTrue(ptr != nullptr, message);
+		}
+
+		/* Compare size bytes of code with expected encoding */
+		static void AreBytesEqual(const void* expected, const void* actual, size_t size, const char* message = "AreBytesEqual") {
+			IsTrue(std::memcmp(expected, actual, size) == 0, message);
+		}
+	};
+}
+
+#define TEST_CLASS(className) \
+	class className; \
+	struct className##_TestClassBase { \
+		typedef className TestClass; \
+		static const char* getTestClassName() { return #className; } \
+	}; \
+	class className : private className##_TestClassBase
+
+#define TEST_METHOD(methodName) \
+	static void methodName##_Run() { \
+		TestClass testObject; \
+		testObject.methodName(); \
+	} \
+	struct methodName##_Registrar { \
+		methodName##_Registrar() { \
+			static ::UnitTest::TestCase testCase = { getTestClassName(), #methodName, &methodName##_Run, nullptr }; \
+			::UnitTest::registerTestCase(testCase); \
+		} \
+	}; \
+	inline static methodName##_Registrar methodName##_registrar; \
+	public: void methodName()
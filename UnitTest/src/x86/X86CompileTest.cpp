@@ -17,6 +17,29 @@ namespace UnitTest
 		typedef X86::i586 testArch5;
 		typedef X86::i686 testArch6;
 		typedef X86::i387 testArchFpu;
+		typedef X86::POPCNT testArchPopcnt;
+		typedef X86::LZCNT testArchLzcnt;
+		typedef X86::BMI1 testArchBmi1;
+		typedef X86::BMI2 testArchBmi2;
+		typedef X86::CRC32 testArchCrc32;
+		typedef X86::AES testArchAes;
+		typedef X86::PCLMULQDQ testArchPclmulqdq;
+		typedef X86::SHA testArchSha;
+		typedef X86::RDTSCP testArchRdtscp;
+		typedef X86::RDPID testArchRdpid;
+		typedef X86::WAITPKG testArchWaitpkg;
+		typedef X86::RTM testArchRtm;
+		typedef X86::HLE testArchHle;
+		typedef X86::RDRAND testArchRdrand;
+		typedef X86::RDSEED testArchRdseed;
+		typedef X86::FXSR testArchFxsr;
+		typedef X86::XSAVE testArchXsave;
+		typedef X86::XSAVEOPT testArchXsaveopt;
+		typedef X86::XSAVEC testArchXsavec;
+		typedef X86::SSE testArchSse;
+		typedef X86::SSE2 testArchSse2;
+		typedef X86::SSE4_1 testArchSse41;
+		typedef X86::SSE4_2 testArchSse42;
 	public:
 		TEST_METHOD(TestNoParams) {
 			testCodeBlock block(CODE_BLOCK_SIZE);
@@ -54,6 +77,7 @@ namespace UnitTest
 			testArch::Movsw(block);
 			testArch::Movsd(block);
 			testArch::Nop(block);
+			testArch::Pause(block);
 			testArch::Outsb(block);
 			testArch::Outsw(block);
 			testArch::Outsd(block);
@@ -84,6 +108,11 @@ namespace UnitTest
 			testArch5::Rdmsr(block);
 			testArch5::Wrmsr(block);
 			testArch5::Rdtsc(block);
+			testArch5::LfenceRdtsc(block);
+			testArchRdtscp::Rdtscp(block);
+			testArchRtm::Xend(block);
+			testArchRtm::Xtest(block);
+			testArchXsave::Xgetbv(block);
 			testArch6::Rdpmc(block);
 			testArch6::Ud2(block);
 		}
@@ -1033,6 +1062,1136 @@ namespace UnitTest
 			testArch::Bsr(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
 		}
 
+		TEST_METHOD(TestPopcnt) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// POPCNT r16, r/m16
+			testArchPopcnt::Popcnt(block, X86::DX, X86::CX);
+			testArchPopcnt::Popcnt(block, X86::DX, X86::Mem32<X86::BASE>(X86::EDX));
+			// POPCNT r32, r/m32
+			testArchPopcnt::Popcnt(block, X86::EDX, X86::ECX);
+			testArchPopcnt::Popcnt(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestLzcnt) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// LZCNT r16, r/m16
+			testArchLzcnt::Lzcnt(block, X86::DX, X86::CX);
+			testArchLzcnt::Lzcnt(block, X86::DX, X86::Mem32<X86::BASE>(X86::EDX));
+			// LZCNT r32, r/m32
+			testArchLzcnt::Lzcnt(block, X86::EDX, X86::ECX);
+			testArchLzcnt::Lzcnt(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestTzcnt) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// TZCNT r16, r/m16
+			testArchBmi1::Tzcnt(block, X86::DX, X86::CX);
+			testArchBmi1::Tzcnt(block, X86::DX, X86::Mem32<X86::BASE>(X86::EDX));
+			// TZCNT r32, r/m32
+			testArchBmi1::Tzcnt(block, X86::EDX, X86::ECX);
+			testArchBmi1::Tzcnt(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAndn) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ANDN r32a, r32b, r/m32
+			testArchBmi1::Andn(block, X86::EDX, X86::EBX, X86::ECX);
+			testArchBmi1::Andn(block, X86::EDX, X86::EBX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBextr) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BEXTR r32a, r/m32, r32b
+			testArchBmi1::Bextr(block, X86::EDX, X86::ECX, X86::EBX);
+			testArchBmi1::Bextr(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), X86::EBX);
+		}
+
+		TEST_METHOD(TestBlsi) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLSI r32, r/m32
+			testArchBmi1::Blsi(block, X86::EDX, X86::ECX);
+			testArchBmi1::Blsi(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBlsmsk) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLSMSK r32, r/m32
+			testArchBmi1::Blsmsk(block, X86::EDX, X86::ECX);
+			testArchBmi1::Blsmsk(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBlsr) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLSR r32, r/m32
+			testArchBmi1::Blsr(block, X86::EDX, X86::ECX);
+			testArchBmi1::Blsr(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBzhi) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BZHI r32a, r/m32, r32b
+			testArchBmi2::Bzhi(block, X86::EDX, X86::ECX, X86::EBX);
+			testArchBmi2::Bzhi(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), X86::EBX);
+		}
+
+		TEST_METHOD(TestMulx) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MULX r32a, r32b, r/m32
+			testArchBmi2::Mulx(block, X86::EDX, X86::EBX, X86::ECX);
+			testArchBmi2::Mulx(block, X86::EDX, X86::EBX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPdep) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PDEP r32a, r32b, r/m32
+			testArchBmi2::Pdep(block, X86::EDX, X86::EBX, X86::ECX);
+			testArchBmi2::Pdep(block, X86::EDX, X86::EBX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPext) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PEXT r32a, r32b, r/m32
+			testArchBmi2::Pext(block, X86::EDX, X86::EBX, X86::ECX);
+			testArchBmi2::Pext(block, X86::EDX, X86::EBX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestRorx) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// RORX r32, r/m32, imm8
+			testArchBmi2::Rorx(block, X86::EDX, X86::ECX, U8(5));
+			testArchBmi2::Rorx(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), U8(5));
+		}
+
+		TEST_METHOD(TestSarx) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SARX r32a, r/m32, r32b
+			testArchBmi2::Sarx(block, X86::EDX, X86::ECX, X86::EBX);
+			testArchBmi2::Sarx(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), X86::EBX);
+		}
+
+		TEST_METHOD(TestShlx) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHLX r32a, r/m32, r32b
+			testArchBmi2::Shlx(block, X86::EDX, X86::ECX, X86::EBX);
+			testArchBmi2::Shlx(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), X86::EBX);
+		}
+
+		TEST_METHOD(TestShrx) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHRX r32a, r/m32, r32b
+			testArchBmi2::Shrx(block, X86::EDX, X86::ECX, X86::EBX);
+			testArchBmi2::Shrx(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX), X86::EBX);
+		}
+
+		TEST_METHOD(TestRdpid) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// RDPID r32
+			testArchRdpid::Rdpid(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestUmonitor) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// UMONITOR r32
+			testArchWaitpkg::Umonitor(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestUmwait) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// UMWAIT r32
+			testArchWaitpkg::Umwait(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestTpause) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// TPAUSE r32
+			testArchWaitpkg::Tpause(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestXbegin) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XBEGIN rel32
+			testArchRtm::Xbegin(block).bind(block);
+		}
+
+		TEST_METHOD(TestXabort) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XABORT imm8
+			testArchRtm::Xabort(block, U8(0xFF));
+		}
+
+		TEST_METHOD(TestHle) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XACQUIRE LOCK XADD m32, r32
+			testArchHle::Xacquire(block);
+			testArch4::Xadd<X86::LOCK>(block, X86::Mem32<X86::BASE>(X86::EDX), X86::EAX);
+			// XRELEASE MOV m32, r32
+			testArchHle::Xrelease(block);
+			testArch::Mov(block, X86::Mem32<X86::BASE>(X86::EDX), X86::EAX);
+		}
+
+		TEST_METHOD(TestRdrand) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// RDRAND r16
+			testArchRdrand::Rdrand(block, X86::DX);
+			// RDRAND r32
+			testArchRdrand::Rdrand(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestRdseed) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// RDSEED r16
+			testArchRdseed::Rdseed(block, X86::DX);
+			// RDSEED r32
+			testArchRdseed::Rdseed(block, X86::EDX);
+		}
+
+		TEST_METHOD(TestFxsave) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// FXSAVE mem
+			testArchFxsr::Fxsave(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestFxrstor) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// FXRSTOR mem
+			testArchFxsr::Fxrstor(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXsave) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XSAVE mem
+			testArchXsave::Xsave(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXrstor) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XRSTOR mem
+			testArchXsave::Xrstor(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXsaveopt) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XSAVEOPT mem
+			testArchXsaveopt::Xsaveopt(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXsavec) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XSAVEC mem
+			testArchXsavec::Xsavec(block, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCrc32) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CRC32 r32, r/m8
+			testArchCrc32::Crc32(block, X86::EDX, X86::CL);
+			testArchCrc32::Crc32<X86::BYTE_PTR>(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CRC32 r32, r/m16
+			testArchCrc32::Crc32(block, X86::EDX, X86::CX);
+			testArchCrc32::Crc32<X86::WORD_PTR>(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CRC32 r32, r/m32
+			testArchCrc32::Crc32(block, X86::EDX, X86::ECX);
+			testArchCrc32::Crc32<X86::DWORD_PTR>(block, X86::EDX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAesenc) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESENC xmm1, xmm2/m128
+			testArchAes::Aesenc(block, X86::XMM1, X86::XMM2);
+			testArchAes::Aesenc(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAesenclast) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESENCLAST xmm1, xmm2/m128
+			testArchAes::Aesenclast(block, X86::XMM1, X86::XMM2);
+			testArchAes::Aesenclast(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAesdec) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESDEC xmm1, xmm2/m128
+			testArchAes::Aesdec(block, X86::XMM1, X86::XMM2);
+			testArchAes::Aesdec(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAesdeclast) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESDECLAST xmm1, xmm2/m128
+			testArchAes::Aesdeclast(block, X86::XMM1, X86::XMM2);
+			testArchAes::Aesdeclast(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAesimc) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESIMC xmm1, xmm2/m128
+			testArchAes::Aesimc(block, X86::XMM1, X86::XMM2);
+			testArchAes::Aesimc(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAeskeygenassist) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// AESKEYGENASSIST xmm1, xmm2/m128, imm8
+			testArchAes::Aeskeygenassist(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchAes::Aeskeygenassist(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPclmulqdq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCLMULQDQ xmm1, xmm2/m128, imm8
+			testArchPclmulqdq::Pclmulqdq(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchPclmulqdq::Pclmulqdq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestSha1rnds4) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA1RNDS4 xmm1, xmm2/m128, imm8
+			testArchSha::Sha1rnds4(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSha::Sha1rnds4(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestSha1nexte) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA1NEXTE xmm1, xmm2/m128
+			testArchSha::Sha1nexte(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha1nexte(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSha1msg1) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA1MSG1 xmm1, xmm2/m128
+			testArchSha::Sha1msg1(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha1msg1(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSha1msg2) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA1MSG2 xmm1, xmm2/m128
+			testArchSha::Sha1msg2(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha1msg2(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSha256rnds2) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA256RNDS2 xmm1, xmm2/m128
+			testArchSha::Sha256rnds2(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha256rnds2(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSha256msg1) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA256MSG1 xmm1, xmm2/m128
+			testArchSha::Sha256msg1(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha256msg1(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSha256msg2) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SHA256MSG2 xmm1, xmm2/m128
+			testArchSha::Sha256msg2(block, X86::XMM1, X86::XMM2);
+			testArchSha::Sha256msg2(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMovss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVSS xmm1, xmm2/m32
+			testArchSse::Movss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Movss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVSS m32, xmm1
+			testArchSse::Movss(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovaps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVAPS xmm1, xmm2/m128
+			testArchSse::Movaps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Movaps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVAPS m128, xmm1
+			testArchSse::Movaps(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovups) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVUPS xmm1, xmm2/m128
+			testArchSse::Movups(block, X86::XMM1, X86::XMM2);
+			testArchSse::Movups(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVUPS m128, xmm1
+			testArchSse::Movups(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestAddss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ADDSS xmm1, xmm2/m32
+			testArchSse::Addss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Addss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAddps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ADDPS xmm1, xmm2/m128
+			testArchSse::Addps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Addps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSubss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SUBSS xmm1, xmm2/m32
+			testArchSse::Subss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Subss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSubps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SUBPS xmm1, xmm2/m128
+			testArchSse::Subps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Subps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMulss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MULSS xmm1, xmm2/m32
+			testArchSse::Mulss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Mulss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMulps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MULPS xmm1, xmm2/m128
+			testArchSse::Mulps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Mulps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestDivss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DIVSS xmm1, xmm2/m32
+			testArchSse::Divss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Divss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestDivps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DIVPS xmm1, xmm2/m128
+			testArchSse::Divps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Divps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSqrtss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SQRTSS xmm1, xmm2/m32
+			testArchSse::Sqrtss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Sqrtss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSqrtps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SQRTPS xmm1, xmm2/m128
+			testArchSse::Sqrtps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Sqrtps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMinss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MINSS xmm1, xmm2/m32
+			testArchSse::Minss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Minss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMinps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MINPS xmm1, xmm2/m128
+			testArchSse::Minps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Minps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMaxss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MAXSS xmm1, xmm2/m32
+			testArchSse::Maxss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Maxss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMaxps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MAXPS xmm1, xmm2/m128
+			testArchSse::Maxps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Maxps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAndps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ANDPS xmm1, xmm2/m128
+			testArchSse::Andps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Andps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAndnps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ANDNPS xmm1, xmm2/m128
+			testArchSse::Andnps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Andnps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestOrps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ORPS xmm1, xmm2/m128
+			testArchSse::Orps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Orps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXorps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XORPS xmm1, xmm2/m128
+			testArchSse::Xorps(block, X86::XMM1, X86::XMM2);
+			testArchSse::Xorps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCmpss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CMPSS xmm1, xmm2/m32, imm8
+			testArchSse::Cmpss(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse::Cmpss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestCmpps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CMPPS xmm1, xmm2/m128, imm8
+			testArchSse::Cmpps(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse::Cmpps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestUcomiss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// UCOMISS xmm1, xmm2/m32
+			testArchSse::Ucomiss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Ucomiss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestComiss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// COMISS xmm1, xmm2/m32
+			testArchSse::Comiss(block, X86::XMM1, X86::XMM2);
+			testArchSse::Comiss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtsi2ss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSI2SS xmm1, r/m32
+			testArchSse::Cvtsi2ss(block, X86::XMM1, X86::EAX);
+			testArchSse::Cvtsi2ss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtss2si) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSS2SI r32, xmm1/m32
+			testArchSse::Cvtss2si(block, X86::EAX, X86::XMM1);
+			testArchSse::Cvtss2si(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvttss2si) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTTSS2SI r32, xmm1/m32
+			testArchSse::Cvttss2si(block, X86::EAX, X86::XMM1);
+			testArchSse::Cvttss2si(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMovsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVSD xmm1, xmm2/m64
+			testArchSse2::Movsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Movsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVSD m64, xmm1
+			testArchSse2::Movsd(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovapd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVAPD xmm1, xmm2/m128
+			testArchSse2::Movapd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Movapd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVAPD m128, xmm1
+			testArchSse2::Movapd(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovupd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVUPD xmm1, xmm2/m128
+			testArchSse2::Movupd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Movupd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVUPD m128, xmm1
+			testArchSse2::Movupd(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVD xmm, r/m32
+			testArchSse2::Movd(block, X86::XMM1, X86::EAX);
+			testArchSse2::Movd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVD r/m32, xmm
+			testArchSse2::Movd(block, X86::EAX, X86::XMM1);
+			testArchSse2::Movd(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestMovq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVQ xmm1, xmm2/m64
+			testArchSse2::Movq(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Movq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+			// MOVQ m64, xmm1
+			testArchSse2::Movq(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1);
+		}
+
+		TEST_METHOD(TestAddsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ADDSD xmm1, xmm2/m64
+			testArchSse2::Addsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Addsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAddpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ADDPD xmm1, xmm2/m128
+			testArchSse2::Addpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Addpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSubsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SUBSD xmm1, xmm2/m64
+			testArchSse2::Subsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Subsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSubpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SUBPD xmm1, xmm2/m128
+			testArchSse2::Subpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Subpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMulsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MULSD xmm1, xmm2/m64
+			testArchSse2::Mulsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Mulsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMulpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MULPD xmm1, xmm2/m128
+			testArchSse2::Mulpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Mulpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestDivsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DIVSD xmm1, xmm2/m64
+			testArchSse2::Divsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Divsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestDivpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DIVPD xmm1, xmm2/m128
+			testArchSse2::Divpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Divpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSqrtsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SQRTSD xmm1, xmm2/m64
+			testArchSse2::Sqrtsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Sqrtsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestSqrtpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// SQRTPD xmm1, xmm2/m128
+			testArchSse2::Sqrtpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Sqrtpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMinsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MINSD xmm1, xmm2/m64
+			testArchSse2::Minsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Minsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMinpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MINPD xmm1, xmm2/m128
+			testArchSse2::Minpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Minpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMaxsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MAXSD xmm1, xmm2/m64
+			testArchSse2::Maxsd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Maxsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMaxpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MAXPD xmm1, xmm2/m128
+			testArchSse2::Maxpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Maxpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAndpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ANDPD xmm1, xmm2/m128
+			testArchSse2::Andpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Andpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestAndnpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ANDNPD xmm1, xmm2/m128
+			testArchSse2::Andnpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Andnpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestOrpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ORPD xmm1, xmm2/m128
+			testArchSse2::Orpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Orpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestXorpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// XORPD xmm1, xmm2/m128
+			testArchSse2::Xorpd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Xorpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCmpsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CMPSD xmm1, xmm2/m64, imm8
+			testArchSse2::Cmpsd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse2::Cmpsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestCmppd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CMPPD xmm1, xmm2/m128, imm8
+			testArchSse2::Cmppd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse2::Cmppd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestUcomisd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// UCOMISD xmm1, xmm2/m64
+			testArchSse2::Ucomisd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Ucomisd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestComisd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// COMISD xmm1, xmm2/m64
+			testArchSse2::Comisd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Comisd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtsi2sd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSI2SD xmm1, r/m32
+			testArchSse2::Cvtsi2sd(block, X86::XMM1, X86::EAX);
+			testArchSse2::Cvtsi2sd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtsd2si) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSD2SI r32, xmm1/m64
+			testArchSse2::Cvtsd2si(block, X86::EAX, X86::XMM1);
+			testArchSse2::Cvtsd2si(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvttsd2si) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTTSD2SI r32, xmm1/m64
+			testArchSse2::Cvttsd2si(block, X86::EAX, X86::XMM1);
+			testArchSse2::Cvttsd2si(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtss2sd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSS2SD xmm1, xmm2/m32
+			testArchSse2::Cvtss2sd(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Cvtss2sd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestCvtsd2ss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CVTSD2SS xmm1, xmm2/m64
+			testArchSse2::Cvtsd2ss(block, X86::XMM1, X86::XMM2);
+			testArchSse2::Cvtsd2ss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPtest) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PTEST xmm1, xmm2/m128
+			testArchSse41::Ptest(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Ptest(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPblendvb) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PBLENDVB xmm1, xmm2/m128
+			testArchSse41::Pblendvb(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pblendvb(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBlendvps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLENDVPS xmm1, xmm2/m128
+			testArchSse41::Blendvps(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Blendvps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestBlendvpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLENDVPD xmm1, xmm2/m128
+			testArchSse41::Blendvpd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Blendvpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPblendw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PBLENDW xmm1, xmm2/m128, imm8
+			testArchSse41::Pblendw(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Pblendw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestBlendps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLENDPS xmm1, xmm2/m128, imm8
+			testArchSse41::Blendps(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Blendps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestBlendpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// BLENDPD xmm1, xmm2/m128, imm8
+			testArchSse41::Blendpd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Blendpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPmovsxbw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXBW xmm1, xmm2/m128
+			testArchSse41::Pmovsxbw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxbw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovsxbd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXBD xmm1, xmm2/m128
+			testArchSse41::Pmovsxbd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxbd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovsxbq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXBQ xmm1, xmm2/m128
+			testArchSse41::Pmovsxbq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxbq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovsxwd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXWD xmm1, xmm2/m128
+			testArchSse41::Pmovsxwd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxwd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovsxwq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXWQ xmm1, xmm2/m128
+			testArchSse41::Pmovsxwq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxwq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovsxdq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVSXDQ xmm1, xmm2/m128
+			testArchSse41::Pmovsxdq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovsxdq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxbw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXBW xmm1, xmm2/m128
+			testArchSse41::Pmovzxbw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxbw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxbd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXBD xmm1, xmm2/m128
+			testArchSse41::Pmovzxbd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxbd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxbq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXBQ xmm1, xmm2/m128
+			testArchSse41::Pmovzxbq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxbq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxwd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXWD xmm1, xmm2/m128
+			testArchSse41::Pmovzxwd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxwd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxwq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXWQ xmm1, xmm2/m128
+			testArchSse41::Pmovzxwq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxwq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmovzxdq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMOVZXDQ xmm1, xmm2/m128
+			testArchSse41::Pmovzxdq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmovzxdq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPminsb) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMINSB xmm1, xmm2/m128
+			testArchSse41::Pminsb(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pminsb(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPminsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMINSD xmm1, xmm2/m128
+			testArchSse41::Pminsd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pminsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPminuw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMINUW xmm1, xmm2/m128
+			testArchSse41::Pminuw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pminuw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPminud) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMINUD xmm1, xmm2/m128
+			testArchSse41::Pminud(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pminud(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmaxsb) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMAXSB xmm1, xmm2/m128
+			testArchSse41::Pmaxsb(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmaxsb(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmaxsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMAXSD xmm1, xmm2/m128
+			testArchSse41::Pmaxsd(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmaxsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmaxuw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMAXUW xmm1, xmm2/m128
+			testArchSse41::Pmaxuw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmaxuw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmaxud) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMAXUD xmm1, xmm2/m128
+			testArchSse41::Pmaxud(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmaxud(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmulld) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMULLD xmm1, xmm2/m128
+			testArchSse41::Pmulld(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmulld(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPmuldq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PMULDQ xmm1, xmm2/m128
+			testArchSse41::Pmuldq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pmuldq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPcmpeqq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPEQQ xmm1, xmm2/m128
+			testArchSse41::Pcmpeqq(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Pcmpeqq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPackusdw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PACKUSDW xmm1, xmm2/m128
+			testArchSse41::Packusdw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Packusdw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestPhminposuw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PHMINPOSUW xmm1, xmm2/m128
+			testArchSse41::Phminposuw(block, X86::XMM1, X86::XMM2);
+			testArchSse41::Phminposuw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestMovntdqa) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MOVNTDQA xmm1, m128
+			testArchSse41::Movntdqa(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestRoundps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ROUNDPS xmm1, xmm2/m128, imm8
+			testArchSse41::Roundps(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Roundps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestRoundpd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ROUNDPD xmm1, xmm2/m128, imm8
+			testArchSse41::Roundpd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Roundpd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestRoundss) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ROUNDSS xmm1, xmm2/m128, imm8
+			testArchSse41::Roundss(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Roundss(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestRoundsd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// ROUNDSD xmm1, xmm2/m128, imm8
+			testArchSse41::Roundsd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Roundsd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestDpps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DPPS xmm1, xmm2/m128, imm8
+			testArchSse41::Dpps(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Dpps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestDppd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// DPPD xmm1, xmm2/m128, imm8
+			testArchSse41::Dppd(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Dppd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestMpsadbw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// MPSADBW xmm1, xmm2/m128, imm8
+			testArchSse41::Mpsadbw(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Mpsadbw(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestInsertps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// INSERTPS xmm1, xmm2/m128, imm8
+			testArchSse41::Insertps(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse41::Insertps(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPinsrb) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PINSRB xmm1, r32/m8, imm8
+			testArchSse41::Pinsrb(block, X86::XMM1, X86::EDX, U8(1));
+			testArchSse41::Pinsrb(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPinsrd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PINSRD xmm1, r32/m32, imm8
+			testArchSse41::Pinsrd(block, X86::XMM1, X86::EDX, U8(1));
+			testArchSse41::Pinsrd(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPextrb) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PEXTRB r32/m8, xmm1, imm8
+			testArchSse41::Pextrb(block, X86::EDX, X86::XMM1, U8(1));
+			testArchSse41::Pextrb(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1, U8(1));
+		}
+
+		TEST_METHOD(TestPextrw) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PEXTRW r32/m16, xmm1, imm8
+			testArchSse41::Pextrw(block, X86::EDX, X86::XMM1, U8(1));
+			testArchSse41::Pextrw(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1, U8(1));
+		}
+
+		TEST_METHOD(TestPextrd) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PEXTRD r32/m32, xmm1, imm8
+			testArchSse41::Pextrd(block, X86::EDX, X86::XMM1, U8(1));
+			testArchSse41::Pextrd(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1, U8(1));
+		}
+
+		TEST_METHOD(TestExtractps) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// EXTRACTPS r32/m32, xmm1, imm8
+			testArchSse41::Extractps(block, X86::EDX, X86::XMM1, U8(1));
+			testArchSse41::Extractps(block, X86::Mem32<X86::BASE>(X86::EDX), X86::XMM1, U8(1));
+		}
+
+		TEST_METHOD(TestPcmpestri) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPESTRI xmm1, xmm2/m128, imm8
+			testArchSse42::Pcmpestri(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse42::Pcmpestri(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPcmpestrm) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPESTRM xmm1, xmm2/m128, imm8
+			testArchSse42::Pcmpestrm(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse42::Pcmpestrm(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPcmpistri) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPISTRI xmm1, xmm2/m128, imm8
+			testArchSse42::Pcmpistri(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse42::Pcmpistri(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPcmpistrm) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPISTRM xmm1, xmm2/m128, imm8
+			testArchSse42::Pcmpistrm(block, X86::XMM1, X86::XMM2, U8(1));
+			testArchSse42::Pcmpistrm(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX), U8(1));
+		}
+
+		TEST_METHOD(TestPcmpgtq) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// PCMPGTQ xmm1, xmm2/m128
+			testArchSse42::Pcmpgtq(block, X86::XMM1, X86::XMM2);
+			testArchSse42::Pcmpgtq(block, X86::XMM1, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
 		TEST_METHOD(TestBtc) {
 			testCodeBlock block(CODE_BLOCK_SIZE);
 			// BTC r/m16, r16
@@ -1456,6 +2615,123 @@ namespace UnitTest
 			testArch::Setz(block, X86::AL);
 			testArch::Setz(block, X86::Mem32<X86::BASE>(X86::EDX));
 		}
+
+		TEST_METHOD(TestCmovcc) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// CMOVA r16, r/m16
+			testArch6::Cmova(block, X86::AX, X86::DX);
+			testArch6::Cmova(block, X86::AX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVA r32, r/m32
+			testArch6::Cmova(block, X86::EAX, X86::EDX);
+			testArch6::Cmova(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVAE r32, r/m32
+			testArch6::Cmovae(block, X86::EAX, X86::EDX);
+			testArch6::Cmovae(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVB r32, r/m32
+			testArch6::Cmovb(block, X86::EAX, X86::EDX);
+			testArch6::Cmovb(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVBE r32, r/m32
+			testArch6::Cmovbe(block, X86::EAX, X86::EDX);
+			testArch6::Cmovbe(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVC r32, r/m32
+			testArch6::Cmovc(block, X86::EAX, X86::EDX);
+			testArch6::Cmovc(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVE r32, r/m32
+			testArch6::Cmove(block, X86::EAX, X86::EDX);
+			testArch6::Cmove(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVG r32, r/m32
+			testArch6::Cmovg(block, X86::EAX, X86::EDX);
+			testArch6::Cmovg(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVGE r32, r/m32
+			testArch6::Cmovge(block, X86::EAX, X86::EDX);
+			testArch6::Cmovge(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVL r32, r/m32
+			testArch6::Cmovl(block, X86::EAX, X86::EDX);
+			testArch6::Cmovl(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVLE r32, r/m32
+			testArch6::Cmovle(block, X86::EAX, X86::EDX);
+			testArch6::Cmovle(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNA r32, r/m32
+			testArch6::Cmovna(block, X86::EAX, X86::EDX);
+			testArch6::Cmovna(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNAE r32, r/m32
+			testArch6::Cmovnae(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnae(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNB r32, r/m32
+			testArch6::Cmovnb(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnb(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNBE r32, r/m32
+			testArch6::Cmovnbe(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnbe(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNC r32, r/m32
+			testArch6::Cmovnc(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnc(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNE r32, r/m32
+			testArch6::Cmovne(block, X86::EAX, X86::EDX);
+			testArch6::Cmovne(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNG r32, r/m32
+			testArch6::Cmovng(block, X86::EAX, X86::EDX);
+			testArch6::Cmovng(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNGE r32, r/m32
+			testArch6::Cmovnge(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnge(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNL r32, r/m32
+			testArch6::Cmovnl(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnl(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNLE r32, r/m32
+			testArch6::Cmovnle(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnle(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNO r32, r/m32
+			testArch6::Cmovno(block, X86::EAX, X86::EDX);
+			testArch6::Cmovno(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNP r32, r/m32
+			testArch6::Cmovnp(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnp(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNS r32, r/m32
+			testArch6::Cmovns(block, X86::EAX, X86::EDX);
+			testArch6::Cmovns(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVNZ r32, r/m32
+			testArch6::Cmovnz(block, X86::EAX, X86::EDX);
+			testArch6::Cmovnz(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVO r32, r/m32
+			testArch6::Cmovo(block, X86::EAX, X86::EDX);
+			testArch6::Cmovo(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVP r32, r/m32
+			testArch6::Cmovp(block, X86::EAX, X86::EDX);
+			testArch6::Cmovp(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVPE r32, r/m32
+			testArch6::Cmovpe(block, X86::EAX, X86::EDX);
+			testArch6::Cmovpe(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVPO r32, r/m32
+			testArch6::Cmovpo(block, X86::EAX, X86::EDX);
+			testArch6::Cmovpo(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVS r32, r/m32
+			testArch6::Cmovs(block, X86::EAX, X86::EDX);
+			testArch6::Cmovs(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+			// CMOVZ r32, r/m32
+			testArch6::Cmovz(block, X86::EAX, X86::EDX);
+			testArch6::Cmovz(block, X86::EAX, X86::Mem32<X86::BASE>(X86::EDX));
+		}
+
+		TEST_METHOD(TestFcmovcc) {
+			testCodeBlock block(CODE_BLOCK_SIZE);
+			// FCMOVB ST(0), ST(i)
+			testArch6::Fcmovb(block, X86::ST, X86::ST1);
+			// FCMOVBE ST(0), ST(i)
+			testArch6::Fcmovbe(block, X86::ST, X86::ST1);
+			// FCMOVE ST(0), ST(i)
+			testArch6::Fcmove(block, X86::ST, X86::ST1);
+			// FCMOVNB ST(0), ST(i)
+			testArch6::Fcmovnb(block, X86::ST, X86::ST1);
+			// FCMOVNBE ST(0), ST(i)
+			testArch6::Fcmovnbe(block, X86::ST, X86::ST1);
+			// FCMOVNE ST(0), ST(i)
+			testArch6::Fcmovne(block, X86::ST, X86::ST1);
+			// FCMOVNU ST(0), ST(i)
+			testArch6::Fcmovnu(block, X86::ST, X86::ST1);
+			// FCMOVU ST(0), ST(i)
+			testArch6::Fcmovu(block, X86::ST, X86::ST1);
+		}
 	
 		TEST_METHOD(TestLcS) {
 			testCodeBlock block(CODE_BLOCK_SIZE);
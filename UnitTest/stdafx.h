@@ -12,5 +12,37 @@
 
 // Headers for CppAssembler
 #include "asm\arch\x86_i686.h"
+#include "asm\arch\x86_POPCNT.h"
+#include "asm\arch\x86_LZCNT.h"
+#include "asm\arch\x86_BMI1.h"
+#include "asm\arch\x86_BMI2.h"
+#include "asm\arch\x86_CRC32.h"
+#include "asm\arch\x86_AES.h"
+#include "asm\arch\x86_PCLMULQDQ.h"
+#include "asm\arch\x86_SHA.h"
+#include "asm\arch\x86_RDTSCP.h"
+#include "asm\arch\x86_RDPID.h"
+#include "asm\arch\x86_WAITPKG.h"
+#include "asm\arch\x86_RTM.h"
+#include "asm\arch\x86_HLE.h"
+#include "asm\arch\x86_RDRAND.h"
+#include "asm\arch\x86_RDSEED.h"
+#include "asm\arch\x86_FXSR.h"
+#include "asm\arch\x86_XSAVE.h"
+#include "asm\arch\x86_XSAVEOPT.h"
+#include "asm\arch\x86_XSAVEC.h"
+#include "asm\arch\x86_SSE.h"
+#include "asm\arch\x86_SSE2.h"
+#include "asm\arch\x86_SSE4_1.h"
+#include "asm\arch\x86_SSE4_2.h"
 #include "asm\os\win32.h"
+#include "asm\listing.h"
+#include "asm\literal_pool.h"
+#include "asm\jump_table.h"
+#include "asm\relocation.h"
+#include "asm\linker.h"
+#include "asm\inline_cache.h"
+#include "asm\detour.h"
+#include "asm\instruction_buffer.h"
+#include "asm\stamp.h"
 
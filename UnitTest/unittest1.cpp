@@ -236,5 +236,225 @@ namespace UnitTest
 			block.execute();
 			Assert::AreEqual(block.input_regs.edx << 1, block.output_regs.edx);
 		}
+
+		TEST_METHOD(TestLiteralPool) {
+			Os::LiteralPool<64> pool;
+			TestInstructionCodeBlock block;
+			{
+				TestInstructionFunctionGen funcGen(block);
+				testArch::Mov(block, X86::EDX, X86::Mem32<X86::OFFSET>(pool.getLiteral(uint32_t(0x12345678))));
+				testArch::Add(block, X86::EDX, X86::Mem32<X86::OFFSET>(pool.getLiteral(uint32_t(0x12345678))));
+			}
+			block.execute();
+			Assert::AreEqual(Size(sizeof(uint32_t)), pool.getSize());
+			Assert::AreEqual(uint32_t(0x2468ACF0), block.output_regs.edx);
+		}
+
+		TEST_METHOD(TestJumpTable) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			X86::JumpTable<3> table;
+			table.reserve(block);
+			Addr functionAddr = block.getCurrentPtr();
+			testArch::Mov(block, X86::ECX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			X86::FwdLabel<X86::LONG> defaultLabel = table.dispatch(block, X86::ECX);
+			for (Size i = 0; i < 3; i++) {
+				table.bind(block, i);
+				testArch::Mov(block, X86::EAX, U32(static_cast<uint32_t>(10 + i)));
+				testArch::Ret(block);
+			}
+			defaultLabel.bind(block);
+			testArch::Mov(block, X86::EAX, U32(0));
+			testArch::Ret(block);
+			Assert::AreEqual(uint32_t(11), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 1));
+			Assert::AreEqual(uint32_t(12), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 2));
+			Assert::AreEqual(uint32_t(0), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 3));
+		}
+
+		TEST_METHOD(TestRelocation) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Win32::CodeBlock movedBlock(CODE_BLOCK_SIZE);
+			Os::RelocationTable<8> relocations;
+			X86::JumpTable<2> table;
+			table.reserve(block);
+			Offset functionOffset = block.getOffset();
+			testArch::Mov(block, X86::ECX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			table.dispatchUnchecked(block, X86::ECX);
+			relocations.addLast(block, Os::RELOC_ABS32);
+			for (Size i = 0; i < 2; i++) {
+				table.bind(block, i);
+				testArch::Mov(block, X86::EAX, U32(static_cast<uint32_t>(20 + i)));
+				testArch::Ret(block);
+			}
+			Assert::IsTrue(table.addRelocations(relocations));
+			Assert::AreEqual(Size(3), relocations.getCount());
+			Assert::IsTrue(relocations.relocateTo(block, movedBlock));
+			block.reset();
+			Addr functionAddr = movedBlock.getStartPtr() + functionOffset;
+			Assert::AreEqual(uint32_t(20), movedBlock.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 0));
+			Assert::AreEqual(uint32_t(21), movedBlock.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 1));
+		}
+
+		TEST_METHOD(TestLinker) {
+			enum { FUNC_CALLER, FUNC_CALLEE };
+			Win32::CodeBlock callerBlock(CODE_BLOCK_SIZE);
+			Win32::CodeBlock calleeBlock(CODE_BLOCK_SIZE);
+			Os::Linker<Win32::CodeBlock, 2, 2> linker;
+			linker.define(FUNC_CALLER, callerBlock);
+			Assert::IsTrue(linker.addFixup(callerBlock, testArch::Call(callerBlock), FUNC_CALLEE));
+			testArch::Add(callerBlock, X86::EAX, U32(1));
+			testArch::Ret(callerBlock);
+			Assert::IsFalse(linker.link());
+			linker.define(FUNC_CALLEE, calleeBlock);
+			testArch::Mov(calleeBlock, X86::EAX, U32(41));
+			testArch::Ret(calleeBlock);
+			Assert::IsTrue(linker.link());
+			Assert::AreEqual(uint32_t(42), callerBlock.invoke<Win32::CC_CDECL, uint32_t>());
+		}
+
+		TEST_METHOD(TestHotPatch) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Os::alignPatchable(block, 6);
+			Offset movOffset = block.getOffset();
+			testArch::Mov(block, X86::EAX, U32(1));
+			testArch::Ret(block);
+			ReplaceableValue<uint32_t> value(movOffset + 2);
+			Addr functionAddr = block.getStartPtr() + movOffset;
+			Assert::IsTrue(value.replaceAtomic(block, uint32_t(2)));
+			Assert::AreEqual(uint32_t(2), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr));
+			uint32_t newValue = 3;
+			Assert::IsTrue(block.patchInstruction(movOffset, 6, movOffset + 2, &newValue, sizeof(newValue)));
+			Assert::AreEqual(uint32_t(3), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr));
+		}
+
+		TEST_METHOD(TestInlineCache) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Addr missAddr = block.getCurrentPtr();
+			testArch::Mov(block, X86::EAX, U32(0));
+			testArch::Ret(block);
+			Addr handlerAddr = block.getCurrentPtr();
+			testArch::Mov(block, X86::EAX, U32(100));
+			testArch::Ret(block);
+			Addr functionAddr = block.getCurrentPtr();
+			X86::InlineCache<1> cache;
+			testArch::Mov(block, X86::ECX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			cache.emit(block, X86::ECX, missAddr);
+			Assert::AreEqual(uint32_t(0), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 5));
+			Assert::IsTrue(cache.add(block, 5, handlerAddr));
+			Assert::IsFalse(cache.add(block, 6, handlerAddr));
+			Assert::AreEqual(uint32_t(100), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 5));
+			Assert::AreEqual(uint32_t(0), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr, 6));
+		}
+
+		TEST_METHOD(TestDetour) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Win32::CodeBlock trampolineBlock(CODE_BLOCK_SIZE);
+			Os::alignPatchable(block, sizeof(uint64_t));
+			Addr targetAddr = block.getCurrentPtr();
+			testArch::Mov(block, X86::EAX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			testArch::Add(block, X86::EAX, U32(1));
+			testArch::Ret(block);
+			Addr hookAddr = block.getCurrentPtr();
+			testArch::Mov(block, X86::EAX, U32(100));
+			testArch::Ret(block);
+			X86::Detour detour;
+			Assert::IsTrue(detour.install(trampolineBlock, const_cast<uint8_t*>(targetAddr), hookAddr));
+			Assert::AreEqual(uint32_t(100), block.invokeAddr<Win32::CC_CDECL, uint32_t>(targetAddr, 5));
+			Assert::AreEqual(uint32_t(6), trampolineBlock.invokeAddr<Win32::CC_CDECL, uint32_t>(detour.getTrampoline(), 5));
+			Assert::IsTrue(detour.uninstall());
+			Assert::AreEqual(uint32_t(6), block.invokeAddr<Win32::CC_CDECL, uint32_t>(targetAddr, 5));
+		}
+
+		TEST_METHOD(TestEmit) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Addr functionAddr = Os::emit(block, [](auto& emitBlock) {
+				testArch::Mov(emitBlock, X86::EAX, U32(5));
+				testArch::Ret(emitBlock);
+			});
+			Assert::IsTrue(functionAddr == block.getStartPtr());
+			Assert::AreEqual(Size(7), block.getSize());
+			Assert::AreEqual(uint32_t(5), block.invokeAddr<Win32::CC_CDECL, uint32_t>(functionAddr));
+		}
+
+		TEST_METHOD(TestInstructionSize) {
+			constexpr Size size = Os::instructionSize([](auto& block) {
+				testArch::Mov(block, X86::EAX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+				testArch::Ret(block);
+			});
+			static_assert(size == 5, "Invalid constexpr instruction size");
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			testArch::Mov(block, X86::EAX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			testArch::Ret(block);
+			Assert::AreEqual(size, block.getSize());
+		}
+
+		TEST_METHOD(TestInstructionBuffer) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			{
+				Os::InstructionBuffer<Win32::CodeBlock> buffer(block);
+				X86::FwdLabel<X86::LONG> label = testArch::Jmp<X86::LONG>(buffer);
+				testArch::Mov(buffer, X86::EAX, U32(1));
+				testArch::Ret(buffer);
+				label.bind(buffer);
+				testArch::Mov(buffer, X86::EAX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+				testArch::Add(buffer, X86::EAX, U32(2));
+				testArch::Ret(buffer);
+			}
+			Assert::AreEqual(Size(5 + 6 + 1 + 4 + 6 + 1), block.getSize());
+			Assert::AreEqual(uint32_t(7), block.invoke<Win32::CC_CDECL, uint32_t>(5));
+		}
+
+		TEST_METHOD(TestStamp) {
+			uint32_t values[64];
+			uint32_t sum = 0;
+			for (uint32_t i = 0; i < 64; i++) {
+				values[i] = i * 3 + 1;
+				sum += values[i];
+			}
+			Os::Stamp<> stamp;
+			stamp.record([&stamp](Os::CodeBlock& block) {
+				auto add = testArch::Add(block, X86::EAX, X86::Mem32<X86::BASE_OFFSET>(X86::ECX, 0x1000));
+				stamp.addField(add.second.getDWordOffset(), sizeof(uint32_t));
+			});
+			Assert::AreEqual(Size(6), stamp.getSize());
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			testArch::Mov(block, X86::ECX, X86::Mem32<X86::BASE_OFFSET>(X86::ESP, 4));
+			testArch::Sub(block, X86::ECX, U32(0x1000));
+			testArch::Xor(block, X86::EAX, X86::EAX);
+			Assert::IsTrue(stamp.stamp(block, 64));
+			testArch::Ret(block);
+			Assert::AreEqual(sum, block.invoke<Win32::CC_CDECL, uint32_t>(values));
+			Assert::IsFalse(stamp.stamp(block, 0x40000000));
+		}
+
+		TEST_METHOD(TestFloatResult) {
+			Win32::CodeBlock block(CODE_BLOCK_SIZE);
+			Addr functionAddr = nullptr;
+			{
+				Win32::FunctionGen<Win32::CC_CDECL> funcGen(block, 16, 0);
+				functionAddr = funcGen.getAddress();
+				X86::SSE2::Movsd(block, X86::XMM0, funcGen.getParameter(0));
+				X86::SSE2::Mulsd(block, X86::XMM0, funcGen.getParameter(8));
+				X86::SSE2::Sqrtsd(block, X86::XMM0, X86::XMM0);
+				funcGen.setFloatResult(X86::XMM0);
+			}
+			double ret = block.invokeAddr<Win32::CC_CDECL, double>(functionAddr, 2.5, 10.0);
+			Assert::AreEqual(5.0, ret);
+		}
+
+		TEST_METHOD(TestListing) {
+			Os::ListingBlock<4, Win32::CodeBlock> block(CODE_BLOCK_SIZE);
+			block.mark("nop");
+			testArch::Nop(block);
+			block.mark("mov eax, ecx");
+			testArch::Mov(block, X86::EAX, X86::ECX);
+			Os::listInstruction(block, "ret");
+			testArch::Ret(block);
+			Assert::AreEqual(Size(3), block.getEntriesCount());
+			Assert::AreEqual(Offset(1), block.getEntry(1).offset);
+			Assert::AreEqual(Size(2), block.getEntry(1).size);
+			Assert::AreEqual(Size(1), block.getEntry(2).size);
+			block.reset();
+			Assert::AreEqual(Size(0), block.getEntriesCount());
+		}
 	};
 }
\ No newline at end of file